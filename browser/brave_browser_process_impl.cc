@@ -208,7 +208,8 @@ brave_shields::AdBlockService* BraveBrowserProcessImpl::ad_block_service() {
             local_state(), task_runner,
             AdBlockSubscriptionDownloadManagerGetter(),
             profile_manager()->user_data_dir().Append(
-                profile_manager()->GetInitialProfileDir())));
+                profile_manager()->GetInitialProfileDir())),
+        profile_manager()->user_data_dir());
   }
   return ad_block_service_.get();
 }
@@ -91,6 +91,7 @@ using brave_shields::features::kBraveAdblockCosmeticFiltering;
 using brave_shields::features::kBraveAdblockCosmeticFilteringChildFrames;
 using brave_shields::features::kBraveAdblockDefault1pBlocking;
 using brave_shields::features::kCosmeticFilteringJsPerformance;
+using brave_shields::features::kCosmeticFilteringNativeClassIdCollection;
 
 AdBlockServiceTest::AdBlockServiceTest() {
   brave_shields::SetDefaultAdBlockComponentIdAndBase64PublicKeyForTest(
@@ -2089,6 +2090,71 @@ IN_PROC_BROWSER_TEST_F(AdBlockServiceTest, CosmeticFilteringDynamicCustom) {
   EXPECT_EQ(base::Value(true), result_second.value);
 }
 
+class CosmeticFilteringClassIdCollectionTest
+    : public AdBlockServiceTest,
+      public testing::WithParamInterface<bool> {
+ public:
+  CosmeticFilteringClassIdCollectionTest() {
+    feature_list_.InitWithFeatureState(
+        kCosmeticFilteringNativeClassIdCollection, GetParam());
+  }
+
+ private:
+  base::test::ScopedFeatureList feature_list_;
+};
+
+// Classes and ids are collected natively or by content_cosmetic.ts, which
+// passes them to the renderer as string arrays. Both must find elements present
+// at load, added later, or whose class changed.
+IN_PROC_BROWSER_TEST_P(CosmeticFilteringClassIdCollectionTest,
+                       GenericClassAndIdRules) {
+  ASSERT_TRUE(InstallDefaultAdBlockExtension());
+  UpdateAdBlockInstanceWithRules(
+      "##.ad\n"
+      "##.blockme\n"
+      "##.retagged\n"
+      "###retagged-id");
+
+  GURL tab_url =
+      embedded_test_server()->GetURL("b.com", "/cosmetic_filtering.html");
+  ASSERT_TRUE(ui_test_utils::NavigateToURL(browser(), tab_url));
+
+  content::WebContents* contents =
+      browser()->tab_strip_model()->GetActiveWebContents();
+
+  const char kWaitForSelector[] = R"(
+      async function waitCSSSelector() {
+        if (await checkSelector($1, 'display', $2)) {
+          window.domAutomationController.send(true);
+        } else {
+          console.log('still waiting for css selector', $1);
+          setTimeout(waitCSSSelector, 200);
+        }
+      } waitCSSSelector())";
+  const auto wait_for_selector = [&](const std::string& selector,
+                                     const std::string& display) {
+    return EvalJs(contents,
+                  content::JsReplace(kWaitForSelector, selector, display),
+                  content::EXECUTE_SCRIPT_USE_MANUAL_REPLY);
+  };
+
+  EXPECT_EQ(true, wait_for_selector(".ad", "none"));
+
+  ASSERT_TRUE(content::ExecJs(contents, "addElementsDynamically()"));
+  EXPECT_EQ(true, wait_for_selector(".blockme", "none"));
+  EXPECT_EQ(true, wait_for_selector(".dontblockme", "block"));
+
+  ASSERT_TRUE(content::ExecJs(contents, R"(
+      document.querySelector('.ad-banner').className = 'retagged';
+      document.querySelector('.dontblockme').id = 'retagged-id';)"));
+  EXPECT_EQ(true, wait_for_selector(".retagged", "none"));
+  EXPECT_EQ(true, wait_for_selector("#retagged-id", "none"));
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         CosmeticFilteringClassIdCollectionTest,
+                         testing::Bool());
+
 // Test cosmetic filtering ignores generic cosmetic rules in the presence of a
 // `generichide` exception rule, both for elements added dynamically and
 // elements present at page load
@@ -2458,7 +2524,7 @@ class AdBlockServiceTestJsPerformance : public AdBlockServiceTest {
           {{"subframes_first_query_delay_ms", "3000"},
            {"switch_to_polling_threshold", "500"},
            {"fetch_throttling_ms", "500"}}}},
-        {});
+        {kCosmeticFilteringNativeClassIdCollection});
   }
 
   void AddDivsWithDynamicClasses(const content::ToRenderFrameHost& target,
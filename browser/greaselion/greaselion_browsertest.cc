@@ -7,10 +7,12 @@
 #include "base/files/file_enumerator.h"
 #include "base/memory/raw_ptr.h"
 #include "base/path_service.h"
+#include "base/ranges/algorithm.h"
 #include "base/run_loop.h"
 #include "base/scoped_observation.h"
 #include "base/task/thread_pool.h"
 #include "base/test/bind.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/thread_test_helper.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/brave_rewards/rewards_service_factory.h"
@@ -21,13 +23,15 @@
 #include "brave/components/brave_rewards/browser/test/common/rewards_browsertest_response.h"
 #include "brave/components/brave_rewards/browser/test/common/rewards_browsertest_util.h"
 #include "brave/components/constants/brave_paths.h"
+#include "brave/components/greaselion/browser/features.h"
 #include "brave/components/greaselion/browser/greaselion_download_service.h"
 #include "brave/components/greaselion/browser/greaselion_service.h"
+#include "brave/components/greaselion/browser/greaselion_service_impl.h"
 #include "chrome/browser/extensions/extension_browsertest.h"
 #include "chrome/test/base/ui_test_utils.h"
 #include "content/public/test/browser_test.h"
 #include "content/public/test/browser_test_utils.h"
-#include "extensions/common/file_util.h"
+#include "extensions/browser/extension_registry.h"
 #include "net/dns/mock_host_resolver.h"
 #include "ui/base/ui_base_switches.h"
 
@@ -99,9 +103,15 @@ class GreaselionServiceWaiter : public GreaselionService::Observer {
       scoped_observer_{this};
 };
 
-class GreaselionServiceTest : public BaseLocalDataFilesBrowserTest {
+// Parametrized on whether rules are bundled into a single extension.
+class GreaselionServiceTest : public BaseLocalDataFilesBrowserTest,
+                              public testing::WithParamInterface<bool> {
  public:
-  GreaselionServiceTest(): https_server_(net::EmbeddedTestServer::TYPE_HTTPS) {
+  GreaselionServiceTest() : GreaselionServiceTest(GetParam()) {}
+  explicit GreaselionServiceTest(bool bundle_rules)
+      : https_server_(net::EmbeddedTestServer::TYPE_HTTPS) {
+    feature_list_.InitWithFeatureState(
+        greaselion::features::kGreaselionBundleRules, bundle_rules);
     response_ =
         std::make_unique<rewards_browsertest::RewardsBrowserTestResponse>();
   }
@@ -187,13 +197,18 @@ class GreaselionServiceTest : public BaseLocalDataFilesBrowserTest {
   std::unique_ptr<rewards_browsertest::RewardsBrowserTestResponse> response_;
   net::test_server::EmbeddedTestServer https_server_;
   raw_ptr<brave_rewards::RewardsServiceImpl> rewards_service_ = nullptr;
+
+ private:
+  base::test::ScopedFeatureList feature_list_;
 };
 
+INSTANTIATE_TEST_SUITE_P(, GreaselionServiceTest, testing::Bool());
+
 #if !BUILDFLAG(IS_MAC)
 class GreaselionServiceLocaleTest : public GreaselionServiceTest {
  public:
   explicit GreaselionServiceLocaleTest(const std::string& locale)
-      : locale_(locale) {}
+      : GreaselionServiceTest(/*bundle_rules*/ false), locale_(locale) {}
 
   void SetUpCommandLine(base::CommandLine* command_line) override {
     ExtensionBrowserTest::SetUpCommandLine(command_line);
@@ -223,7 +238,7 @@ class GreaselionServiceLocaleTestFrench : public GreaselionServiceLocaleTest {
 // Ensure the site specific script service properly clears its cache of
 // precompiled URLPatterns if initialized twice. (This can happen if
 // the parent component is updated while Brave is running.)
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ClearCache) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, ClearCache) {
   ASSERT_TRUE(InstallMockExtension());
   int size = GetRulesSize();
   // clear the cache manually to make sure we're actually
@@ -237,7 +252,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ClearCache) {
   EXPECT_EQ(size, GetRulesSize());
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjection) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, ScriptInjection) {
   ASSERT_TRUE(InstallMockExtension());
   GURL url = embedded_test_server()->GetURL("www.a.com", "/simple.html");
   ASSERT_TRUE(ui_test_utils::NavigateToURL(browser(), url));
@@ -254,7 +269,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjection) {
   EXPECT_EQ(title, "Altered");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjectionDocumentStart) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, ScriptInjectionDocumentStart) {
   ASSERT_TRUE(InstallMockExtension());
   GURL url = embedded_test_server()->GetURL("runat1.b.com", "/intercept.html");
   ASSERT_TRUE(ui_test_utils::NavigateToURL(browser(), url));
@@ -271,7 +286,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjectionDocumentStart) {
   EXPECT_EQ(title, "SCRIPT_FIRST");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjectionDocumentEnd) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, ScriptInjectionDocumentEnd) {
   ASSERT_TRUE(InstallMockExtension());
   GURL url = embedded_test_server()->GetURL("runat2.b.com", "/intercept.html");
   ASSERT_TRUE(ui_test_utils::NavigateToURL(browser(), url));
@@ -288,7 +303,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjectionDocumentEnd) {
   EXPECT_EQ(title, "PAGE_FIRST");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjectionRunAtDefault) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, ScriptInjectionRunAtDefault) {
   ASSERT_TRUE(InstallMockExtension());
   GURL url = embedded_test_server()->GetURL("runat3.b.com", "/intercept.html");
   ASSERT_TRUE(ui_test_utils::NavigateToURL(browser(), url));
@@ -305,7 +320,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjectionRunAtDefault) {
   EXPECT_EQ(title, "PAGE_FIRST");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
                        PRE_ScriptInjectionWithPrecondition) {
   ASSERT_TRUE(InstallMockExtension());
 
@@ -329,7 +344,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
   rewards_service_->SetAutoContributeEnabled(true);
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjectionWithPrecondition) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, ScriptInjectionWithPrecondition) {
   ASSERT_TRUE(InstallMockExtension());
 
   GURL url = embedded_test_server()->GetURL("pre1.example.com", "/simple.html");
@@ -349,7 +364,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjectionWithPrecondition) {
   EXPECT_EQ(title, "Altered");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, IsGreaselionExtension) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, IsGreaselionExtension) {
   ASSERT_TRUE(InstallMockExtension());
 
   GreaselionService* greaselion_service =
@@ -362,7 +377,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, IsGreaselionExtension) {
   EXPECT_TRUE(greaselion_service->IsGreaselionExtension(extension_ids[0]));
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, IsNotGreaselionExtension) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, IsNotGreaselionExtension) {
   ASSERT_TRUE(InstallMockExtension());
 
   GreaselionService* greaselion_service =
@@ -373,7 +388,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, IsNotGreaselionExtension) {
 }
 
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
                       ScriptInjectionWithBrowserVersionConditionLowWild) {
   ASSERT_TRUE(InstallMockExtension());
 
@@ -394,7 +409,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
   EXPECT_EQ(title, "Altered");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
                       ScriptInjectionWithBrowserVersionConditionLowFormat) {
   ASSERT_TRUE(InstallMockExtension());
 
@@ -416,7 +431,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
   EXPECT_EQ(title, "Altered");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
                       ScriptInjectionWithBrowserVersionConditionMatchWild) {
   ASSERT_TRUE(InstallMockExtension());
 
@@ -437,7 +452,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
   EXPECT_EQ(title, "Altered");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
                       ScriptInjectionWithBrowserVersionConditionMatchExact) {
   ASSERT_TRUE(InstallMockExtension());
 
@@ -458,7 +473,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
   EXPECT_EQ(title, "Altered");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
                       ScriptInjectionWithBrowserVersionConditionHighWild) {
   ASSERT_TRUE(InstallMockExtension());
 
@@ -479,7 +494,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
   EXPECT_EQ(title, "OK");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
                       ScriptInjectionWithBrowserVersionConditionHighExact) {
   ASSERT_TRUE(InstallMockExtension());
 
@@ -500,7 +515,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
   EXPECT_EQ(title, "OK");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
                       ScriptInjectionWithBrowserVersionConditionEmpty) {
   ASSERT_TRUE(InstallMockExtension());
 
@@ -521,7 +536,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
   EXPECT_EQ(title, "Altered");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
                       ScriptInjectionWithBrowserVersionConditionBadFormat) {
   ASSERT_TRUE(InstallMockExtension());
 
@@ -542,7 +557,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest,
   EXPECT_EQ(title, "Altered");
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, CleanShutdown) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, CleanShutdown) {
   ASSERT_TRUE(InstallMockExtension());
 
   GURL url = embedded_test_server()->GetURL("www.a.com", "/simple.html");
@@ -562,7 +577,7 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, CleanShutdown) {
   ui_test_utils::WaitForBrowserToClose(browser());
 }
 
-IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, FoldersAreRemovedOnUpdate) {
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, FoldersAreRemovedOnUpdate) {
   ASSERT_TRUE(InstallMockExtension());
 
   auto io_runner = base::ThreadPool::CreateSequencedTaskRunner(
@@ -582,7 +597,8 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, FoldersAreRemovedOnUpdate) {
           GreaselionServiceFactory::GetInstallDirectory();
 
       base::FilePath extensions_dir =
-          extensions::file_util::GetInstallTempDir(install_dir);
+          greaselion::GreaselionServiceImpl::GetExtensionCacheDirectory(
+              install_dir);
 
       base::FileEnumerator enumerator(extensions_dir, false,
                                       base::FileEnumerator::DIRECTORIES);
@@ -617,6 +633,117 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, FoldersAreRemovedOnUpdate) {
   EXPECT_EQ(after_update, start_count);
 }
 
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, CachedExtensionsAreReused) {
+  ASSERT_TRUE(InstallMockExtension());
+
+  auto get_extension_paths = [this]() {
+    GreaselionService* greaselion_service =
+        GreaselionServiceFactory::GetForBrowserContext(profile());
+    extensions::ExtensionRegistry* registry =
+        extensions::ExtensionRegistry::Get(profile());
+    std::vector<base::FilePath> extension_paths;
+    for (const auto& id : greaselion_service->GetExtensionIdsForTesting()) {
+      const extensions::Extension* extension =
+          registry->enabled_extensions().GetByID(id);
+      EXPECT_TRUE(extension);
+      if (extension) {
+        extension_paths.push_back(extension->path());
+      }
+    }
+    base::ranges::sort(extension_paths);
+    return extension_paths;
+  };
+
+  const std::vector<base::FilePath> extension_paths = get_extension_paths();
+  EXPECT_FALSE(extension_paths.empty());
+
+  // Reinstalling the extensions for unchanged rules should load them from the
+  // cache instead of generating them again.
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  ASSERT_TRUE(greaselion_service);
+  greaselion_service->UpdateInstalledExtensions();
+  GreaselionServiceWaiter(greaselion_service).Wait();
+
+  EXPECT_EQ(extension_paths, get_extension_paths());
+}
+
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, RulesAreBundled) {
+  ASSERT_TRUE(InstallMockExtension());
+
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  ASSERT_TRUE(greaselion_service);
+
+  if (GetParam()) {
+    // Rules with messages cannot be bundled, so they are installed as
+    // separate extensions.
+    EXPECT_EQ(2UL, greaselion_service->GetExtensionIdsForTesting().size());
+  } else {
+    EXPECT_LT(2UL, greaselion_service->GetExtensionIdsForTesting().size());
+  }
+}
+
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest,
+                       NoScriptInjectionForParentDomain) {
+  ASSERT_TRUE(InstallMockExtension());
+  GURL url = embedded_test_server()->GetURL("a.com", "/simple.html");
+  ASSERT_TRUE(ui_test_utils::NavigateToURL(browser(), url));
+  content::WebContents* contents =
+      browser()->tab_strip_model()->GetActiveWebContents();
+  ASSERT_TRUE(content::WaitForLoadStop(contents));
+  EXPECT_EQ(url, contents->GetURL());
+  std::string title;
+  ASSERT_TRUE(
+      ExecuteScriptAndExtractString(contents,
+                                    "window.domAutomationController.send("
+                                    "document.title)",
+                                    &title));
+  // should be unaltered because the rule only matches www.a.com
+  EXPECT_EQ(title, "OK");
+}
+
+IN_PROC_BROWSER_TEST_P(GreaselionServiceTest, PreconditionToggledAtRuntime) {
+  ASSERT_TRUE(InstallMockExtension());
+
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  ASSERT_TRUE(greaselion_service);
+
+  GURL url = embedded_test_server()->GetURL("pre1.example.com", "/simple.html");
+  auto get_title = [&]() {
+    EXPECT_TRUE(ui_test_utils::NavigateToURL(browser(), url));
+    content::WebContents* contents =
+        browser()->tab_strip_model()->GetActiveWebContents();
+    EXPECT_TRUE(content::WaitForLoadStop(contents));
+    std::string title;
+    EXPECT_TRUE(
+        ExecuteScriptAndExtractString(contents,
+                                      "window.domAutomationController.send("
+                                      "document.title)",
+                                      &title));
+    return title;
+  };
+
+  EXPECT_EQ(get_title(), "OK");
+
+  const std::vector<extensions::ExtensionId> extension_ids =
+      greaselion_service->GetExtensionIdsForTesting();
+  greaselion_service->SetFeatureEnabled(greaselion::AUTO_CONTRIBUTION, true);
+  GreaselionServiceWaiter(greaselion_service).Wait();
+  EXPECT_EQ(get_title(), "Altered");
+
+  greaselion_service->SetFeatureEnabled(greaselion::AUTO_CONTRIBUTION, false);
+  GreaselionServiceWaiter(greaselion_service).Wait();
+  EXPECT_EQ(get_title(), "OK");
+
+  if (GetParam()) {
+    // The bundle gates the rule when it runs, so toggling the feature does
+    // not reinstall it.
+    EXPECT_EQ(extension_ids, greaselion_service->GetExtensionIdsForTesting());
+  }
+}
+
 #if !BUILDFLAG(IS_MAC)
 IN_PROC_BROWSER_TEST_F(GreaselionServiceLocaleTestEnglish,
                        ScriptInjectionWithMessagesDefaultLocale) {
@@ -16,6 +16,7 @@
 #include "chrome/common/chrome_paths.h"
 #include "components/keyed_service/content/browser_context_dependency_manager.h"
 #include "components/keyed_service/core/keyed_service.h"
+#include "extensions/browser/api/storage/storage_frontend.h"
 #include "extensions/browser/extension_file_task_runner.h"
 #include "extensions/browser/extension_registry.h"
 #include "extensions/browser/extension_registry_factory.h"
@@ -47,6 +48,7 @@ GreaselionServiceFactory::GreaselionServiceFactory()
           "GreaselionService",
           BrowserContextDependencyManager::GetInstance()) {
   DependsOn(extensions::ExtensionRegistryFactory::GetInstance());
+  DependsOn(extensions::StorageFrontend::GetFactoryInstance());
   DependsOn(
       extensions::ExtensionsBrowserClient::Get()->GetExtensionSystemFactory());
 }
@@ -68,9 +70,9 @@ KeyedService* GreaselionServiceFactory::BuildServiceInstanceFor(
   if (g_brave_browser_process)
     download_service = g_brave_browser_process->greaselion_download_service();
   std::unique_ptr<GreaselionServiceImpl> greaselion_service(
-      new GreaselionServiceImpl(download_service, GetInstallDirectory(),
-                                extension_system, extension_registry,
-                                task_runner));
+      new GreaselionServiceImpl(context, download_service,
+                                GetInstallDirectory(), extension_system,
+                                extension_registry, task_runner));
   return greaselion_service.release();
 }
 
@@ -104,7 +104,8 @@ class BraveAdBlockTPNetworkDelegateHelperTest : public testing::Test {
             brave_component_updater_delegate_->local_state(),
             brave_component_updater_delegate_->GetTaskRunner(),
             base::BindOnce(&FakeAdBlockSubscriptionDownloadManagerGetter),
-            user_data_dir));
+            user_data_dir),
+        user_data_dir);
 
     TestingBraveBrowserProcess::GetGlobal()->SetAdBlockService(
         std::move(adblock_service));
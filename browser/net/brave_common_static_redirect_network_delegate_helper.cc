@@ -7,9 +7,12 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
+#include "brave/browser/net/static_redirect_rules.h"
 #include "brave/components/constants/network_constants.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
@@ -42,6 +45,38 @@ bool RewriteBugReportingURL(const GURL& request_url, GURL* new_url) {
   return true;
 }
 
+bool RedirectToRedirectorProxy(const GURL& request_url, GURL* new_url) {
+  GURL::Replacements replacements;
+  replacements.SetSchemeStr("https");
+  replacements.SetHostStr(kBraveRedirectorProxy);
+  *new_url = request_url.ReplaceComponents(replacements);
+  return true;
+}
+
+bool RedirectToClients4Proxy(const GURL& request_url, GURL* new_url) {
+  GURL::Replacements replacements;
+  replacements.SetSchemeStr("https");
+  replacements.SetHostStr(kBraveClients4Proxy);
+  *new_url = request_url.ReplaceComponents(replacements);
+  return true;
+}
+
+// Rules are applied in order, and only the first matching rule redirects.
+const StaticRedirectRules& GetCommonStaticRedirectRules() {
+  constexpr int kHttpOrHttps =
+      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+  static const base::NoDestructor<StaticRedirectRules> rules(
+      std::vector<StaticRedirectRule>{
+          {kHttpOrHttps, kChromeCastPrefix, &RedirectToRedirectorProxy},
+          StaticRedirectRule(kHttpOrHttps, kClients4Prefix,
+                             &RedirectToClients4Proxy)
+              .MatchHostOnly(),
+          {kHttpOrHttps, "*://bugs.chromium.org/p/chromium/issues/entry?*",
+           &RewriteBugReportingURL},
+      });
+  return *rules;
+}
+
 }  // namespace
 
 int OnBeforeURLRequest_CommonStaticRedirectWork(
@@ -61,36 +96,8 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
     GURL* new_url) {
   DCHECK(new_url);
 
-  GURL::Replacements replacements;
-  static URLPattern chromecast_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kChromeCastPrefix);
-  static URLPattern clients4_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kClients4Prefix);
-  static URLPattern bugsChromium_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://bugs.chromium.org/p/chromium/issues/entry?*");
-
-  if (chromecast_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (clients4_pattern.MatchesHost(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveClients4Proxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (bugsChromium_pattern.MatchesURL(request_url)) {
-    if (RewriteBugReportingURL(request_url, new_url))
-      return net::OK;
-  }
-
+  GetCommonStaticRedirectRules().Apply(request_url, new_url);
   return net::OK;
 }
 
-
 }  // namespace brave
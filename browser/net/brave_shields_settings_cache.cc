@@ -0,0 +1,107 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_shields_settings_cache.h"
+
+#include <utility>
+
+#include "base/memory/ptr_util.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/profiles/profile.h"
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave {
+
+namespace {
+
+// User data key for BraveShieldsSettingsCache.
+const void* const kBraveShieldsSettingsCacheUserDataKey =
+    &kBraveShieldsSettingsCacheUserDataKey;
+
+// Enough for the top frame origins of all open tabs and their redirects.
+constexpr size_t kMaxCachedSettings = 100;
+
+bool IsCachedContentSettingsType(ContentSettingsType type) {
+  switch (type) {
+    case ContentSettingsType::BRAVE_SHIELDS:
+    case ContentSettingsType::BRAVE_ADS:
+    case ContentSettingsType::BRAVE_COSMETIC_FILTERING:
+    case ContentSettingsType::BRAVE_HTTP_UPGRADABLE_RESOURCES:
+    case ContentSettingsType::BRAVE_REFERRERS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+BraveShieldsSettingsCache::BraveShieldsSettingsCache(
+    scoped_refptr<HostContentSettingsMap> map)
+    : map_(std::move(map)), settings_(kMaxCachedSettings) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  observation_.Observe(map_.get());
+}
+
+BraveShieldsSettingsCache::~BraveShieldsSettingsCache() = default;
+
+// static
+BraveShieldsSettingsCache* BraveShieldsSettingsCache::GetForBrowserContext(
+    content::BrowserContext* browser_context) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  auto* self = static_cast<BraveShieldsSettingsCache*>(
+      browser_context->GetUserData(kBraveShieldsSettingsCacheUserDataKey));
+  if (!self) {
+    self = new BraveShieldsSettingsCache(
+        base::WrapRefCounted(HostContentSettingsMapFactory::GetForProfile(
+            Profile::FromBrowserContext(browser_context))));
+    browser_context->SetUserData(kBraveShieldsSettingsCacheUserDataKey,
+                                 base::WrapUnique(self));
+  }
+  return self;
+}
+
+BraveShieldsSettings BraveShieldsSettingsCache::GetSettings(const GURL& url) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  auto it = settings_.Get(url);
+  if (it != settings_.end()) {
+    return it->second;
+  }
+
+  ++lookup_count_;
+  BraveShieldsSettings settings;
+  settings.allow_brave_shields =
+      brave_shields::GetBraveShieldsEnabled(map_.get(), url);
+  settings.allow_ads = brave_shields::GetAdControlType(map_.get(), url) ==
+                       brave_shields::ControlType::ALLOW;
+  // Currently, "aggressive" mode is registered as a cosmetic filtering control
+  // type, even though it can also affect network blocking.
+  settings.aggressive_blocking =
+      brave_shields::GetCosmeticFilteringControlType(map_.get(), url) ==
+      brave_shields::ControlType::BLOCK;
+  settings.allow_http_upgradable_resource =
+      !brave_shields::GetHTTPSEverywhereEnabled(map_.get(), url);
+  settings.allow_referrers =
+      brave_shields::AreReferrersAllowed(map_.get(), url);
+
+  settings_.Put(url, settings);
+  return settings;
+}
+
+void BraveShieldsSettingsCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsTypeSet content_type_set) {
+  if (content_type_set.ContainsAllTypes() ||
+      IsCachedContentSettingsType(content_type_set.GetType())) {
+    settings_.Clear();
+  }
+}
+
+}  // namespace brave
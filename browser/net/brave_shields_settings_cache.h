@@ -0,0 +1,76 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_BRAVE_SHIELDS_SETTINGS_CACHE_H_
+#define BRAVE_BROWSER_NET_BRAVE_SHIELDS_SETTINGS_CACHE_H_
+
+#include <cstddef>
+
+#include "base/containers/lru_cache.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/scoped_observation.h"
+#include "base/supports_user_data.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "url/gurl.h"
+
+namespace content {
+class BrowserContext;
+}
+
+namespace brave {
+
+// Shields settings of a URL, as used by |BraveRequestInfo|.
+struct BraveShieldsSettings {
+  bool allow_brave_shields = true;
+  bool allow_ads = false;
+  // Whether or not Shields "aggressive" mode is enabled.
+  bool aggressive_blocking = false;
+  bool allow_http_upgradable_resource = false;
+  bool allow_referrers = false;
+};
+
+// Caches resolved shields settings per URL, so that the subresources of a
+// page share the settings of their top frame origin instead of each looking
+// them up in the HostContentSettingsMap. The cache is cleared whenever one of
+// the shields content settings changes. There is one cache per profile.
+class BraveShieldsSettingsCache : public base::SupportsUserData::Data,
+                                  public content_settings::Observer {
+ public:
+  BraveShieldsSettingsCache(const BraveShieldsSettingsCache&) = delete;
+  BraveShieldsSettingsCache& operator=(const BraveShieldsSettingsCache&) =
+      delete;
+  ~BraveShieldsSettingsCache() override;
+
+  static BraveShieldsSettingsCache* GetForBrowserContext(
+      content::BrowserContext* browser_context);
+
+  BraveShieldsSettings GetSettings(const GURL& url);
+
+  // Returns how many times settings were looked up in the content settings
+  // map rather than served from the cache.
+  size_t GetLookupCountForTesting() const { return lookup_count_; }
+
+ private:
+  explicit BraveShieldsSettingsCache(scoped_refptr<HostContentSettingsMap> map);
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(
+      const ContentSettingsPattern& primary_pattern,
+      const ContentSettingsPattern& secondary_pattern,
+      ContentSettingsTypeSet content_type_set) override;
+
+  // Kept alive so that the observation can be removed when the profile's
+  // user data is destroyed, which happens after its keyed services.
+  scoped_refptr<HostContentSettingsMap> map_;
+  base::LRUCache<GURL, BraveShieldsSettings> settings_;
+  size_t lookup_count_ = 0;
+  base::ScopedObservation<HostContentSettingsMap, content_settings::Observer>
+      observation_{this};
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_BRAVE_SHIELDS_SETTINGS_CACHE_H_
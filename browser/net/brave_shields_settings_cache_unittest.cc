@@ -0,0 +1,93 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_shields_settings_cache.h"
+
+#include <memory>
+
+#include "brave/browser/net/url_context.h"
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/base/isolation_info.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+namespace brave {
+
+class BraveShieldsSettingsCacheTest : public testing::Test {
+ public:
+  BraveShieldsSettingsCacheTest() : profile_(new TestingProfile) {}
+  ~BraveShieldsSettingsCacheTest() override = default;
+
+  TestingProfile* profile() { return profile_.get(); }
+
+  HostContentSettingsMap* map() {
+    return HostContentSettingsMapFactory::GetForProfile(profile());
+  }
+
+  BraveShieldsSettingsCache* cache() {
+    return BraveShieldsSettingsCache::GetForBrowserContext(profile());
+  }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<TestingProfile> profile_;
+};
+
+TEST_F(BraveShieldsSettingsCacheTest, SubresourcesShareTopFrameSettings) {
+  const url::Origin top_frame_origin =
+      url::Origin::Create(GURL("https://example.com"));
+
+  // A page load makes a request context for each of its subresources.
+  for (int i = 0; i < 300; ++i) {
+    network::ResourceRequest request;
+    request.url = GURL("https://cdn.example.net/resource.js");
+    request.trusted_params = network::ResourceRequest::TrustedParams();
+    request.trusted_params->isolation_info =
+        net::IsolationInfo::CreateForInternalRequest(top_frame_origin);
+    auto ctx = BraveRequestInfo::MakeCTX(request, 0, 0, i, profile(), nullptr);
+    EXPECT_TRUE(ctx->allow_brave_shields);
+    EXPECT_FALSE(ctx->allow_ads);
+  }
+
+  EXPECT_EQ(cache()->GetLookupCountForTesting(), 1u);
+}
+
+TEST_F(BraveShieldsSettingsCacheTest, ClearedWhenShieldsSettingChanges) {
+  const GURL url("https://example.com");
+
+  EXPECT_TRUE(cache()->GetSettings(url).allow_brave_shields);
+  EXPECT_FALSE(cache()->GetSettings(url).allow_ads);
+  EXPECT_EQ(cache()->GetLookupCountForTesting(), 1u);
+
+  map()->SetContentSettingCustomScope(
+      brave_shields::GetPatternFromURL(url),
+      ContentSettingsPattern::Wildcard(), ContentSettingsType::BRAVE_ADS,
+      CONTENT_SETTING_ALLOW);
+  EXPECT_TRUE(cache()->GetSettings(url).allow_ads);
+  EXPECT_EQ(cache()->GetLookupCountForTesting(), 2u);
+
+  brave_shields::SetBraveShieldsEnabled(map(), false, url);
+  EXPECT_FALSE(cache()->GetSettings(url).allow_brave_shields);
+  EXPECT_EQ(cache()->GetLookupCountForTesting(), 3u);
+}
+
+TEST_F(BraveShieldsSettingsCacheTest, NotClearedByOtherContentSettings) {
+  const GURL url("https://example.com");
+
+  cache()->GetSettings(url);
+  map()->SetContentSettingDefaultScope(
+      url, GURL(), ContentSettingsType::GEOLOCATION, CONTENT_SETTING_BLOCK);
+  cache()->GetSettings(url);
+
+  EXPECT_EQ(cache()->GetLookupCountForTesting(), 1u);
+}
+
+}  // namespace brave
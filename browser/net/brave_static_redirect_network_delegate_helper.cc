@@ -5,13 +5,14 @@
 
 #include "brave/browser/net/brave_static_redirect_network_delegate_helper.h"
 
-#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include "base/strings/string_piece_forward.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "brave/browser/net/brave_geolocation_buildflags.h"
+#include "brave/browser/net/static_redirect_rules.h"
 #include "brave/browser/safebrowsing/buildflags.h"
 #include "brave/components/constants/network_constants.h"
 #include "extensions/common/url_pattern.h"
@@ -31,6 +32,98 @@ base::StringPiece GetSafeBrowsingEndpoint() {
   return BUILDFLAG(SAFEBROWSING_ENDPOINT);
 }
 
+constexpr int kHttpOrHttps = URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+
+bool ReplaceHost(const GURL& request_url,
+                 base::StringPiece host,
+                 GURL* new_url) {
+  GURL::Replacements replacements;
+  replacements.SetHostStr(host);
+  *new_url = request_url.ReplaceComponents(replacements);
+  return true;
+}
+
+bool ReplaceWithHttpsHost(const GURL& request_url,
+                          base::StringPiece host,
+                          GURL* new_url) {
+  GURL::Replacements replacements;
+  replacements.SetSchemeStr("https");
+  replacements.SetHostStr(host);
+  *new_url = request_url.ReplaceComponents(replacements);
+  return true;
+}
+
+bool RedirectToGoogleApisURL(const GURL& request_url, GURL* new_url) {
+  *new_url = GURL(BUILDFLAG(GOOGLEAPIS_URL));
+  return true;
+}
+
+bool RedirectToSafeBrowsingEndpoint(const GURL& request_url, GURL* new_url) {
+  const base::StringPiece safebrowsing_endpoint = GetSafeBrowsingEndpoint();
+  if (safebrowsing_endpoint.empty())
+    return false;
+  return ReplaceHost(request_url, safebrowsing_endpoint, new_url);
+}
+
+bool RedirectToSafeBrowsingSslProxy(const GURL& request_url, GURL* new_url) {
+  if (GetSafeBrowsingEndpoint().empty())
+    return false;
+  return ReplaceHost(request_url, kBraveSafeBrowsingSslProxy, new_url);
+}
+
+bool RedirectToSafeBrowsing2Proxy(const GURL& request_url, GURL* new_url) {
+  if (GetSafeBrowsingEndpoint().empty())
+    return false;
+  return ReplaceHost(request_url, kBraveSafeBrowsing2Proxy, new_url);
+}
+
+bool RedirectToCrxDownloadProxy(const GURL& request_url, GURL* new_url) {
+  return ReplaceWithHttpsHost(request_url, "crxdownload.brave.com", new_url);
+}
+
+bool RedirectToStaticProxy(const GURL& request_url, GURL* new_url) {
+  return ReplaceWithHttpsHost(request_url, kBraveStaticProxy, new_url);
+}
+
+bool RedirectToRedirectorProxy(const GURL& request_url, GURL* new_url) {
+  return ReplaceWithHttpsHost(request_url, kBraveRedirectorProxy, new_url);
+}
+
+// Rules are applied in order, and only the first matching rule redirects.
+const StaticRedirectRules& GetStaticRedirectRules() {
+  // To-Do (@jumde) - Update the naming for the CRLSet constants
+  // https://github.com/brave/brave-browser/issues/10314
+  static const base::NoDestructor<StaticRedirectRules> rules(
+      std::vector<StaticRedirectRule>{
+          {URLPattern::SCHEME_HTTPS, kGeoLocationsPattern,
+           &RedirectToGoogleApisURL},
+          StaticRedirectRule(URLPattern::SCHEME_HTTPS, kSafeBrowsingPrefix,
+                             &RedirectToSafeBrowsingEndpoint)
+              .MatchHostOnly(),
+          StaticRedirectRule(URLPattern::SCHEME_HTTPS,
+                             kSafeBrowsingFileCheckPrefix,
+                             &RedirectToSafeBrowsingSslProxy)
+              .MatchHostOnly(),
+          StaticRedirectRule(URLPattern::SCHEME_HTTPS,
+                             kSafeBrowsingCrxListPrefix,
+                             &RedirectToSafeBrowsing2Proxy)
+              .MatchHostOnly(),
+          {kHttpOrHttps, kCRXDownloadPrefix, &RedirectToCrxDownloadProxy},
+          {URLPattern::SCHEME_HTTPS, kAutofillPrefix, &RedirectToStaticProxy},
+          {kHttpOrHttps, kCRLSetPrefix1, &RedirectToRedirectorProxy},
+          {kHttpOrHttps, kCRLSetPrefix2, &RedirectToRedirectorProxy},
+          {kHttpOrHttps, kCRLSetPrefix3, &RedirectToRedirectorProxy},
+          {kHttpOrHttps, kCRLSetPrefix4, &RedirectToRedirectorProxy},
+          StaticRedirectRule(kHttpOrHttps, "*://*.gvt1.com/*",
+                             &RedirectToRedirectorProxy)
+              .Except(kWidevineGvt1Prefix),
+          StaticRedirectRule(kHttpOrHttps, "*://dl.google.com/*",
+                             &RedirectToRedirectorProxy)
+              .Except(kWidevineGoogleDlPrefix),
+      });
+  return *rules;
+}
+
 }  // namespace
 
 void SetSafeBrowsingEndpointForTesting(bool testing) {
@@ -52,127 +145,7 @@ int OnBeforeURLRequest_StaticRedirectWork(
 int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     const GURL& request_url,
     GURL* new_url) {
-  GURL::Replacements replacements;
-  static URLPattern geo_pattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern);
-  static URLPattern safeBrowsing_pattern(URLPattern::SCHEME_HTTPS,
-                                         kSafeBrowsingPrefix);
-  static URLPattern safebrowsingfilecheck_pattern(URLPattern::SCHEME_HTTPS,
-                                                  kSafeBrowsingFileCheckPrefix);
-  static URLPattern safebrowsingcrxlist_pattern(URLPattern::SCHEME_HTTPS,
-                                                kSafeBrowsingCrxListPrefix);
-
-  // To-Do (@jumde) - Update the naming for the variables below
-  // https://github.com/brave/brave-browser/issues/10314
-  static URLPattern crlSet_pattern1(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix1);
-  static URLPattern crlSet_pattern2(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix2);
-  static URLPattern crlSet_pattern3(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix3);
-  static URLPattern crlSet_pattern4(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix4);
-  static URLPattern crxDownload_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRXDownloadPrefix);
-  static URLPattern autofill_pattern(
-      URLPattern::SCHEME_HTTPS, kAutofillPrefix);
-  static URLPattern gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, "*://*.gvt1.com/*");
-  static URLPattern googleDl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://dl.google.com/*");
-
-  static URLPattern widevine_gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGvt1Prefix);
-  static URLPattern widevine_google_dl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGoogleDlPrefix);
-
-  if (geo_pattern.MatchesURL(request_url)) {
-    *new_url = GURL(BUILDFLAG(GOOGLEAPIS_URL));
-    return net::OK;
-  }
-
-  auto safebrowsing_endpoint = GetSafeBrowsingEndpoint();
-  if (!safebrowsing_endpoint.empty() &&
-      safeBrowsing_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(safebrowsing_endpoint);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingfilecheck_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(kBraveSafeBrowsingSslProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingcrxlist_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(kBraveSafeBrowsing2Proxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crxDownload_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crxdownload.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (autofill_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveStaticProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern1.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern2.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern3.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern4.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("redirector.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (gvt1_pattern.MatchesURL(request_url) &&
-      !widevine_gvt1_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (googleDl_pattern.MatchesURL(request_url) &&
-      !widevine_google_dl_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
+  GetStaticRedirectRules().Apply(request_url, new_url);
   return net::OK;
 }
 
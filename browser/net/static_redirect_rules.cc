@@ -0,0 +1,112 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/static_redirect_rules.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include "base/check.h"
+#include "base/strings/string_util.h"
+
+namespace brave {
+
+StaticRedirectRule::StaticRedirectRule(int valid_schemes,
+                                       base::StringPiece pattern,
+                                       RewriteFunction rewrite)
+    : pattern(valid_schemes, pattern), rewrite(rewrite) {
+  DCHECK(rewrite);
+}
+
+StaticRedirectRule::StaticRedirectRule(const StaticRedirectRule&) = default;
+
+StaticRedirectRule& StaticRedirectRule::operator=(const StaticRedirectRule&) =
+    default;
+
+StaticRedirectRule::~StaticRedirectRule() = default;
+
+StaticRedirectRule& StaticRedirectRule::MatchHostOnly() {
+  match_host_only = true;
+  return *this;
+}
+
+StaticRedirectRule& StaticRedirectRule::Except(
+    base::StringPiece exception_pattern) {
+  exception.emplace(pattern.valid_schemes(), exception_pattern);
+  return *this;
+}
+
+StaticRedirectRules::StaticRedirectRules(std::vector<StaticRedirectRule> rules)
+    : rules_(std::move(rules)) {
+  std::map<std::string, std::vector<size_t>> rules_by_host;
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    const std::string& host = rules_[i].pattern.host();
+    if (host.empty()) {
+      any_host_rules_.push_back(i);
+    } else {
+      rules_by_host[host].push_back(i);
+    }
+  }
+  rules_by_host_ =
+      base::flat_map<std::string, std::vector<size_t>, std::less<>>(
+          std::make_move_iterator(rules_by_host.begin()),
+          std::make_move_iterator(rules_by_host.end()));
+}
+
+StaticRedirectRules::~StaticRedirectRules() = default;
+
+bool StaticRedirectRules::Apply(const GURL& request_url, GURL* new_url) const {
+  DCHECK(new_url);
+
+  base::StringPiece host = request_url.host_piece();
+  base::TrimString(host, ".", &host);
+
+  std::vector<size_t> candidates(any_host_rules_);
+  const auto add_candidates = [&](base::StringPiece rule_host,
+                                  bool subdomain) {
+    const auto it = rules_by_host_.find(rule_host);
+    if (it == rules_by_host_.end()) {
+      return;
+    }
+    for (const size_t index : it->second) {
+      if (!subdomain || rules_[index].pattern.match_subdomains()) {
+        candidates.push_back(index);
+      }
+    }
+  };
+
+  add_candidates(host, false);
+  for (size_t dot = host.find('.'); dot != base::StringPiece::npos;
+       dot = host.find('.')) {
+    host.remove_prefix(dot + 1);
+    add_candidates(host, true);
+  }
+
+  if (candidates.empty()) {
+    return false;
+  }
+
+  // Rules are applied in list order, as they would be without the index.
+  std::sort(candidates.begin(), candidates.end());
+  for (const size_t index : candidates) {
+    const StaticRedirectRule& rule = rules_[index];
+    if (Matches(rule, request_url) && rule.rewrite(request_url, new_url)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool StaticRedirectRules::Matches(const StaticRedirectRule& rule,
+                                  const GURL& url) const {
+  if (rule.match_host_only) {
+    return rule.pattern.MatchesHost(url);
+  }
+  return rule.pattern.MatchesURL(url) &&
+         !(rule.exception && rule.exception->MatchesURL(url));
+}
+
+}  // namespace brave
@@ -0,0 +1,70 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_STATIC_REDIRECT_RULES_H_
+#define BRAVE_BROWSER_NET_STATIC_REDIRECT_RULES_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
+#include "extensions/common/url_pattern.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+// A URL pattern and how the URLs matching it are redirected.
+struct StaticRedirectRule {
+  // Sets |new_url| to the redirect target of |request_url|. Returns false if
+  // the rule does not apply after all.
+  using RewriteFunction = bool (*)(const GURL& request_url, GURL* new_url);
+
+  StaticRedirectRule(int valid_schemes,
+                     base::StringPiece pattern,
+                     RewriteFunction rewrite);
+  StaticRedirectRule(const StaticRedirectRule&);
+  StaticRedirectRule& operator=(const StaticRedirectRule&);
+  ~StaticRedirectRule();
+
+  // Only match the host of URLs against |pattern|.
+  StaticRedirectRule& MatchHostOnly();
+  // Do not redirect URLs which match |exception_pattern|.
+  StaticRedirectRule& Except(base::StringPiece exception_pattern);
+
+  URLPattern pattern;
+  bool match_host_only = false;
+  absl::optional<URLPattern> exception;
+  RewriteFunction rewrite;
+};
+
+// A list of static redirect rules, indexed by the host of their patterns. A
+// URL is only matched against the rules for its host and its parent domains,
+// instead of against every rule.
+class StaticRedirectRules {
+ public:
+  explicit StaticRedirectRules(std::vector<StaticRedirectRule> rules);
+  StaticRedirectRules(const StaticRedirectRules&) = delete;
+  StaticRedirectRules& operator=(const StaticRedirectRules&) = delete;
+  ~StaticRedirectRules();
+
+  // Applies the first rule, in list order, which matches |request_url| and
+  // rewrites it to |new_url|. Returns false if no rule applied.
+  bool Apply(const GURL& request_url, GURL* new_url) const;
+
+ private:
+  bool Matches(const StaticRedirectRule& rule, const GURL& url) const;
+
+  std::vector<StaticRedirectRule> rules_;
+  base::flat_map<std::string, std::vector<size_t>, std::less<>> rules_by_host_;
+  // Rules whose patterns match any host.
+  std::vector<size_t> any_host_rules_;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_STATIC_REDIRECT_RULES_H_
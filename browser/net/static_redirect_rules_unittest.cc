@@ -0,0 +1,89 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/static_redirect_rules.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+constexpr int kHttpOrHttps = URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+
+bool RedirectToFirst(const GURL& request_url, GURL* new_url) {
+  *new_url = GURL("https://first.example/");
+  return true;
+}
+
+bool RedirectToSecond(const GURL& request_url, GURL* new_url) {
+  *new_url = GURL("https://second.example/");
+  return true;
+}
+
+bool DoNotRedirect(const GURL& request_url, GURL* new_url) {
+  return false;
+}
+
+GURL Apply(const StaticRedirectRules& rules, const GURL& url) {
+  GURL new_url;
+  rules.Apply(url, &new_url);
+  return new_url;
+}
+
+}  // namespace
+
+TEST(StaticRedirectRulesTest, MatchesHostAndSubdomains) {
+  const StaticRedirectRules rules(std::vector<StaticRedirectRule>{
+      {kHttpOrHttps, "*://*.example.com/path/*", &RedirectToFirst},
+      {kHttpOrHttps, "*://www.example.org/*", &RedirectToSecond},
+  });
+
+  EXPECT_EQ(Apply(rules, GURL("https://example.com/path/a")),
+            GURL("https://first.example/"));
+  EXPECT_EQ(Apply(rules, GURL("http://a.b.example.com/path/a")),
+            GURL("https://first.example/"));
+  EXPECT_EQ(Apply(rules, GURL("https://www.example.org/")),
+            GURL("https://second.example/"));
+
+  EXPECT_TRUE(Apply(rules, GURL("https://example.com/other")).is_empty());
+  EXPECT_TRUE(Apply(rules, GURL("https://a.www.example.org/")).is_empty());
+  EXPECT_TRUE(Apply(rules, GURL("https://example.org/")).is_empty());
+  EXPECT_TRUE(Apply(rules, GURL("https://brave.com/path/a")).is_empty());
+}
+
+TEST(StaticRedirectRulesTest, FirstMatchingRuleInListOrderApplies) {
+  const StaticRedirectRules rules(std::vector<StaticRedirectRule>{
+      {kHttpOrHttps, "*://a.example.com/*", &DoNotRedirect},
+      {kHttpOrHttps, "*://*.example.com/*", &RedirectToFirst},
+      {kHttpOrHttps, "*://a.example.com/*", &RedirectToSecond},
+  });
+
+  EXPECT_EQ(Apply(rules, GURL("https://a.example.com/")),
+            GURL("https://first.example/"));
+}
+
+TEST(StaticRedirectRulesTest, HostOnlyRulesAndExceptions) {
+  const StaticRedirectRules rules(std::vector<StaticRedirectRule>{
+      StaticRedirectRule(URLPattern::SCHEME_HTTPS, "https://host.example/a",
+                         &RedirectToFirst)
+          .MatchHostOnly(),
+      StaticRedirectRule(kHttpOrHttps, "*://*.example.net/*",
+                         &RedirectToSecond)
+          .Except("*://*.example.net/*excluded*"),
+  });
+
+  EXPECT_EQ(Apply(rules, GURL("http://host.example/b")),
+            GURL("https://first.example/"));
+  EXPECT_EQ(Apply(rules, GURL("https://cdn.example.net/file")),
+            GURL("https://second.example/"));
+  EXPECT_TRUE(
+      Apply(rules, GURL("https://cdn.example.net/excluded/file")).is_empty());
+}
+
+}  // namespace brave
@@ -14,6 +14,7 @@
 #include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
 #include "net/url_request/referrer_policy.h"
+#include "services/network/public/cpp/resource_request_body.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 #include "url/gurl.h"
@@ -120,7 +121,17 @@ struct BraveRequestInfo {
       static_cast<blink::mojom::ResourceType>(-1);
   blink::mojom::ResourceType resource_type = kInvalidResourceType;
 
-  std::string upload_data;
+  // The body of the request, shared with the request itself. Use
+  // |GetUploadData| to read its bytes.
+  scoped_refptr<network::ResourceRequestBody> request_body;
+
+  // Upload data larger than this is not read by |GetUploadData|.
+  static constexpr size_t kMaxUploadDataSize = 1024 * 1024;
+
+  // Returns the bytes elements of |request_body| concatenated, or an empty
+  // string if there is no body or its bytes exceed |max_size|. The bytes are
+  // copied on each call, so only call this once they are known to be needed.
+  std::string GetUploadData(size_t max_size = kMaxUploadDataSize) const;
 
   static std::shared_ptr<brave::BraveRequestInfo> MakeCTX(
       const network::ResourceRequest& request,
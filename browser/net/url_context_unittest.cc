@@ -0,0 +1,62 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_context.h"
+
+#include <memory>
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/time/time.h"
+#include "chrome/test/base/testing_profile.h"
+#include "content/public/test/browser_task_environment.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/resource_request_body.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+class BraveRequestInfoTest : public testing::Test {
+ public:
+  BraveRequestInfoTest() : profile_(new TestingProfile) {}
+  ~BraveRequestInfoTest() override = default;
+
+  TestingProfile* profile() { return profile_.get(); }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<TestingProfile> profile_;
+};
+
+TEST_F(BraveRequestInfoTest, RequestBodyIsSharedNotCopied) {
+  network::ResourceRequest request;
+  request.url = GURL("https://example.com/upload");
+  request.method = "POST";
+  request.request_body = base::MakeRefCounted<network::ResourceRequestBody>();
+  request.request_body->AppendBytes(std::string(4 * 1024 * 1024, 'a').data(),
+                                    4 * 1024 * 1024);
+
+  auto ctx = BraveRequestInfo::MakeCTX(request, 0, 0, 1, profile(), nullptr);
+  EXPECT_EQ(ctx->request_body.get(), request.request_body.get());
+}
+
+TEST_F(BraveRequestInfoTest, GetUploadData) {
+  BraveRequestInfo ctx(GURL("https://example.com/upload"));
+  EXPECT_EQ(ctx.GetUploadData(), "");
+
+  ctx.request_body = base::MakeRefCounted<network::ResourceRequestBody>();
+  ctx.request_body->AppendBytes("name=", 5);
+  ctx.request_body->AppendFileRange(base::FilePath(FILE_PATH_LITERAL("file")),
+                                    0, 10, base::Time());
+  ctx.request_body->AppendBytes("value", 5);
+
+  // Only bytes elements are read.
+  EXPECT_EQ(ctx.GetUploadData(), "name=value");
+  EXPECT_EQ(ctx.GetUploadData(10), "name=value");
+  EXPECT_EQ(ctx.GetUploadData(9), "");
+}
+
+}  // namespace brave
@@ -99,7 +99,8 @@ void BraveSyncClientTest::SetupAdblockServiceForBraveBrowserProcess() {
       std::make_unique<brave_shields::AdBlockSubscriptionServiceManager>(
           local_state_->Get(), base::ThreadTaskRunnerHandle::Get(),
           base::BindOnce(&FakeAdBlockSubscriptionDownloadManagerGetter),
-          user_data_dir));
+          user_data_dir),
+      user_data_dir);
 
   TestingBraveBrowserProcess::GetGlobal()->SetAdBlockService(
       std::move(adblock_service));
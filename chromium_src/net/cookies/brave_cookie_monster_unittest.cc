@@ -0,0 +1,105 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "net/cookies/cookie_monster.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/callback_helpers.h"
+#include "base/test/task_environment.h"
+#include "base/time/time.h"
+#include "net/cookies/canonical_cookie.h"
+#include "net/cookies/cookie_deletion_info.h"
+#include "net/cookies/cookie_options.h"
+#include "net/cookies/cookie_partition_key_collection.h"
+#include "net/cookies/cookie_store_test_callbacks.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+namespace net {
+
+namespace {
+
+constexpr char kThirdPartyURL[] = "https://b.com/";
+
+CookieOptions MakeEphemeralOptions(const GURL& top_frame_url) {
+  CookieOptions options = CookieOptions::MakeAllInclusive();
+  options.set_should_use_ephemeral_storage(true);
+  options.set_top_frame_origin(url::Origin::Create(top_frame_url));
+  return options;
+}
+
+}  // namespace
+
+class BraveCookieMonsterTest : public testing::Test {
+ protected:
+  BraveCookieMonsterTest()
+      : cookie_monster_(std::make_unique<CookieMonster>(
+            nullptr /* store */,
+            nullptr /* net_log */,
+            /*first_party_sets_enabled=*/false)) {}
+
+  bool SetEphemeralCookie(const GURL& top_frame_url,
+                          const std::string& cookie_line) {
+    const GURL url(kThirdPartyURL);
+    ResultSavingCookieCallback<CookieAccessResult> callback;
+    cookie_monster_->SetCanonicalCookieAsync(
+        CanonicalCookie::Create(url, cookie_line, base::Time::Now(),
+                                /*server_time=*/absl::nullopt,
+                                /*cookie_partition_key=*/absl::nullopt),
+        url, MakeEphemeralOptions(top_frame_url), callback.MakeCallback());
+    callback.WaitUntilDone();
+    return callback.result().status.IsInclude();
+  }
+
+  CookieList GetEphemeralCookies(const GURL& top_frame_url) {
+    GetCookieListCallback callback;
+    cookie_monster_->GetCookieListWithOptionsAsync(
+        GURL(kThirdPartyURL), MakeEphemeralOptions(top_frame_url),
+        CookiePartitionKeyCollection(), callback.MakeCallback());
+    callback.WaitUntilDone();
+    return callback.cookies();
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  std::unique_ptr<CookieMonster> cookie_monster_;
+};
+
+TEST_F(BraveCookieMonsterTest, EphemeralStoreIsCreatedOnlyWhenCookieIsSet) {
+  const GURL top_frame_url("https://a.com/");
+
+  EXPECT_TRUE(GetEphemeralCookies(top_frame_url).empty());
+  EXPECT_EQ(cookie_monster_->GetEphemeralCookieStoreCountForTesting(), 0u);
+
+  ASSERT_TRUE(SetEphemeralCookie(top_frame_url, "name=value"));
+  EXPECT_EQ(cookie_monster_->GetEphemeralCookieStoreCountForTesting(), 1u);
+
+  const CookieList cookies = GetEphemeralCookies(top_frame_url);
+  ASSERT_EQ(cookies.size(), 1u);
+  EXPECT_EQ(cookies[0].Name(), "name");
+
+  // Other top frame sites neither see the cookie nor get a store.
+  EXPECT_TRUE(GetEphemeralCookies(GURL("https://c.com/")).empty());
+  EXPECT_EQ(cookie_monster_->GetEphemeralCookieStoreCountForTesting(), 1u);
+}
+
+TEST_F(BraveCookieMonsterTest, EphemeralStoreIsDeletedWithItsDomain) {
+  ASSERT_TRUE(SetEphemeralCookie(GURL("https://a.com/"), "name=value"));
+  ASSERT_TRUE(SetEphemeralCookie(GURL("https://c.com/"), "name=value"));
+  EXPECT_EQ(cookie_monster_->GetEphemeralCookieStoreCountForTesting(), 2u);
+
+  CookieDeletionInfo delete_info;
+  delete_info.ephemeral_storage_domain = "a.com";
+  cookie_monster_->DeleteAllMatchingInfoAsync(std::move(delete_info),
+                                              base::DoNothing());
+  EXPECT_EQ(cookie_monster_->GetEphemeralCookieStoreCountForTesting(), 1u);
+  EXPECT_TRUE(GetEphemeralCookies(GURL("https://a.com/")).empty());
+  EXPECT_EQ(GetEphemeralCookies(GURL("https://c.com/")).size(), 1u);
+}
+
+}  // namespace net
@@ -34,6 +34,15 @@ CookieMonster::CookieMonster(scoped_refptr<PersistentCookieStore> store,
 
 CookieMonster::~CookieMonster() {}
 
+ChromiumCookieMonster* CookieMonster::GetEphemeralCookieStoreForTopFrameURL(
+    const GURL& top_frame_url) {
+  auto it =
+      ephemeral_cookie_stores_.find(URLToEphemeralStorageDomain(top_frame_url));
+  if (it == ephemeral_cookie_stores_.end())
+    return nullptr;
+  return it->second.get();
+}
+
 ChromiumCookieMonster*
 CookieMonster::GetOrCreateEphemeralCookieStoreForTopFrameURL(
     const GURL& top_frame_url) {
@@ -144,8 +153,14 @@ void CookieMonster::GetCookieListWithOptionsAsync(
       return;
     }
     ChromiumCookieMonster* ephemeral_monster =
-        GetOrCreateEphemeralCookieStoreForTopFrameURL(
+        GetEphemeralCookieStoreForTopFrameURL(
             options.top_frame_origin()->GetURL());
+    if (!ephemeral_monster) {
+      // No cookies were set in this ephemeral storage domain yet.
+      MaybeRunCookieCallback(std::move(callback), CookieAccessResultList(),
+                             CookieAccessResultList());
+      return;
+    }
     ephemeral_monster->GetCookieListWithOptionsAsync(
         url, options, cookie_partition_key_collection, std::move(callback));
     return;
@@ -53,10 +53,19 @@ class NET_EXPORT CookieMonster : public ChromiumCookieMonster {
       const CookiePartitionKeyCollection& cookie_partition_key_collection,
       GetCookieListCallback callback) override;
 
+  size_t GetEphemeralCookieStoreCountForTesting() const {
+    return ephemeral_cookie_stores_.size();
+  }
+
  private:
   NetLogWithSource net_log_;
+  // Ephemeral cookie stores keyed by ephemeral storage domain. A store is only
+  // created once a cookie is set for its domain, so sites which are merely
+  // embedded as third parties do not each get a cookie store.
   std::map<std::string, std::unique_ptr<ChromiumCookieMonster>>
       ephemeral_cookie_stores_;
+  ChromiumCookieMonster* GetEphemeralCookieStoreForTopFrameURL(
+      const GURL& top_frame_url);
   ChromiumCookieMonster* GetOrCreateEphemeralCookieStoreForTopFrameURL(
       const GURL& top_frame_url);
 };
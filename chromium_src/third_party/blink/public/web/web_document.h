@@ -6,11 +6,18 @@
 #ifndef BRAVE_CHROMIUM_SRC_THIRD_PARTY_BLINK_PUBLIC_WEB_WEB_DOCUMENT_H_
 #define BRAVE_CHROMIUM_SRC_THIRD_PARTY_BLINK_PUBLIC_WEB_WEB_DOCUMENT_H_
 
+#include "base/callback.h"
+#include "third_party/blink/public/platform/web_string.h"
+#include "third_party/blink/public/platform/web_vector.h"
 #include "third_party/blink/renderer/core/permissions_policy/dom_feature_policy.h"
 
-#define IsPluginDocument                                    \
-  IsDOMFeaturePolicyEnabled(v8::Local<v8::Context> context, \
-                            const String& feature);         \
+#define IsPluginDocument                                                 \
+  IsDOMFeaturePolicyEnabled(v8::Local<v8::Context> context,              \
+                            const String& feature);                      \
+  /* Reports class names and ids used in the document, each once. */     \
+  void StartClassIdCollection(                                           \
+      base::RepeatingCallback<void(WebVector<WebString> classes,         \
+                                   WebVector<WebString> ids)> callback); \
   bool IsPluginDocument
 
 #include "src/third_party/blink/public/web/web_document.h"
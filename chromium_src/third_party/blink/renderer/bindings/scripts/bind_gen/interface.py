@@ -138,12 +138,17 @@ def _bind_page_graph_local_vars(code_node, cg_context):
     if not _should_track_in_page_graph(cg_context):
         return
 
+    # The capture profile is checked before any argument is converted, so a
+    # profile without WebAPI calls only costs a branch per call.
     page_graph_enabled_node = SymbolNode(
         "page_graph_enabled",
         ("const bool ${page_graph_enabled} = "
-         "CoreProbeSink::HasAgentsGlobal(CoreProbeSink::kPageGraph);"))
+         "CoreProbeSink::HasAgentsGlobal(CoreProbeSink::kPageGraph) && "
+         "brave_page_graph::IsCaptureCategoryEnabled("
+         "brave_page_graph::CaptureCategory::kWebAPICalls);"))
     page_graph_enabled_node.accumulate(
         CodeGenAccumulator.require_include_headers([
+            "brave/third_party/blink/renderer/core/brave_page_graph/capture_profile.h",
             "third_party/blink/renderer/core/probe/core_probes.h",
         ]))
     code_node.register_code_symbol(page_graph_enabled_node)
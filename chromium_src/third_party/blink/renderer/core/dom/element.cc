@@ -0,0 +1,24 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "third_party/blink/renderer/core/dom/element.h"
+
+#include "brave/third_party/blink/renderer/core/cosmetic_filters/class_id_collector.h"
+#include "third_party/blink/renderer/core/css/style_engine.h"
+
+// Class and id changes are reported to the style engine for every element,
+// whether set by the parser, by script or by cloning.
+#define ClassChangedForElement(...)    \
+  ClassChangedForElement(__VA_ARGS__); \
+  ClassIdCollector::DidChangeClass(*this)
+
+#define IdChangedForElement(...)    \
+  IdChangedForElement(__VA_ARGS__); \
+  ClassIdCollector::DidChangeId(*this)
+
+#include "src/third_party/blink/renderer/core/dom/element.cc"
+
+#undef IdChangedForElement
+#undef ClassChangedForElement
@@ -5,6 +5,8 @@
 
 #include "src/third_party/blink/renderer/core/exported/web_document.cc"
 
+#include "brave/third_party/blink/renderer/core/cosmetic_filters/class_id_collector.h"
+
 namespace blink {
 
 bool WebDocument::IsDOMFeaturePolicyEnabled(v8::Local<v8::Context> context,
@@ -14,4 +16,10 @@ bool WebDocument::IsDOMFeaturePolicyEnabled(v8::Local<v8::Context> context,
   return document->featurePolicy()->allowsFeature(script_state, feature);
 }
 
+void WebDocument::StartClassIdCollection(
+    base::RepeatingCallback<void(WebVector<WebString> classes,
+                                 WebVector<WebString> ids)> callback) {
+  ClassIdCollector::Start(*Unwrap<Document>(), std::move(callback));
+}
+
 }  // namespace blink
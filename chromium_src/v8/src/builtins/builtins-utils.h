@@ -42,7 +42,8 @@ static_assert(false, "BUILTIN macro is expected to be defined");
     BuiltinArguments args(args_length, args_object);                        \
     Object result = Builtin_Impl_##name(args, isolate);                     \
     if (V8_UNLIKELY(IsBuiltinTrackedInPageGraph(#name)) &&                  \
-        V8_UNLIKELY(isolate->page_graph_delegate())) {                      \
+        V8_UNLIKELY(isolate->page_graph_delegate()) &&                      \
+        isolate->page_graph_delegate()->IsBuiltinCallTrackingEnabled()) {   \
       ReportBuiltinCallAndResponse(isolate, #name, args, result);           \
     }                                                                       \
     return BUILTIN_CONVERT_RESULT(result);                                  \
@@ -22,6 +22,12 @@ typedef struct C_Engine C_Engine;
  */
 typedef struct C_FilterListMetadata C_FilterListMetadata;
 
+/**
+ * Scriptlet and redirect resources which have been parsed once so that they can
+ * be used by several engines.
+ */
+typedef struct C_Resources C_Resources;
+
 /**
  * An external callback that receives a hostname and two out-parameters for
  * start and end position. The callback should fill the start and end positions
@@ -123,6 +129,24 @@ bool engine_add_resource(struct C_Engine* engine,
  */
 void engine_add_resources(struct C_Engine* engine, const char* resources);
 
+/**
+ * Create new `Resources`, interpreting `resources` as a null-terminated C
+ * string holding a JSON array of resources.
+ */
+struct C_Resources* resources_create(const char* resources);
+
+/**
+ * Destroy `Resources` once you are done with them.
+ */
+void resources_destroy(struct C_Resources* resources);
+
+/**
+ * Uses previously parsed `resources` for the engine, replacing any resources
+ * added before.
+ */
+void engine_use_resources(struct C_Engine* engine,
+                          const struct C_Resources* resources);
+
 /**
  * Removes a tag to the engine for consideration
  */
@@ -135,6 +159,19 @@ bool engine_deserialize(struct C_Engine* engine,
                         const char* data,
                         size_t data_size);
 
+/**
+ * Serializes the engine into a data file which can be loaded with
+ * `engine_deserialize`. Puts a pointer to the data into `data` and its size
+ * into `data_size`. Returns `true` on success. The data must be destroyed with
+ * `engine_serialized_data_destroy`.
+ */
+bool engine_serialize(struct C_Engine* engine, char** data, size_t* data_size);
+
+/**
+ * Destroy data returned by `engine_serialize` once you are done with it.
+ */
+void engine_serialized_data_destroy(char* data, size_t data_size);
+
 /**
  * Destroy a `Engine` once you are done with it.
  */
@@ -241,6 +241,42 @@ pub unsafe extern "C" fn engine_add_resources(engine: *mut Engine, resources: *c
     engine.use_resources(&resources);
 }
 
+/// Scriptlet and redirect resources which have been parsed once so that they can be used by
+/// several engines.
+pub struct Resources(Vec<Resource>);
+
+/// Create new `Resources`, interpreting `resources` as a null-terminated C string holding a JSON
+/// array of resources.
+#[no_mangle]
+pub unsafe extern "C" fn resources_create(resources: *const c_char) -> *mut Resources {
+    let resources = CStr::from_ptr(resources).to_str().unwrap_or_else(|_| {
+        eprintln!("Failed to parse adblock resources with invalid UTF-8 content");
+        "[]"
+    });
+    let resources: Vec<Resource> = serde_json::from_str(resources).unwrap_or_else(|e| {
+        eprintln!("Failed to parse JSON adblock resources: {}", e);
+        vec![]
+    });
+    Box::into_raw(Box::new(Resources(resources)))
+}
+
+/// Destroy `Resources` once you are done with them.
+#[no_mangle]
+pub unsafe extern "C" fn resources_destroy(resources: *mut Resources) {
+    if !resources.is_null() {
+        drop(Box::from_raw(resources));
+    }
+}
+
+/// Uses previously parsed `resources` for the engine, replacing any resources added before.
+#[no_mangle]
+pub unsafe extern "C" fn engine_use_resources(engine: *mut Engine, resources: *const Resources) {
+    assert!(!engine.is_null());
+    assert!(!resources.is_null());
+    let engine = Box::leak(Box::from_raw(engine));
+    engine.use_resources(&(*resources).0);
+}
+
 /// Removes a tag to the engine for consideration
 #[no_mangle]
 pub unsafe extern "C" fn engine_remove_tag(engine: *mut Engine, tag: *const c_char) {
@@ -267,6 +303,39 @@ pub unsafe extern "C" fn engine_deserialize(
     ok
 }
 
+/// Serializes the engine into a data file which can be loaded with `engine_deserialize`. Puts a
+/// pointer to the data into `data` and its size into `data_size`. Returns `true` on success. The
+/// data must be destroyed with `engine_serialized_data_destroy`.
+#[no_mangle]
+pub unsafe extern "C" fn engine_serialize(
+    engine: *mut Engine,
+    data: *mut *mut c_char,
+    data_size: *mut size_t,
+) -> bool {
+    assert!(!engine.is_null());
+    let engine = Box::leak(Box::from_raw(engine));
+    match engine.serialize_raw() {
+        Ok(serialized) => {
+            let serialized = serialized.into_boxed_slice();
+            *data_size = serialized.len();
+            *data = Box::into_raw(serialized) as *mut u8 as *mut c_char;
+            true
+        }
+        Err(_) => {
+            eprintln!("Error serializing adblock engine");
+            false
+        }
+    }
+}
+
+/// Destroy data returned by `engine_serialize` once you are done with it.
+#[no_mangle]
+pub unsafe extern "C" fn engine_serialized_data_destroy(data: *mut c_char, data_size: size_t) {
+    if !data.is_null() {
+        drop(Box::from_raw(std::slice::from_raw_parts_mut(data as *mut u8, data_size)));
+    }
+}
+
 /// Destroy a `Engine` once you are done with it.
 #[no_mangle]
 pub unsafe extern "C" fn engine_destroy(engine: *mut Engine) {
@@ -68,6 +68,13 @@ engineFromBufferWithMetadata(const char* data, size_t data_size) {
   return std::make_pair(std::move(metadata), std::move(engine));
 }
 
+Resources::Resources(const std::string& resources_json)
+    : raw(resources_create(resources_json.c_str())) {}
+
+Resources::~Resources() {
+  resources_destroy(raw);
+}
+
 Engine::Engine(C_Engine* c_engine) : raw(c_engine) {}
 
 Engine::Engine() : raw(engine_create("")) {}
@@ -116,6 +123,17 @@ bool Engine::deserialize(const char* data, size_t data_size) {
   return engine_deserialize(raw, data, data_size);
 }
 
+std::vector<unsigned char> Engine::serialize() {
+  char* data = nullptr;
+  size_t data_size = 0;
+  if (!engine_serialize(raw, &data, &data_size)) {
+    return std::vector<unsigned char>();
+  }
+  std::vector<unsigned char> result(data, data + data_size);
+  engine_serialized_data_destroy(data, data_size);
+  return result;
+}
+
 void Engine::addTag(const std::string& tag) {
   engine_add_tag(raw, tag.c_str());
 }
@@ -138,6 +156,10 @@ void Engine::addResources(const std::string& resources) {
   engine_add_resources(raw, resources.c_str());
 }
 
+void Engine::useResources(const Resources& resources) {
+  engine_use_resources(raw, resources.raw);
+}
+
 const std::string Engine::urlCosmeticResources(const std::string& url) {
   char* resources_raw = engine_url_cosmetic_resources(raw, url.c_str());
   const std::string resources_json = std::string(resources_raw);
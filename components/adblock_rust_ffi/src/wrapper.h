@@ -38,6 +38,10 @@ extern "C" {
 
 namespace adblock {
 
+// Version of the adblock crate in Cargo.toml. Data files produced by
+// |Engine::serialize| can only be loaded by the same version.
+constexpr char kAdBlockRustVersion[] = "0.5.8";
+
 typedef C_DomainResolverCallback DomainResolverCallback;
 
 bool ADBLOCK_EXPORT SetDomainResolver(DomainResolverCallback resolver);
@@ -60,6 +64,21 @@ typedef ADBLOCK_EXPORT struct FilterListMetadata {
   FilterListMetadata(const FilterListMetadata&) = delete;
 } FilterListMetadata;
 
+// Scriptlet and redirect resources parsed once, which can then be used by any
+// number of engines.
+class ADBLOCK_EXPORT Resources {
+ public:
+  explicit Resources(const std::string& resources_json);
+  ~Resources();
+
+ private:
+  friend class Engine;
+
+  Resources(const Resources&) = delete;
+  void operator=(const Resources&) = delete;
+  raw_ptr<C_Resources> raw = nullptr;
+};
+
 class ADBLOCK_EXPORT Engine {
  public:
   Engine();
@@ -81,11 +100,14 @@ class ADBLOCK_EXPORT Engine {
                                bool is_third_party,
                                const std::string& resource_type);
   bool deserialize(const char* data, size_t data_size);
+  // Returns an empty buffer if the engine could not be serialized.
+  std::vector<unsigned char> serialize();
   void addTag(const std::string& tag);
   void addResource(const std::string& key,
                    const std::string& content_type,
                    const std::string& data);
   void addResources(const std::string& resources);
+  void useResources(const Resources& resources);
   void removeTag(const std::string& tag);
   bool tagExists(const std::string& tag);
   const std::string urlCosmeticResources(const std::string& url);
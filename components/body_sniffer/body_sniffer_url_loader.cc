@@ -5,6 +5,7 @@
 
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "base/bind.h"
@@ -183,6 +184,72 @@ bool BodySnifferURLLoader::CheckBufferedBody(uint32_t readBufferSize) {
   return false;
 }
 
+BodySnifferURLLoader::SniffAction BodySnifferURLLoader::SniffBody(
+    base::StringPiece chunk) {
+  return SniffAction::kBuffer;
+}
+
+bool BodySnifferURLLoader::ReadAndSniffBody(uint32_t max_bytes_to_read) {
+  const void* buffer = nullptr;
+  uint32_t buffer_size = 0;
+  auto result = body_consumer_handle_->BeginReadData(
+      &buffer, &buffer_size, MOJO_BEGIN_READ_DATA_FLAG_NONE);
+  switch (result) {
+    case MOJO_RESULT_OK:
+      break;
+    case MOJO_RESULT_FAILED_PRECONDITION:
+      CompleteLoading(std::move(buffered_body_));
+      return false;
+    case MOJO_RESULT_SHOULD_WAIT:
+      body_consumer_watcher_.ArmOrNotify();
+      return false;
+    default:
+      NOTREACHED();
+      return false;
+  }
+
+  buffer_size = std::min(buffer_size, max_bytes_to_read);
+  const base::StringPiece chunk(static_cast<const char*>(buffer), buffer_size);
+  if (SniffBody(chunk) == SniffAction::kPassThrough) {
+    // Leave the chunk in the pipe, it will be forwarded as is.
+    body_consumer_handle_->EndReadData(0);
+    StartPassThrough();
+    return false;
+  }
+
+  buffered_body_.append(chunk.data(), chunk.size());
+  body_consumer_handle_->EndReadData(buffer_size);
+  read_bytes_ += buffer_size;
+  return true;
+}
+
+void BodySnifferURLLoader::OnBodyReadable(MojoResult) {
+  DCHECK_EQ(State::kSending, state_);
+  DCHECK(pass_through_);
+  // The pipe becoming readable when kSending means all buffered body has
+  // already been sent.
+  ForwardBodyToClient();
+}
+
+void BodySnifferURLLoader::OnBodyWritable(MojoResult) {
+  DCHECK_EQ(State::kSending, state_);
+  if (bytes_remaining_in_buffer_ > 0) {
+    SendBufferedBodyToClient();
+  } else if (pass_through_) {
+    // Buffered part is out, no need to keep it around.
+    std::string().swap(buffered_body_);
+    ForwardBodyToClient();
+  } else {
+    CompleteSending();
+  }
+}
+
+void BodySnifferURLLoader::StartPassThrough() {
+  DCHECK_EQ(State::kLoading, state_);
+  pass_through_ = true;
+  BodySnifferURLLoader::CompleteLoading(std::move(buffered_body_));
+}
+
 void BodySnifferURLLoader::CompleteLoading(std::string body) {
   read_bytes_ = 0;
   DCHECK_EQ(State::kLoading, state_);
@@ -208,6 +275,12 @@ void BodySnifferURLLoader::CompleteLoading(std::string body) {
     return;
   }
 
+  if (pass_through_) {
+    // Nothing was buffered, the whole body is still in the source pipe.
+    ForwardBodyToClient();
+    return;
+  }
+
   CompleteSending();
 }
 
@@ -260,6 +333,52 @@ void BodySnifferURLLoader::SendBufferedBodyToClient() {
   body_producer_watcher_.ArmOrNotify();
 }
 
+// No buffered data to be sent, read and forward data to producer
+void BodySnifferURLLoader::ForwardBodyToClient() {
+  DCHECK_EQ(0u, bytes_remaining_in_buffer_);
+  // Send the body from the consumer to the producer.
+  const void* buffer;
+  uint32_t buffer_size = 0;
+  MojoResult result = body_consumer_handle_->BeginReadData(
+      &buffer, &buffer_size, MOJO_BEGIN_READ_DATA_FLAG_NONE);
+  switch (result) {
+    case MOJO_RESULT_OK:
+      break;
+    case MOJO_RESULT_SHOULD_WAIT:
+      body_consumer_watcher_.ArmOrNotify();
+      return;
+    case MOJO_RESULT_FAILED_PRECONDITION:
+      // All data has been sent.
+      CompleteSending();
+      return;
+    default:
+      NOTREACHED();
+      return;
+  }
+
+  result = body_producer_handle_->WriteData(buffer, &buffer_size,
+                                            MOJO_WRITE_DATA_FLAG_NONE);
+  switch (result) {
+    case MOJO_RESULT_OK:
+      break;
+    case MOJO_RESULT_FAILED_PRECONDITION:
+      // The pipe is closed unexpectedly. |this| should be deleted once
+      // URLLoader on the destination is released.
+      Abort();
+      return;
+    case MOJO_RESULT_SHOULD_WAIT:
+      body_consumer_handle_->EndReadData(0);
+      body_producer_watcher_.ArmOrNotify();
+      return;
+    default:
+      NOTREACHED();
+      return;
+  }
+
+  body_consumer_handle_->EndReadData(buffer_size);
+  body_consumer_watcher_.ArmOrNotify();
+}
+
 void BodySnifferURLLoader::Abort() {
   VLOG(2) << __func__ << " " << response_url_;
   state_ = State::kAborted;
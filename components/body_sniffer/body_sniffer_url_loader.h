@@ -11,6 +11,7 @@
 
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/strings/string_piece.h"
 #include "base/task/sequenced_task_runner.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
@@ -95,14 +96,37 @@ class BodySnifferURLLoader : public network::mojom::URLLoaderClient,
 
   bool CheckBufferedBody(uint32_t readBufferSize);
 
-  virtual void OnBodyReadable(MojoResult) = 0;
-  virtual void OnBodyWritable(MojoResult) = 0;
+  enum class SniffAction {
+    // Append the chunk to |buffered_body_| and keep sniffing.
+    kBuffer,
+    // Not interested in this body. The chunk stays in the source pipe and the
+    // rest of the body is passed through to the client without buffering.
+    kPassThrough,
+  };
+
+  // Called by ReadAndSniffBody() with a window into the source pipe, before
+  // the data is copied anywhere.
+  virtual SniffAction SniffBody(base::StringPiece chunk);
+
+  // Like CheckBufferedBody(), but lets SniffBody() look at the data in place
+  // first. Returns true only if the chunk has been buffered.
+  bool ReadAndSniffBody(uint32_t max_bytes_to_read);
+
+  // Only called in kSending. The default implementations pump the body in
+  // pass-through mode or finish sending |buffered_body_|.
+  virtual void OnBodyReadable(MojoResult);
+  virtual void OnBodyWritable(MojoResult);
 
   virtual void CompleteLoading(std::string body);
   void CompleteSending();
   virtual void OnCompleteSending();
   void SendBufferedBodyToClient();
 
+  // Sends whatever has been buffered so far and then forwards the remaining
+  // body straight from the source pipe to the destination pipe.
+  void StartPassThrough();
+  void ForwardBodyToClient();
+
   void Abort();
 
   base::WeakPtr<BodySnifferThrottle> throttle_;
@@ -123,6 +147,7 @@ class BodySnifferURLLoader : public network::mojom::URLLoaderClient,
   std::string buffered_body_;
   size_t bytes_remaining_in_buffer_;
   size_t read_bytes_ = 0;
+  bool pass_through_ = false;
 
   mojo::ScopedDataPipeConsumerHandle body_consumer_handle_;
   mojo::ScopedDataPipeProducerHandle body_producer_handle_;
@@ -0,0 +1,24 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/browser/ads_pref_mirror_util.h"
+
+#include "base/strings/string_util.h"
+#include "brave/components/brave_rewards/common/pref_names.h"
+
+namespace brave_ads {
+
+namespace {
+
+constexpr char kAdsPrefPathPrefix[] = "brave.brave_ads.";
+
+}  // namespace
+
+bool ShouldMirrorPref(const std::string& path) {
+  return base::StartsWith(path, kAdsPrefPathPrefix) ||
+         path == brave_rewards::prefs::kUseRewardsStagingServer;
+}
+
+}  // namespace brave_ads
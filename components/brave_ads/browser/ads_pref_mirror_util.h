@@ -0,0 +1,19 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_ADS_PREF_MIRROR_UTIL_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_ADS_PREF_MIRROR_UTIL_H_
+
+#include <string>
+
+namespace brave_ads {
+
+// Returns |true| if the ads process keeps a mirror of the pref for |path|. Any
+// other pref is read from the browser using a sync call.
+bool ShouldMirrorPref(const std::string& path);
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_BROWSER_ADS_PREF_MIRROR_UTIL_H_
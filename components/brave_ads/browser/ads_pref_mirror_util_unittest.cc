@@ -0,0 +1,33 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/browser/ads_pref_mirror_util.h"
+
+#include "bat/ads/pref_names.h"
+#include "brave/components/brave_rewards/common/pref_names.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=AdsPrefMirrorUtilTest.*
+
+namespace brave_ads {
+
+TEST(AdsPrefMirrorUtilTest, MirrorsAdsPrefs) {
+  EXPECT_TRUE(ShouldMirrorPref(ads::prefs::kEnabled));
+  EXPECT_TRUE(ShouldMirrorPref(ads::prefs::kMaximumNotificationAdsPerHour));
+}
+
+TEST(AdsPrefMirrorUtilTest, MirrorsRewardsStagingServerPref) {
+  EXPECT_TRUE(ShouldMirrorPref(brave_rewards::prefs::kUseRewardsStagingServer));
+}
+
+TEST(AdsPrefMirrorUtilTest, DoesNotMirrorOtherPrefs) {
+  EXPECT_FALSE(ShouldMirrorPref(brave_rewards::prefs::kEnabled));
+  EXPECT_FALSE(ShouldMirrorPref("brave.brave_ads"));
+  EXPECT_FALSE(ShouldMirrorPref("brave.brave_adsfoo"));
+  EXPECT_FALSE(ShouldMirrorPref("Brave.brave_ads.enabled"));
+  EXPECT_FALSE(ShouldMirrorPref(""));
+}
+
+}  // namespace brave_ads
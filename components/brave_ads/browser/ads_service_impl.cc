@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/auto_reset.h"
 #include "base/base64.h"
 #include "base/bind.h"
 #include "base/callback_helpers.h"
@@ -45,6 +46,7 @@
 #include "brave/browser/profiles/profile_util.h"
 #include "brave/common/brave_channel_info.h"
 #include "brave/components/brave_ads/browser/ads_p2a.h"
+#include "brave/components/brave_ads/browser/ads_pref_mirror_util.h"
 #include "brave/components/brave_ads/browser/ads_storage_cleanup.h"
 #include "brave/components/brave_ads/browser/component_updater/resource_component.h"
 #include "brave/components/brave_ads/browser/device_id.h"
@@ -123,6 +125,39 @@ constexpr char kNotificationAdUrlPrefix[] = "https://www.brave.com/ads/?";
 
 const base::Feature kServing{"AdServing", base::FEATURE_ENABLED_BY_DEFAULT};
 
+std::vector<std::string> GetMirroredPrefPaths(PrefService* prefs) {
+  DCHECK(prefs);
+
+  std::vector<std::string> paths;
+  prefs->IteratePreferenceValues(base::BindRepeating(
+      [](std::vector<std::string>* paths, const std::string& path,
+         const base::Value& value) {
+        if (ShouldMirrorPref(path)) {
+          paths->push_back(path);
+        }
+      },
+      &paths));
+  return paths;
+}
+
+bat_ads::mojom::BatAdsPrefInfoPtr BuildBatAdsPrefInfo(
+    PrefService* prefs,
+    const std::string& path) {
+  DCHECK(prefs);
+
+  if (!ShouldMirrorPref(path) || !prefs->FindPreference(path)) {
+    return nullptr;
+  }
+
+  auto pref = bat_ads::mojom::BatAdsPrefInfo::New();
+  pref->value = prefs->GetValue(path).Clone();
+  if (const base::Value* default_value = prefs->GetDefaultPrefValue(path)) {
+    pref->default_value = default_value->Clone();
+  }
+  pref->has_pref_path = prefs->HasPrefPath(path);
+  return pref;
+}
+
 int GetDataResourceId(const std::string& name) {
   if (name == ads::data::resource::kCatalogJsonSchemaFilename) {
     return IDR_ADS_CATALOG_SCHEMA;
@@ -466,6 +501,13 @@ void AdsServiceImpl::InitializePrefChangeRegistrar() {
       brave_news::prefs::kNewTabPageShowToday,
       base::BindRepeating(&AdsServiceImpl::OnNewTabPageShowTodayPrefChanged,
                           base::Unretained(this)));
+
+  mirrored_pref_change_registrar_.Init(profile_->GetPrefs());
+  for (const auto& path : GetMirroredPrefPaths(profile_->GetPrefs())) {
+    mirrored_pref_change_registrar_.Add(
+        path, base::BindRepeating(&AdsServiceImpl::OnMirroredPrefChanged,
+                                  base::Unretained(this)));
+  }
 }
 
 void AdsServiceImpl::SetSysInfo() {
@@ -637,8 +679,19 @@ void AdsServiceImpl::CreateBatAdsService(const uint32_t number_of_start) {
 
   bat_ads_service_->Create(
       bat_ads_client_.BindNewEndpointAndPassRemote(),
-      bat_ads_.BindNewEndpointAndPassReceiver(),
+      bat_ads_.BindNewEndpointAndPassReceiver(), GetBatAdsClientState(),
       base::BindOnce(&AdsServiceImpl::OnCreateBatAdsService, AsWeakPtr()));
+
+  // The new ads instance rebuilds the ad events of this profile from its
+  // database, so drop the ones recorded by the previous instance.
+  FrequencyCappingHelper* frequency_capping_helper =
+      FrequencyCappingHelper::GetInstance();
+  if (!ad_event_history_id_.empty()) {
+    frequency_capping_helper->ResetAdEventHistoryForId(ad_event_history_id_);
+    ad_event_history_id_.clear();
+  }
+  frequency_capping_helper->ReplayAdEventHistory(this);
+  frequency_capping_helper->AddObserver(this);
 }
 
 void AdsServiceImpl::OnCreateBatAdsService() {
@@ -767,8 +820,32 @@ void AdsServiceImpl::OnNewTabPageShowTodayPrefChanged() {
 
 void AdsServiceImpl::NotifyPrefChanged(const std::string& path) {
   if (IsBatAdsBound()) {
-    bat_ads_->OnPrefDidChange(path);
+    bat_ads_->OnPrefDidChange(path,
+                              BuildBatAdsPrefInfo(profile_->GetPrefs(), path));
+  }
+}
+
+bat_ads::mojom::BatAdsClientStatePtr AdsServiceImpl::GetBatAdsClientState()
+    const {
+  auto state = bat_ads::mojom::BatAdsClientState::New();
+
+  PrefService* prefs = profile_->GetPrefs();
+  for (const auto& path : GetMirroredPrefPaths(prefs)) {
+    state->prefs[path] = BuildBatAdsPrefInfo(prefs, path);
+  }
+
+  state->is_browser_active = IsBrowserActive();
+
+  return state;
+}
+
+void AdsServiceImpl::OnMirroredPrefChanged(const std::string& path) {
+  // Prefs set by the ads library are notified from the setters.
+  if (is_setting_pref_) {
+    return;
   }
+
+  NotifyPrefChanged(path);
 }
 
 void AdsServiceImpl::StartCheckIdleStateTimer() {
@@ -987,6 +1064,8 @@ void AdsServiceImpl::Shutdown() {
 
   BackgroundHelper::GetInstance()->RemoveObserver(this);
 
+  FrequencyCappingHelper::GetInstance()->RemoveObserver(this);
+
   g_brave_browser_process->resource_component()->RemoveObserver(this);
 
   CloseAllNotificationAds();
@@ -1512,20 +1591,17 @@ void AdsServiceImpl::UpdateAdRewards() {
 void AdsServiceImpl::RecordAdEventForId(const std::string& id,
                                         const std::string& ad_type,
                                         const std::string& confirmation_type,
-                                        const base::Time time) const {
+                                        const base::Time time) {
+  ad_event_history_id_ = id;
+
   FrequencyCappingHelper::GetInstance()->RecordAdEventForId(
       id, ad_type, confirmation_type, time);
 }
 
-std::vector<base::Time> AdsServiceImpl::GetAdEventHistory(
-    const std::string& ad_type,
-    const std::string& confirmation_type) const {
-  return FrequencyCappingHelper::GetInstance()->GetAdEventHistory(
-      ad_type, confirmation_type);
-}
+void AdsServiceImpl::ResetAdEventHistoryForId(const std::string& id) {
+  ad_event_history_id_ = id;
 
-void AdsServiceImpl::ResetAdEventHistoryForId(const std::string& id) const {
-  return FrequencyCappingHelper::GetInstance()->ResetAdEventHistoryForId(id);
+  FrequencyCappingHelper::GetInstance()->ResetAdEventHistoryForId(id);
 }
 
 void AdsServiceImpl::GetBrowsingHistory(
@@ -1723,6 +1799,7 @@ bool AdsServiceImpl::GetBooleanPref(const std::string& path) const {
 }
 
 void AdsServiceImpl::SetBooleanPref(const std::string& path, const bool value) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->SetBoolean(path, value);
   NotifyPrefChanged(path);
 }
@@ -1732,6 +1809,7 @@ int AdsServiceImpl::GetIntegerPref(const std::string& path) const {
 }
 
 void AdsServiceImpl::SetIntegerPref(const std::string& path, const int value) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->SetInteger(path, value);
   NotifyPrefChanged(path);
 }
@@ -1742,6 +1820,7 @@ double AdsServiceImpl::GetDoublePref(const std::string& path) const {
 
 void AdsServiceImpl::SetDoublePref(const std::string& path,
                                    const double value) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->SetDouble(path, value);
   NotifyPrefChanged(path);
 }
@@ -1752,6 +1831,7 @@ std::string AdsServiceImpl::GetStringPref(const std::string& path) const {
 
 void AdsServiceImpl::SetStringPref(const std::string& path,
                                    const std::string& value) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->SetString(path, value);
   NotifyPrefChanged(path);
 }
@@ -1767,6 +1847,7 @@ int64_t AdsServiceImpl::GetInt64Pref(const std::string& path) const {
 
 void AdsServiceImpl::SetInt64Pref(const std::string& path,
                                   const int64_t value) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->SetInt64(path, value);
   NotifyPrefChanged(path);
 }
@@ -1782,6 +1863,7 @@ uint64_t AdsServiceImpl::GetUint64Pref(const std::string& path) const {
 
 void AdsServiceImpl::SetUint64Pref(const std::string& path,
                                    const uint64_t value) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->SetUint64(path, value);
   NotifyPrefChanged(path);
 }
@@ -1792,6 +1874,7 @@ base::Time AdsServiceImpl::GetTimePref(const std::string& path) const {
 
 void AdsServiceImpl::SetTimePref(const std::string& path,
                                  const base::Time value) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->SetTime(path, value);
   NotifyPrefChanged(path);
 }
@@ -1803,6 +1886,7 @@ absl::optional<base::Value::Dict> AdsServiceImpl::GetDictPref(
 
 void AdsServiceImpl::SetDictPref(const std::string& path,
                                  base::Value::Dict value) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->SetDict(path, std::move(value));
   NotifyPrefChanged(path);
 }
@@ -1814,11 +1898,13 @@ absl::optional<base::Value::List> AdsServiceImpl::GetListPref(
 
 void AdsServiceImpl::SetListPref(const std::string& path,
                                  base::Value::List value) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->SetList(path, std::move(value));
   NotifyPrefChanged(path);
 }
 
 void AdsServiceImpl::ClearPref(const std::string& path) {
+  const base::AutoReset<bool> setting_pref(&is_setting_pref_, true);
   profile_->GetPrefs()->ClearPref(path);
   NotifyPrefChanged(path);
 }
@@ -1855,6 +1941,26 @@ void AdsServiceImpl::OnBrowserDidEnterBackground() {
   bat_ads_->OnBrowserDidEnterBackground();
 }
 
+void AdsServiceImpl::OnDidRecordAdEventForId(
+    const std::string& id,
+    const std::string& ad_type,
+    const std::string& confirmation_type,
+    const base::Time time) {
+  if (!IsBatAdsBound()) {
+    return;
+  }
+
+  bat_ads_->OnDidRecordAdEventForId(id, ad_type, confirmation_type, time);
+}
+
+void AdsServiceImpl::OnDidResetAdEventHistoryForId(const std::string& id) {
+  if (!IsBatAdsBound()) {
+    return;
+  }
+
+  bat_ads_->OnDidResetAdEventHistoryForId(id);
+}
+
 void AdsServiceImpl::OnDidUpdateResourceComponent(const std::string& id) {
   if (!IsBatAdsBound()) {
     return;
@@ -26,6 +26,7 @@
 #include "brave/components/brave_adaptive_captcha/buildflags/buildflags.h"  // IWYU pragma: keep
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/component_updater/resource_component_observer.h"
+#include "brave/components/brave_ads/browser/frequency_capping_helper.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
 #include "brave/vendor/bat-native-ledger/include/bat/ledger/public/interfaces/ledger.mojom-forward.h"
 #include "components/history/core/browser/history_service.h"  // IWYU pragma: keep
@@ -75,6 +76,7 @@ class DeviceId;
 class AdsServiceImpl : public AdsService,
                        public ads::AdsClient,
                        BackgroundHelper::Observer,
+                       public FrequencyCappingHelper::Observer,
                        public ResourceComponentObserver,
                        public brave_rewards::RewardsServiceObserver,
                        public base::SupportsWeakPtr<AdsServiceImpl> {
@@ -154,6 +156,11 @@ class AdsServiceImpl : public AdsService,
 
   void NotifyPrefChanged(const std::string& path);
 
+  // Snapshot of the browser state which is mirrored by the ads process so that
+  // reads do not block on the browser.
+  bat_ads::mojom::BatAdsClientStatePtr GetBatAdsClientState() const;
+  void OnMirroredPrefChanged(const std::string& path);
+
   bool ShouldShowOnboardingNotification();
   void MaybeShowOnboardingNotification();
 
@@ -333,13 +340,10 @@ class AdsServiceImpl : public AdsService,
   void UpdateAdRewards() override;
 
   void RecordAdEventForId(const std::string& id,
-                          const std::string& type,
+                          const std::string& ad_type,
                           const std::string& confirmation_type,
-                          base::Time time) const override;
-  std::vector<base::Time> GetAdEventHistory(
-      const std::string& ad_type,
-      const std::string& confirmation_type) const override;
-  void ResetAdEventHistoryForId(const std::string& id) const override;
+                          base::Time time) override;
+  void ResetAdEventHistoryForId(const std::string& id) override;
 
   void GetBrowsingHistory(int max_count,
                           int days_ago,
@@ -410,6 +414,13 @@ class AdsServiceImpl : public AdsService,
   void OnBrowserDidEnterForeground() override;
   void OnBrowserDidEnterBackground() override;
 
+  // FrequencyCappingHelper::Observer:
+  void OnDidRecordAdEventForId(const std::string& id,
+                               const std::string& ad_type,
+                               const std::string& confirmation_type,
+                               base::Time time) override;
+  void OnDidResetAdEventHistoryForId(const std::string& id) override;
+
   // ResourceComponentObserver:
   void OnDidUpdateResourceComponent(const std::string& id) override;
 
@@ -427,7 +438,12 @@ class AdsServiceImpl : public AdsService,
 
   base::Time last_bat_ads_service_restart_time_;
 
+  // Id of the ads instance of this profile in |FrequencyCappingHelper|.
+  std::string ad_event_history_id_;
+
   PrefChangeRegistrar pref_change_registrar_;
+  PrefChangeRegistrar mirrored_pref_change_registrar_;
+  bool is_setting_pref_ = false;
 
   ads::mojom::SysInfo sys_info_;
 
@@ -5,10 +5,19 @@
 
 #include "brave/components/brave_ads/browser/frequency_capping_helper.h"
 
-#include "base/time/time.h"
+#include <algorithm>
+
+#include "base/check.h"
 
 namespace brave_ads {
 
+namespace {
+
+// Matches the history kept by the ads instances.
+constexpr base::TimeDelta kHistoryTimeWindow = base::Days(1);
+
+}  // namespace
+
 FrequencyCappingHelper::FrequencyCappingHelper() = default;
 
 FrequencyCappingHelper::~FrequencyCappingHelper() = default;
@@ -17,22 +26,57 @@ FrequencyCappingHelper* FrequencyCappingHelper::GetInstance() {
   return base::Singleton<FrequencyCappingHelper>::get();
 }
 
+void FrequencyCappingHelper::AddObserver(Observer* observer) {
+  observers_.AddObserver(observer);
+}
+
+void FrequencyCappingHelper::RemoveObserver(Observer* observer) {
+  observers_.RemoveObserver(observer);
+}
+
 void FrequencyCappingHelper::RecordAdEventForId(
     const std::string& id,
     const std::string& ad_type,
     const std::string& confirmation_type,
     const base::Time time) {
-  history_.RecordForId(id, ad_type, confirmation_type, time);
-}
+  DCHECK(!id.empty());
+  DCHECK(!ad_type.empty());
+  DCHECK(!confirmation_type.empty());
 
-std::vector<base::Time> FrequencyCappingHelper::GetAdEventHistory(
-    const std::string& ad_type,
-    const std::string& confirmation_type) const {
-  return history_.Get(ad_type, confirmation_type);
+  std::vector<AdEvent>& history = history_[id];
+
+  const base::Time past = base::Time::Now() - kHistoryTimeWindow;
+  history.erase(std::remove_if(history.begin(), history.end(),
+                               [past](const AdEvent& ad_event) {
+                                 return ad_event.time < past;
+                               }),
+                history.end());
+
+  history.push_back({ad_type, confirmation_type, time});
+
+  for (Observer& observer : observers_) {
+    observer.OnDidRecordAdEventForId(id, ad_type, confirmation_type, time);
+  }
 }
 
 void FrequencyCappingHelper::ResetAdEventHistoryForId(const std::string& id) {
-  history_.ResetForId(id);
+  history_.erase(id);
+
+  for (Observer& observer : observers_) {
+    observer.OnDidResetAdEventHistoryForId(id);
+  }
+}
+
+void FrequencyCappingHelper::ReplayAdEventHistory(Observer* observer) const {
+  DCHECK(observer);
+
+  for (const auto& [id, history] : history_) {
+    for (const AdEvent& ad_event : history) {
+      observer->OnDidRecordAdEventForId(id, ad_event.ad_type,
+                                        ad_event.confirmation_type,
+                                        ad_event.time);
+    }
+  }
 }
 
 }  // namespace brave_ads
@@ -9,17 +9,29 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/singleton.h"
-#include "bat/ads/ad_event_history.h"
-
-namespace base {
-class Time;
-}  // namespace base
+#include "base/observer_list.h"
+#include "base/observer_list_types.h"
+#include "base/time/time.h"
 
 namespace brave_ads {
 
+// Browser wide history of the ad events recorded by the ads instances of all
+// profiles. Every ads instance keeps a copy of the history, which is kept up to
+// date through |Observer|, so that frequency caps apply across profiles without
+// asking the browser for each serving decision.
 class FrequencyCappingHelper {
  public:
+  class Observer : public base::CheckedObserver {
+   public:
+    virtual void OnDidRecordAdEventForId(const std::string& id,
+                                         const std::string& ad_type,
+                                         const std::string& confirmation_type,
+                                         base::Time time) {}
+    virtual void OnDidResetAdEventHistoryForId(const std::string& id) {}
+  };
+
   FrequencyCappingHelper(const FrequencyCappingHelper&) = delete;
   FrequencyCappingHelper& operator=(const FrequencyCappingHelper&) = delete;
 
@@ -29,25 +41,36 @@ class FrequencyCappingHelper {
 
   static FrequencyCappingHelper* GetInstance();
 
+  void AddObserver(Observer* observer);
+  void RemoveObserver(Observer* observer);
+
   void RecordAdEventForId(const std::string& id,
                           const std::string& ad_type,
                           const std::string& confirmation_type,
                           base::Time time);
 
-  std::vector<base::Time> GetAdEventHistory(
-      const std::string& ad_type,
-      const std::string& confirmation_type) const;
-
   void ResetAdEventHistoryForId(const std::string& id);
 
+  // Notifies |observer| of every ad event in the history, so that a new ads
+  // instance starts with the ad events of the other instances.
+  void ReplayAdEventHistory(Observer* observer) const;
+
  private:
   friend struct base::DefaultSingletonTraits<FrequencyCappingHelper>;
 
+  struct AdEvent {
+    std::string ad_type;
+    std::string confirmation_type;
+    base::Time time;
+  };
+
   FrequencyCappingHelper();
 
   ~FrequencyCappingHelper();
 
-  ads::AdEventHistory history_;
+  base::flat_map<std::string, std::vector<AdEvent>> history_;
+
+  base::ObserverList<Observer> observers_;
 };
 
 }  // namespace brave_ads
@@ -0,0 +1,117 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/browser/frequency_capping_helper.h"
+
+#include <string>
+#include <vector>
+
+#include "base/time/time.h"
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=FrequencyCappingHelperTest.*
+
+namespace brave_ads {
+
+namespace {
+
+constexpr char kId[] = "b8bd7e2b-4da5-4f5c-a1a6-3c0bd1b0b3b1";
+constexpr char kOtherId[] = "3519f52c-46a4-4c48-9c2b-c264c0067f04";
+
+// Stands in for the ads service of a profile and records what would be sent
+// to its ads instance.
+class TestObserver : public FrequencyCappingHelper::Observer {
+ public:
+  void OnDidRecordAdEventForId(const std::string& id,
+                               const std::string& ad_type,
+                               const std::string& confirmation_type,
+                               base::Time time) override {
+    recorded_ids_.push_back(id);
+  }
+
+  void OnDidResetAdEventHistoryForId(const std::string& id) override {
+    reset_ids_.push_back(id);
+  }
+
+  const std::vector<std::string>& recorded_ids() const { return recorded_ids_; }
+  const std::vector<std::string>& reset_ids() const { return reset_ids_; }
+
+ private:
+  std::vector<std::string> recorded_ids_;
+  std::vector<std::string> reset_ids_;
+};
+
+}  // namespace
+
+class FrequencyCappingHelperTest : public testing::Test {
+ public:
+  ~FrequencyCappingHelperTest() override {
+    // The helper is browser wide, so leave it empty for other tests.
+    helper()->ResetAdEventHistoryForId(kId);
+    helper()->ResetAdEventHistoryForId(kOtherId);
+  }
+
+ protected:
+  FrequencyCappingHelper* helper() {
+    return FrequencyCappingHelper::GetInstance();
+  }
+};
+
+TEST_F(FrequencyCappingHelperTest, NotifiesObservers) {
+  TestObserver observer;
+  helper()->AddObserver(&observer);
+
+  helper()->RecordAdEventForId(kId, "ad_notification", "served",
+                               base::Time::Now());
+  helper()->ResetAdEventHistoryForId(kId);
+
+  helper()->RemoveObserver(&observer);
+
+  EXPECT_EQ(std::vector<std::string>({kId}), observer.recorded_ids());
+  EXPECT_EQ(std::vector<std::string>({kId}), observer.reset_ids());
+}
+
+TEST_F(FrequencyCappingHelperTest, ReplaysHistoryOfAllInstances) {
+  helper()->RecordAdEventForId(kId, "ad_notification", "served",
+                               base::Time::Now());
+  helper()->RecordAdEventForId(kOtherId, "ad_notification", "served",
+                               base::Time::Now());
+  helper()->RecordAdEventForId(kOtherId, "new_tab_page_ad", "viewed",
+                               base::Time::Now());
+
+  TestObserver observer;
+  helper()->ReplayAdEventHistory(&observer);
+
+  EXPECT_THAT(observer.recorded_ids(),
+              testing::UnorderedElementsAre(kId, kOtherId, kOtherId));
+}
+
+TEST_F(FrequencyCappingHelperTest, DoesNotReplayResetHistory) {
+  helper()->RecordAdEventForId(kId, "ad_notification", "served",
+                               base::Time::Now());
+  helper()->RecordAdEventForId(kOtherId, "ad_notification", "served",
+                               base::Time::Now());
+  helper()->ResetAdEventHistoryForId(kId);
+
+  TestObserver observer;
+  helper()->ReplayAdEventHistory(&observer);
+
+  EXPECT_EQ(std::vector<std::string>({kOtherId}), observer.recorded_ids());
+}
+
+TEST_F(FrequencyCappingHelperTest, DoesNotReplayAdEventsOlderThanOneDay) {
+  helper()->RecordAdEventForId(kId, "ad_notification", "served",
+                               base::Time::Now() - base::Days(2));
+  helper()->RecordAdEventForId(kId, "ad_notification", "served",
+                               base::Time::Now());
+
+  TestObserver observer;
+  helper()->ReplayAdEventHistory(&observer);
+
+  EXPECT_EQ(std::vector<std::string>({kId}), observer.recorded_ids());
+}
+
+}  // namespace brave_ads
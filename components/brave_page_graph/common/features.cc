@@ -13,5 +13,25 @@ namespace features {
 // agent and activates some DevTools APIs to interact with the PageGraph engine.
 const base::Feature kPageGraph{"PageGraph", base::FEATURE_DISABLED_BY_DEFAULT};
 
+constexpr base::FeatureParam<PageGraphCaptureProfile>::Option
+    kPageGraphCaptureProfileOptions[] = {
+        {PageGraphCaptureProfile::kNetwork, "network"},
+        {PageGraphCaptureProfile::kScriptsAndNetwork, "scripts"},
+        {PageGraphCaptureProfile::kFull, "full"},
+};
+
+const base::FeatureParam<PageGraphCaptureProfile> kPageGraphCaptureProfile{
+    &kPageGraph, "capture_profile", PageGraphCaptureProfile::kFull,
+    &kPageGraphCaptureProfileOptions};
+
+const base::FeatureParam<int> kPageGraphMaxWebAPIArgumentLength{
+    &kPageGraph, "max_webapi_argument_length", 0};
+
+const base::FeatureParam<int> kPageGraphMaxJSBuiltinArgumentLength{
+    &kPageGraph, "max_js_builtin_argument_length", 0};
+
+const base::FeatureParam<int> kPageGraphMaxConsoleMessageLength{
+    &kPageGraph, "max_console_message_length", 0};
+
 }  // namespace features
 }  // namespace brave_page_graph
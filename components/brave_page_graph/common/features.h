@@ -7,11 +7,32 @@
 #define BRAVE_COMPONENTS_BRAVE_PAGE_GRAPH_COMMON_FEATURES_H_
 
 #include "base/feature_list.h"
+#include "base/metrics/field_trial_params.h"
 
 namespace brave_page_graph {
 namespace features {
 
+// What a PageGraph records. Every profile records the DOM tree, scripts and
+// requests, because those are needed to attribute requests to the elements or
+// scripts that made them.
+enum class PageGraphCaptureProfile {
+  // DOM tree, scripts, requests and shields blocks.
+  kNetwork,
+  // |kNetwork| plus WebAPI and JS builtin calls, storage access, event
+  // listeners and console messages.
+  kScriptsAndNetwork,
+  // |kScriptsAndNetwork| plus DOM attribute changes.
+  kFull,
+};
+
 extern const base::Feature kPageGraph;
+extern const base::FeatureParam<PageGraphCaptureProfile>
+    kPageGraphCaptureProfile;
+// Maximum length in bytes of a recorded call argument or result. 0 means no
+// limit.
+extern const base::FeatureParam<int> kPageGraphMaxWebAPIArgumentLength;
+extern const base::FeatureParam<int> kPageGraphMaxJSBuiltinArgumentLength;
+extern const base::FeatureParam<int> kPageGraphMaxConsoleMessageLength;
 
 }  // namespace features
 }  // namespace brave_page_graph
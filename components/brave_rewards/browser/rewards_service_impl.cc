@@ -14,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/auto_reset.h"
 #include "base/base64.h"
 #include "base/bind.h"
 #include "base/containers/contains.h"
@@ -284,6 +285,27 @@ std::string GetPrefPath(const std::string& name) {
   return base::StringPrintf("%s.%s", pref_prefix, name.c_str());
 }
 
+std::vector<std::string> GetLedgerStatePrefPaths(PrefService* prefs) {
+  DCHECK(prefs);
+
+  std::vector<std::string> paths;
+  prefs->IteratePreferenceValues(base::BindRepeating(
+      [](std::vector<std::string>* paths, const std::string& path,
+         const base::Value& value) {
+        if (base::StartsWith(path, GetPrefPath(""))) {
+          paths->push_back(path);
+        }
+      },
+      &paths));
+  return paths;
+}
+
+std::string GetLedgerStateName(const std::string& path) {
+  const std::string state_prefix = GetPrefPath("");
+  DCHECK(base::StartsWith(path, state_prefix));
+  return path.substr(state_prefix.length());
+}
+
 std::vector<std::string> GetISOCountries() {
   std::vector<std::string> countries;
   for (const char* const* country_pointer = icu::Locale::getISOCountries();
@@ -434,6 +456,16 @@ void RewardsServiceImpl::InitPrefChangeRegistrar() {
       ads::prefs::kEnabled,
       base::BindRepeating(&RewardsServiceImpl::OnPreferenceChanged,
                           base::Unretained(this)));
+
+  // The ledger process keeps a mirror of its state, so forward changes which
+  // did not originate from the ledger.
+  ledger_state_pref_change_registrar_.Init(profile_->GetPrefs());
+  for (const auto& path : GetLedgerStatePrefPaths(profile_->GetPrefs())) {
+    ledger_state_pref_change_registrar_.Add(
+        path,
+        base::BindRepeating(&RewardsServiceImpl::OnLedgerStatePrefChanged,
+                            base::Unretained(this)));
+  }
 }
 
 void RewardsServiceImpl::OnPreferenceChanged(const std::string& key) {
@@ -532,10 +564,67 @@ void RewardsServiceImpl::StartLedgerProcessIfNecessary() {
 
   bat_ledger_service_->Create(
       bat_ledger_client_receiver_.BindNewEndpointAndPassRemote(),
-      bat_ledger_.BindNewEndpointAndPassReceiver(),
+      bat_ledger_.BindNewEndpointAndPassReceiver(), GetLedgerClientState(),
       base::BindOnce(&RewardsServiceImpl::OnLedgerCreated, AsWeakPtr()));
 }
 
+bat_ledger::mojom::LedgerClientStatePtr
+RewardsServiceImpl::GetLedgerClientState() const {
+  auto state = bat_ledger::mojom::LedgerClientState::New();
+
+  PrefService* prefs = profile_->GetPrefs();
+  for (const auto& path : GetLedgerStatePrefPaths(prefs)) {
+    const std::string name = GetLedgerStateName(path);
+    state->values.Set(name, prefs->GetValue(path).Clone());
+    if (const base::Value* default_value = prefs->GetDefaultPrefValue(path)) {
+      state->default_values.Set(name, default_value->Clone());
+    }
+  }
+
+  state->options = GetLedgerClientOptions();
+
+  return state;
+}
+
+bat_ledger::mojom::LedgerClientOptionsPtr
+RewardsServiceImpl::GetLedgerClientOptions() const {
+  auto options = bat_ledger::mojom::LedgerClientOptions::New();
+  options->bool_options.insert(kBoolOptions.cbegin(), kBoolOptions.cend());
+  options->bool_options[ledger::option::kIsBitflyerRegion] =
+      GetExternalWalletType() == ledger::constant::kWalletBitflyer;
+  options->integer_options.insert(kIntegerOptions.cbegin(),
+                                  kIntegerOptions.cend());
+  options->double_options.insert(kDoubleOptions.cbegin(),
+                                 kDoubleOptions.cend());
+  options->string_options.insert(kStringOptions.cbegin(),
+                                 kStringOptions.cend());
+  options->int64_options.insert(kInt64Options.cbegin(), kInt64Options.cend());
+  options->uint64_options.insert(kUInt64Options.cbegin(),
+                                 kUInt64Options.cend());
+  return options;
+}
+
+void RewardsServiceImpl::OnLedgerStatePrefChanged(const std::string& path) {
+  if (!Connected()) {
+    return;
+  }
+
+  if (!is_writing_ledger_state_) {
+    bat_ledger_->OnStateChanged(GetLedgerStateName(path),
+                                profile_->GetPrefs()->GetValue(path).Clone());
+  }
+
+  if (path == prefs::kExternalWalletType) {
+    bat_ledger_->OnOptionsChanged(GetLedgerClientOptions());
+  }
+}
+
+int RewardsServiceImpl::GetLedgerClientSyncCallCountForTesting() const {
+  auto* bridge = static_cast<bat_ledger::LedgerClientMojoBridge*>(
+      bat_ledger_client_receiver_.impl());
+  return bridge ? bridge->sync_call_count_for_testing() : 0;
+}
+
 void RewardsServiceImpl::OnLedgerCreated() {
   if (!Connected()) {
     BLOG(0, "Ledger instance could not be created");
@@ -1521,6 +1610,7 @@ void RewardsServiceImpl::Reset() {
 }
 
 void RewardsServiceImpl::SetBooleanState(const std::string& name, bool value) {
+  base::AutoReset<bool> writing_ledger_state(&is_writing_ledger_state_, true);
   profile_->GetPrefs()->SetBoolean(GetPrefPath(name), value);
 }
 
@@ -1529,6 +1619,7 @@ bool RewardsServiceImpl::GetBooleanState(const std::string& name) const {
 }
 
 void RewardsServiceImpl::SetIntegerState(const std::string& name, int value) {
+  base::AutoReset<bool> writing_ledger_state(&is_writing_ledger_state_, true);
   profile_->GetPrefs()->SetInteger(GetPrefPath(name), value);
 }
 
@@ -1537,6 +1628,7 @@ int RewardsServiceImpl::GetIntegerState(const std::string& name) const {
 }
 
 void RewardsServiceImpl::SetDoubleState(const std::string& name, double value) {
+  base::AutoReset<bool> writing_ledger_state(&is_writing_ledger_state_, true);
   profile_->GetPrefs()->SetDouble(GetPrefPath(name), value);
 }
 
@@ -1546,6 +1638,7 @@ double RewardsServiceImpl::GetDoubleState(const std::string& name) const {
 
 void RewardsServiceImpl::SetStringState(const std::string& name,
                                         const std::string& value) {
+  base::AutoReset<bool> writing_ledger_state(&is_writing_ledger_state_, true);
   profile_->GetPrefs()->SetString(GetPrefPath(name), value);
 }
 
@@ -1554,6 +1647,7 @@ std::string RewardsServiceImpl::GetStringState(const std::string& name) const {
 }
 
 void RewardsServiceImpl::SetInt64State(const std::string& name, int64_t value) {
+  base::AutoReset<bool> writing_ledger_state(&is_writing_ledger_state_, true);
   profile_->GetPrefs()->SetInt64(GetPrefPath(name), value);
 }
 
@@ -1563,6 +1657,7 @@ int64_t RewardsServiceImpl::GetInt64State(const std::string& name) const {
 
 void RewardsServiceImpl::SetUint64State(const std::string& name,
                                         uint64_t value) {
+  base::AutoReset<bool> writing_ledger_state(&is_writing_ledger_state_, true);
   profile_->GetPrefs()->SetUint64(GetPrefPath(name), value);
 }
 
@@ -1572,6 +1667,7 @@ uint64_t RewardsServiceImpl::GetUint64State(const std::string& name) const {
 
 void RewardsServiceImpl::SetValueState(const std::string& name,
                                        base::Value value) {
+  base::AutoReset<bool> writing_ledger_state(&is_writing_ledger_state_, true);
   profile_->GetPrefs()->Set(GetPrefPath(name), std::move(value));
 }
 
@@ -1580,6 +1676,7 @@ base::Value RewardsServiceImpl::GetValueState(const std::string& name) const {
 }
 
 void RewardsServiceImpl::ClearState(const std::string& name) {
+  base::AutoReset<bool> writing_ledger_state(&is_writing_ledger_state_, true);
   profile_->GetPrefs()->ClearPref(GetPrefPath(name));
 }
 
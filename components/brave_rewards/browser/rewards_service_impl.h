@@ -350,6 +350,7 @@ class RewardsServiceImpl : public RewardsService,
   void ForTestingSetTestResponseCallback(
       const GetTestResponseCallback& callback);
   void StartProcessForTesting(base::OnceClosure callback);
+  int GetLedgerClientSyncCallCountForTesting() const;
 
  private:
   friend class ::RewardsFlagBrowserTest;
@@ -367,6 +368,13 @@ class RewardsServiceImpl : public RewardsService,
 
   void OnPreferenceChanged(const std::string& key);
 
+  // Snapshot of the ledger state and options which is mirrored by the ledger
+  // process so that reads do not need a round trip to the browser.
+  bat_ledger::mojom::LedgerClientStatePtr GetLedgerClientState() const;
+  bat_ledger::mojom::LedgerClientOptionsPtr GetLedgerClientOptions() const;
+
+  void OnLedgerStatePrefChanged(const std::string& path);
+
   void CheckPreferences();
 
   void StartLedgerProcessIfNecessary();
@@ -655,12 +663,14 @@ class RewardsServiceImpl : public RewardsService,
   std::unique_ptr<base::OneShotTimer> notification_startup_timer_;
   std::unique_ptr<base::RepeatingTimer> notification_periodic_timer_;
   PrefChangeRegistrar profile_pref_change_registrar_;
+  PrefChangeRegistrar ledger_state_pref_change_registrar_;
 
   uint32_t next_timer_id_;
   int32_t country_id_ = 0;
   bool reset_states_;
   bool ledger_for_testing_ = false;
   bool resetting_rewards_ = false;
+  bool is_writing_ledger_state_ = false;
   int persist_log_level_ = 0;
 
   GetTestResponseCallback test_response_callback_;
@@ -148,6 +148,36 @@ IN_PROC_BROWSER_TEST_F(RewardsContributionBrowserTest, AutoContribution) {
       contents(), "[data-test-id=rewards-summary-ac]", "-20.00 BAT");
 }
 
+IN_PROC_BROWSER_TEST_F(RewardsContributionBrowserTest,
+                       AutoContributionSyncCallCount) {
+  rewards_browsertest_util::CreateRewardsWallet(rewards_service_);
+  rewards_service_->SetAutoContributeEnabled(true);
+  context_helper_->LoadRewardsPage();
+  contribution_->AddBalance(promotion_->ClaimPromotionViaCode());
+
+  context_helper_->VisitPublisher(
+      rewards_browsertest_util::GetUrl(https_server_.get(), "duckduckgo.com"),
+      true);
+
+  const int sync_call_count =
+      rewards_service_->GetLedgerClientSyncCallCountForTesting();
+
+  rewards_service_->StartMonthlyContributionForTest();
+
+  contribution_->WaitForACReconcileCompleted();
+  ASSERT_EQ(contribution_->GetACStatus(), ledger::mojom::Result::LEDGER_OK);
+
+  // Ledger state and options are read from the mirror in the ledger process.
+  // The only sync calls left in a contribution are the few wallet decryptions
+  // for signed requests, where every state read used to be one.
+  constexpr int kMaxSyncCallsPerAutoContribute = 10;
+  EXPECT_LE(rewards_service_->GetLedgerClientSyncCallCountForTesting() -
+                sync_call_count,
+            kMaxSyncCallsPerAutoContribute);
+
+  contribution_->IsBalanceCorrect();
+}
+
 IN_PROC_BROWSER_TEST_F(RewardsContributionBrowserTest,
                        AutoContributionMultiplePublishers) {
   rewards_browsertest_util::CreateRewardsWallet(rewards_service_);
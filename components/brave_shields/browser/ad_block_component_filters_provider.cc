@@ -9,7 +9,9 @@
 #include <string>
 #include <utility>
 
+#include "base/bind.h"
 #include "base/files/file_path.h"
+#include "base/files/file_util.h"
 #include "base/logging.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/brave_shields/browser/ad_block_component_installer.h"
@@ -25,8 +27,11 @@ AdBlockComponentFiltersProvider::AdBlockComponentFiltersProvider(
     component_updater::ComponentUpdateService* cus,
     std::string component_id,
     std::string base64_public_key,
-    std::string title)
-    : component_id_(component_id), component_updater_service_(cus) {
+    std::string title,
+    const base::FilePath& engine_cache_dir)
+    : component_id_(component_id),
+      engine_cache_dir_(engine_cache_dir),
+      component_updater_service_(cus) {
   // Can be nullptr in unit tests
   if (cus) {
     RegisterAdBlockFiltersComponent(
@@ -38,11 +43,13 @@ AdBlockComponentFiltersProvider::AdBlockComponentFiltersProvider(
 
 AdBlockComponentFiltersProvider::AdBlockComponentFiltersProvider(
     component_updater::ComponentUpdateService* cus,
-    const FilterListCatalogEntry& catalog_entry)
+    const FilterListCatalogEntry& catalog_entry,
+    const base::FilePath& engine_cache_dir)
     : AdBlockComponentFiltersProvider(cus,
                                       catalog_entry.component_id,
                                       catalog_entry.base64_public_key,
-                                      catalog_entry.title) {}
+                                      catalog_entry.title,
+                                      engine_cache_dir) {}
 
 AdBlockComponentFiltersProvider::~AdBlockComponentFiltersProvider() = default;
 
@@ -78,7 +85,21 @@ void AdBlockComponentFiltersProvider::LoadDATBuffer(
 }
 
 bool AdBlockComponentFiltersProvider::Delete() && {
+  const base::FilePath cache_path = GetCompiledEngineCachePath();
+  if (!cache_path.empty()) {
+    base::ThreadPool::PostTask(
+        FROM_HERE, {base::MayBlock()},
+        base::BindOnce(base::IgnoreResult(&base::DeleteFile), cache_path));
+  }
   return component_updater_service_->UnregisterComponent(component_id_);
 }
 
+base::FilePath AdBlockComponentFiltersProvider::GetCompiledEngineCachePath()
+    const {
+  if (engine_cache_dir_.empty()) {
+    return base::FilePath();
+  }
+  return engine_cache_dir_.AppendASCII(component_id_ + ".dat");
+}
+
 }  // namespace brave_shields
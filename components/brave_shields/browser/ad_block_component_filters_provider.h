@@ -9,6 +9,7 @@
 #include <string>
 
 #include "base/callback.h"
+#include "base/files/file_path.h"
 #include "base/observer_list.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_shields/browser/ad_block_filters_provider.h"
@@ -20,10 +21,6 @@ namespace component_updater {
 class ComponentUpdateService;
 }  // namespace component_updater
 
-namespace base {
-class FilePath;
-}
-
 class AdBlockServiceTest;
 
 namespace brave_shields {
@@ -37,11 +34,13 @@ class AdBlockComponentFiltersProvider : public AdBlockFiltersProvider {
       component_updater::ComponentUpdateService* cus,
       std::string component_id,
       std::string base64_public_key,
-      std::string title);
+      std::string title,
+      const base::FilePath& engine_cache_dir);
   // Helper to build a particular adblock component from a catalog entry
   AdBlockComponentFiltersProvider(
       component_updater::ComponentUpdateService* cus,
-      const FilterListCatalogEntry& catalog_entry);
+      const FilterListCatalogEntry& catalog_entry,
+      const base::FilePath& engine_cache_dir);
   ~AdBlockComponentFiltersProvider() override;
   AdBlockComponentFiltersProvider(const AdBlockComponentFiltersProvider&) =
       delete;
@@ -54,6 +53,10 @@ class AdBlockComponentFiltersProvider : public AdBlockFiltersProvider {
 
   bool Delete() && override;
 
+  // Compiled engines are persisted in |engine_cache_dir|, named after the
+  // component, unless it is empty.
+  base::FilePath GetCompiledEngineCachePath() const override;
+
  private:
   friend class ::AdBlockServiceTest;
 
@@ -61,6 +64,7 @@ class AdBlockComponentFiltersProvider : public AdBlockFiltersProvider {
 
   base::FilePath component_path_;
   std::string component_id_;
+  base::FilePath engine_cache_dir_;
   component_updater::ComponentUpdateService* component_updater_service_;
 
   base::WeakPtrFactory<AdBlockComponentFiltersProvider> weak_factory_{this};
@@ -166,6 +166,11 @@ void AdBlockEngine::AddResources(const std::string& resources) {
   ad_block_client_->addResources(resources);
 }
 
+void AdBlockEngine::UseResources(
+    scoped_refptr<AdBlockResourceStore> resources) {
+  resources->UseResources(ad_block_client_.get());
+}
+
 bool AdBlockEngine::TagExists(const std::string& tag) {
   return base::Contains(tags_, tag);
 }
@@ -193,20 +198,27 @@ base::Value::List AdBlockEngine::HiddenClassIdSelectors(
 absl::optional<adblock::FilterListMetadata> AdBlockEngine::Load(
     bool deserialize,
     const DATFileDataBuffer& dat_buf,
-    const std::string& resources_json) {
+    scoped_refptr<AdBlockResourceStore> resources) {
   if (deserialize) {
-    OnDATLoaded(dat_buf, resources_json);
+    OnDATLoaded(dat_buf, std::move(resources));
     return absl::nullopt;
   } else {
-    return absl::make_optional(OnListSourceLoaded(dat_buf, resources_json));
+    return absl::make_optional(
+        OnListSourceLoaded(dat_buf, std::move(resources)));
   }
 }
 
+void AdBlockEngine::LoadCompiled(
+    std::unique_ptr<adblock::Engine> ad_block_client,
+    scoped_refptr<AdBlockResourceStore> resources) {
+  UpdateAdBlockClient(std::move(ad_block_client), std::move(resources));
+}
+
 void AdBlockEngine::UpdateAdBlockClient(
     std::unique_ptr<adblock::Engine> ad_block_client,
-    const std::string& resources_json) {
+    scoped_refptr<AdBlockResourceStore> resources) {
   ad_block_client_ = std::move(ad_block_client);
-  AddResources(resources_json);
+  UseResources(std::move(resources));
   AddKnownTagsToAdBlockInstance();
   if (test_observer_) {
     test_observer_->OnEngineUpdated();
@@ -220,15 +232,17 @@ void AdBlockEngine::AddKnownTagsToAdBlockInstance() {
 
 adblock::FilterListMetadata AdBlockEngine::OnListSourceLoaded(
     const DATFileDataBuffer& filters,
-    const std::string& resources_json) {
+    scoped_refptr<AdBlockResourceStore> resources) {
   auto metadata_and_engine = adblock::engineFromBufferWithMetadata(
       reinterpret_cast<const char*>(filters.data()), filters.size());
-  UpdateAdBlockClient(std::move(metadata_and_engine.second), resources_json);
+  UpdateAdBlockClient(std::move(metadata_and_engine.second),
+                      std::move(resources));
   return std::move(metadata_and_engine.first);
 }
 
-void AdBlockEngine::OnDATLoaded(const DATFileDataBuffer& dat_buf,
-                                const std::string& resources_json) {
+void AdBlockEngine::OnDATLoaded(
+    const DATFileDataBuffer& dat_buf,
+    scoped_refptr<AdBlockResourceStore> resources) {
   // An empty buffer will not load successfully.
   if (dat_buf.empty()) {
     return;
@@ -238,7 +252,7 @@ void AdBlockEngine::OnDATLoaded(const DATFileDataBuffer& dat_buf,
   client->deserialize(reinterpret_cast<const char*>(&dat_buf.front()),
                       dat_buf.size());
 
-  UpdateAdBlockClient(std::move(client), resources_json);
+  UpdateAdBlockClient(std::move(client), std::move(resources));
 }
 
 void AdBlockEngine::AddObserverForTest(AdBlockEngine::TestObserver* observer) {
@@ -14,11 +14,13 @@
 #include <utility>
 #include <vector>
 
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list_types.h"
 #include "base/values.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 #include "url/gurl.h"
 
@@ -60,6 +62,7 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
       blink::mojom::ResourceType resource_type,
       const std::string& tab_host);
   void AddResources(const std::string& resources);
+  void UseResources(scoped_refptr<AdBlockResourceStore> resources);
   void EnableTag(const std::string& tag, bool enabled);
   bool TagExists(const std::string& tag);
 
@@ -72,7 +75,10 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
   absl::optional<adblock::FilterListMetadata> Load(
       bool deserialize,
       const DATFileDataBuffer& dat_buf,
-      const std::string& resources_json);
+      scoped_refptr<AdBlockResourceStore> resources);
+  // Replaces the engine with |ad_block_client|, which was compiled elsewhere.
+  void LoadCompiled(std::unique_ptr<adblock::Engine> ad_block_client,
+                    scoped_refptr<AdBlockResourceStore> resources);
 
   class TestObserver : public base::CheckedObserver {
    public:
@@ -85,13 +91,13 @@ class AdBlockEngine : public base::SupportsWeakPtr<AdBlockEngine> {
  protected:
   void AddKnownTagsToAdBlockInstance();
   void UpdateAdBlockClient(std::unique_ptr<adblock::Engine> ad_block_client,
-                           const std::string& resources_json);
+                           scoped_refptr<AdBlockResourceStore> resources);
   adblock::FilterListMetadata OnListSourceLoaded(
       const DATFileDataBuffer& filters,
-      const std::string& resources_json);
+      scoped_refptr<AdBlockResourceStore> resources);
 
   void OnDATLoaded(const DATFileDataBuffer& dat_buf,
-                   const std::string& resources_json);
+                   scoped_refptr<AdBlockResourceStore> resources);
 
   std::unique_ptr<adblock::Engine> ad_block_client_;
 
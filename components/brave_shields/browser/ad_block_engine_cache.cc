@@ -0,0 +1,119 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_engine_cache.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "crypto/sha2.h"
+
+namespace brave_shields {
+
+namespace {
+
+// Cached engines start with a line holding the key of the filters they were
+// compiled from.
+constexpr char kKeySeparator = '\n';
+
+// Bump when the layout of cached engine files changes.
+constexpr char kCacheFormatVersion[] = "2";
+
+std::string GetCacheKey(const DATFileDataBuffer& filters) {
+  std::string key_source(kCacheFormatVersion);
+  key_source.push_back('\0');
+  key_source.append(adblock::kAdBlockRustVersion);
+  key_source.push_back('\0');
+  key_source.append(filters.begin(), filters.end());
+  return base::HexEncode(crypto::SHA256HashString(key_source).data(),
+                         crypto::kSHA256Length);
+}
+
+}  // namespace
+
+std::unique_ptr<adblock::Engine> LoadCompiledEngine(
+    const base::FilePath& cache_path,
+    const DATFileDataBuffer& filters) {
+  base::MemoryMappedFile mapped_file;
+  if (cache_path.empty() || !base::PathExists(cache_path) ||
+      !mapped_file.Initialize(cache_path)) {
+    return nullptr;
+  }
+
+  const std::string key = GetCacheKey(filters);
+  const base::StringPiece contents(
+      reinterpret_cast<const char*>(mapped_file.data()), mapped_file.length());
+  if (contents.size() <= key.size() + 1 ||
+      contents.substr(0, key.size()) != key ||
+      contents[key.size()] != kKeySeparator) {
+    return nullptr;
+  }
+
+  const base::StringPiece serialized = contents.substr(key.size() + 1);
+  auto engine = std::make_unique<adblock::Engine>();
+  if (!engine->deserialize(serialized.data(), serialized.size())) {
+    LOG(ERROR) << "Could not deserialize compiled adblock engine from "
+               << cache_path.LossyDisplayName();
+    return nullptr;
+  }
+  return engine;
+}
+
+bool WriteCompiledEngine(const base::FilePath& cache_path,
+                         const DATFileDataBuffer& filters,
+                         adblock::Engine* engine) {
+  DCHECK(engine);
+
+  const std::vector<unsigned char> serialized = engine->serialize();
+  if (serialized.empty()) {
+    return false;
+  }
+
+  std::string contents = GetCacheKey(filters);
+  contents.push_back(kKeySeparator);
+  contents.append(serialized.begin(), serialized.end());
+  if (!base::CreateDirectory(cache_path.DirName()) ||
+      !base::ImportantFileWriter::WriteFileAtomically(cache_path, contents)) {
+    LOG(ERROR) << "Could not write compiled adblock engine to "
+               << cache_path.LossyDisplayName();
+    return false;
+  }
+  return true;
+}
+
+std::pair<absl::optional<adblock::FilterListMetadata>,
+          std::unique_ptr<adblock::Engine>>
+LoadOrCompileEngine(const DATFileDataBuffer& filters,
+                    const base::FilePath& cache_path) {
+  if (!filters.empty()) {
+    std::unique_ptr<adblock::Engine> engine =
+        LoadCompiledEngine(cache_path, filters);
+    if (engine) {
+      return std::make_pair(absl::nullopt, std::move(engine));
+    }
+  }
+
+  auto metadata_and_engine = adblock::engineFromBufferWithMetadata(
+      reinterpret_cast<const char*>(filters.data()), filters.size());
+  if (!cache_path.empty() && !filters.empty()) {
+    WriteCompiledEngine(cache_path, filters, metadata_and_engine.second.get());
+  }
+  return std::make_pair(
+      absl::optional<adblock::FilterListMetadata>(
+          std::move(metadata_and_engine.first)),
+      std::move(metadata_and_engine.second));
+}
+
+}  // namespace brave_shields
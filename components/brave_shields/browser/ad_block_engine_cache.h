@@ -0,0 +1,59 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_ENGINE_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_ENGINE_CACHE_H_
+
+#include <memory>
+#include <utility>
+
+#include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+using brave_component_updater::DATFileDataBuffer;
+
+namespace adblock {
+class Engine;
+struct FilterListMetadata;
+}  // namespace adblock
+
+namespace base {
+class FilePath;
+}  // namespace base
+
+namespace brave_shields {
+
+// Helpers to persist engines compiled from filter list text, so that lists
+// which are not shipped as serialized DAT files are only compiled again when
+// their contents, the adblock-rust version or the cache format change.
+//
+// NOTE: These functions do file IO and should not be called on the UI thread.
+
+// Returns the engine stored at |cache_path| if it was compiled from |filters|
+// by the current adblock-rust version, or nullptr otherwise. The file is
+// memory-mapped read-only and deserialized from the mapping, so the serialized
+// engine is never copied into a heap buffer.
+std::unique_ptr<adblock::Engine> LoadCompiledEngine(
+    const base::FilePath& cache_path,
+    const DATFileDataBuffer& filters);
+
+// Serializes |engine|, compiled from |filters|, to |cache_path|, creating its
+// directory if needed.
+bool WriteCompiledEngine(const base::FilePath& cache_path,
+                         const DATFileDataBuffer& filters,
+                         adblock::Engine* engine);
+
+// Loads the engine for |filters| from |cache_path| if it is up to date, or
+// compiles |filters| into a new engine and writes it to |cache_path|. An empty
+// |cache_path| always compiles and writes nothing. Metadata is only returned
+// when |filters| were compiled, because serialized engines do not keep it.
+std::pair<absl::optional<adblock::FilterListMetadata>,
+          std::unique_ptr<adblock::Engine>>
+LoadOrCompileEngine(const DATFileDataBuffer& filters,
+                    const base::FilePath& cache_path);
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_ENGINE_CACHE_H_
@@ -0,0 +1,113 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_engine_cache.h"
+
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_shields/browser/ad_block_component_filters_provider.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_shields {
+
+namespace {
+
+DATFileDataBuffer ToBuffer(const std::string& filters) {
+  return DATFileDataBuffer(filters.begin(), filters.end());
+}
+
+}  // namespace
+
+TEST(AdBlockEngineCacheTest, CompiledEngineIsReusedForSameFilters) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath cache_path = temp_dir.GetPath().AppendASCII("engine");
+
+  const DATFileDataBuffer filters =
+      ToBuffer("! Title: Test list\n||example.com^\n");
+  auto metadata_and_engine = LoadOrCompileEngine(filters, cache_path);
+  ASSERT_TRUE(metadata_and_engine.second);
+  ASSERT_TRUE(metadata_and_engine.first);
+  EXPECT_EQ(metadata_and_engine.first->title, "Test list");
+  ASSERT_TRUE(base::PathExists(cache_path));
+
+  EXPECT_TRUE(LoadCompiledEngine(cache_path, filters));
+
+  // The cached engine is loaded instead of compiling the filters again, so no
+  // metadata is available.
+  metadata_and_engine = LoadOrCompileEngine(filters, cache_path);
+  EXPECT_TRUE(metadata_and_engine.second);
+  EXPECT_FALSE(metadata_and_engine.first);
+}
+
+TEST(AdBlockEngineCacheTest, CompiledEngineIsNotReusedForOtherFilters) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath cache_path = temp_dir.GetPath().AppendASCII("engine");
+
+  LoadOrCompileEngine(ToBuffer("||example.com^\n"), cache_path);
+  ASSERT_TRUE(base::PathExists(cache_path));
+
+  EXPECT_FALSE(LoadCompiledEngine(cache_path, ToBuffer("||example.org^\n")));
+}
+
+TEST(AdBlockEngineCacheTest, MissingOrCorruptCache) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath cache_path = temp_dir.GetPath().AppendASCII("engine");
+  const DATFileDataBuffer filters = ToBuffer("||example.com^\n");
+
+  EXPECT_FALSE(LoadCompiledEngine(cache_path, filters));
+  EXPECT_FALSE(LoadCompiledEngine(base::FilePath(), filters));
+
+  ASSERT_TRUE(base::WriteFile(cache_path, "not a compiled engine"));
+  EXPECT_FALSE(LoadCompiledEngine(cache_path, filters));
+
+  // A corrupt cache is replaced by compiling the filters.
+  auto metadata_and_engine = LoadOrCompileEngine(filters, cache_path);
+  EXPECT_TRUE(metadata_and_engine.first);
+  EXPECT_TRUE(metadata_and_engine.second);
+  EXPECT_TRUE(LoadCompiledEngine(cache_path, filters));
+}
+
+TEST(AdBlockEngineCacheTest, CacheDirectoryIsCreated) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath cache_path =
+      temp_dir.GetPath().AppendASCII("cache").AppendASCII("component.dat");
+  const DATFileDataBuffer filters = ToBuffer("||example.com^\n");
+
+  LoadOrCompileEngine(filters, cache_path);
+  EXPECT_TRUE(LoadCompiledEngine(cache_path, filters));
+}
+
+TEST(AdBlockEngineCacheTest, EmptyCachePathIsNotWritten) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  auto metadata_and_engine =
+      LoadOrCompileEngine(ToBuffer("||example.com^\n"), base::FilePath());
+  EXPECT_TRUE(metadata_and_engine.second);
+  EXPECT_TRUE(base::IsDirectoryEmpty(temp_dir.GetPath()));
+}
+
+TEST(AdBlockEngineCacheTest, ComponentEnginesAreCachedPerComponent) {
+  const base::FilePath cache_dir(FILE_PATH_LITERAL("cache"));
+
+  AdBlockComponentFiltersProvider provider(nullptr, "componentid", "", "Title",
+                                           cache_dir);
+  EXPECT_EQ(cache_dir.AppendASCII("componentid.dat"),
+            provider.GetCompiledEngineCachePath());
+
+  AdBlockComponentFiltersProvider uncached_provider(nullptr, "componentid", "",
+                                                    "Title", base::FilePath());
+  EXPECT_TRUE(uncached_provider.GetCompiledEngineCachePath().empty());
+}
+
+}  // namespace brave_shields
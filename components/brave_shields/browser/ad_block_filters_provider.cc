@@ -48,4 +48,8 @@ bool AdBlockFiltersProvider::Delete() && {
   return false;
 }
 
+base::FilePath AdBlockFiltersProvider::GetCompiledEngineCachePath() const {
+  return base::FilePath();
+}
+
 }  // namespace brave_shields
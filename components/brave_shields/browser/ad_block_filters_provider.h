@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_FILTERS_PROVIDER_H_
 
 #include "base/callback.h"
+#include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
@@ -38,6 +39,10 @@ class AdBlockFiltersProvider {
 
   virtual bool Delete() &&;
 
+  // Returns the path where an engine compiled from this provider's filter list
+  // text is persisted, or an empty path if it should not be persisted.
+  virtual base::FilePath GetCompiledEngineCachePath() const;
+
  protected:
   virtual void LoadDATBuffer(
       base::OnceCallback<void(bool deserialize,
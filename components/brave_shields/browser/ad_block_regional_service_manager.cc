@@ -34,11 +34,13 @@ AdBlockRegionalServiceManager::AdBlockRegionalServiceManager(
     PrefService* local_state,
     std::string locale,
     component_updater::ComponentUpdateService* cus,
-    scoped_refptr<base::SequencedTaskRunner> task_runner)
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    const base::FilePath& engine_cache_dir)
     : local_state_(local_state),
       locale_(locale),
       initialized_(false),
       task_runner_(task_runner),
+      engine_cache_dir_(engine_cache_dir),
       component_update_service_(cus) {}
 
 void AdBlockRegionalServiceManager::Init(
@@ -116,7 +118,7 @@ void AdBlockRegionalServiceManager::StartRegionalServices() {
           existing_engine == regional_services_.end()) {
         auto regional_filters_provider =
             std::make_unique<AdBlockComponentFiltersProvider>(
-                component_update_service_, *catalog_entry);
+                component_update_service_, *catalog_entry, engine_cache_dir_);
         auto regional_service =
             std::unique_ptr<AdBlockEngine, base::OnTaskRunnerDeleter>(
                 new AdBlockEngine(), base::OnTaskRunnerDeleter(task_runner_));
@@ -257,7 +259,7 @@ void AdBlockRegionalServiceManager::EnableFilterList(const std::string& uuid,
     DCHECK(it == regional_services_.end());
     auto regional_filters_provider =
         std::make_unique<AdBlockComponentFiltersProvider>(
-            component_update_service_, *catalog_entry);
+            component_update_service_, *catalog_entry, engine_cache_dir_);
     auto regional_service =
         std::unique_ptr<AdBlockEngine, base::OnTaskRunnerDeleter>(
             new AdBlockEngine(), base::OnTaskRunnerDeleter(task_runner_));
@@ -387,9 +389,10 @@ AdBlockRegionalServiceManagerFactory(
     PrefService* local_state,
     std::string locale,
     component_updater::ComponentUpdateService* cus,
-    scoped_refptr<base::SequencedTaskRunner> task_runner) {
-  return std::make_unique<AdBlockRegionalServiceManager>(local_state, locale,
-                                                         cus, task_runner);
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    const base::FilePath& engine_cache_dir) {
+  return std::make_unique<AdBlockRegionalServiceManager>(
+      local_state, locale, cus, task_runner, engine_cache_dir);
 }
 
 }  // namespace brave_shields
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/synchronization/lock.h"
@@ -44,7 +45,8 @@ class AdBlockRegionalServiceManager
       PrefService* local_state,
       std::string locale,
       component_updater::ComponentUpdateService* cus,
-      scoped_refptr<base::SequencedTaskRunner> task_runner);
+      scoped_refptr<base::SequencedTaskRunner> task_runner,
+      const base::FilePath& engine_cache_dir);
   AdBlockRegionalServiceManager(const AdBlockRegionalServiceManager&) = delete;
   AdBlockRegionalServiceManager& operator=(
       const AdBlockRegionalServiceManager&) = delete;
@@ -108,6 +110,7 @@ class AdBlockRegionalServiceManager
   std::vector<FilterListCatalogEntry> filter_list_catalog_;
 
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  base::FilePath engine_cache_dir_;
   raw_ptr<component_updater::ComponentUpdateService> component_update_service_;
   raw_ptr<AdBlockResourceProvider> resource_provider_;
   raw_ptr<AdBlockFilterListCatalogProvider> catalog_provider_;
@@ -121,7 +124,8 @@ AdBlockRegionalServiceManagerFactory(
     PrefService* local_state,
     std::string locale,
     component_updater::ComponentUpdateService* cus,
-    scoped_refptr<base::SequencedTaskRunner> task_runner);
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    const base::FilePath& engine_cache_dir);
 
 }  // namespace brave_shields
 
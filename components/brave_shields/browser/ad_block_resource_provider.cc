@@ -6,6 +6,10 @@
 #include "brave/components/brave_shields/browser/ad_block_resource_provider.h"
 
 #include <string>
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
 
 namespace brave_shields {
 
@@ -25,10 +29,38 @@ void AdBlockResourceProvider::RemoveObserver(
     observers_.RemoveObserver(observer);
 }
 
+void AdBlockResourceProvider::LoadResourceStore(ResourceStoreCallback cb) {
+  if (resources_) {
+    std::move(cb).Run(resources_);
+    return;
+  }
+
+  pending_callbacks_.push_back(std::move(cb));
+  if (pending_callbacks_.size() > 1)
+    return;
+
+  LoadResources(base::BindOnce(&AdBlockResourceProvider::OnResourceStoreLoaded,
+                               weak_factory_.GetWeakPtr()));
+}
+
+void AdBlockResourceProvider::OnResourceStoreLoaded(
+    const std::string& resources_json) {
+  // Resources broadcast while loading are newer than these.
+  if (!resources_)
+    resources_ = base::MakeRefCounted<AdBlockResourceStore>(resources_json);
+
+  std::vector<ResourceStoreCallback> callbacks;
+  callbacks.swap(pending_callbacks_);
+  for (auto& cb : callbacks) {
+    std::move(cb).Run(resources_);
+  }
+}
+
 void AdBlockResourceProvider::OnResourcesLoaded(
     const std::string& resources_json) {
+  resources_ = base::MakeRefCounted<AdBlockResourceStore>(resources_json);
   for (auto& observer : observers_) {
-    observer.OnResourcesLoaded(resources_json);
+    observer.OnResourcesLoaded(resources_);
   }
 }
 
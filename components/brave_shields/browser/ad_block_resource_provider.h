@@ -7,11 +7,15 @@
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_PROVIDER_H_
 
 #include <string>
+#include <vector>
 
 #include "base/callback.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 using brave_component_updater::DATFileDataBuffer;
@@ -24,7 +28,9 @@ class AdBlockResourceProvider {
  public:
   class Observer : public base::CheckedObserver {
    public:
-    virtual void OnResourcesLoaded(const std::string& resources_json) = 0;
+    // |resources| is shared by every observer notified of the same load.
+    virtual void OnResourcesLoaded(
+        scoped_refptr<AdBlockResourceStore> resources) = 0;
   };
 
   AdBlockResourceProvider();
@@ -33,6 +39,13 @@ class AdBlockResourceProvider {
   void AddObserver(Observer* observer);
   void RemoveObserver(Observer* observer);
 
+  using ResourceStoreCallback =
+      base::OnceCallback<void(scoped_refptr<AdBlockResourceStore>)>;
+
+  // Runs |cb| with the current resources. They are loaded and parsed once and
+  // shared by every caller until newer resources replace them.
+  void LoadResourceStore(ResourceStoreCallback cb);
+
   virtual void LoadResources(
       base::OnceCallback<void(const std::string& resources_json)>) = 0;
 
@@ -40,7 +53,13 @@ class AdBlockResourceProvider {
   void OnResourcesLoaded(const std::string& resources_json);
 
  private:
+  void OnResourceStoreLoaded(const std::string& resources_json);
+
   base::ObserverList<Observer> observers_;
+  scoped_refptr<AdBlockResourceStore> resources_;
+  // Callers waiting for the first LoadResources() reply.
+  std::vector<ResourceStoreCallback> pending_callbacks_;
+  base::WeakPtrFactory<AdBlockResourceProvider> weak_factory_{this};
 };
 
 }  // namespace brave_shields
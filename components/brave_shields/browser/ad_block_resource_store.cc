@@ -0,0 +1,38 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+
+namespace brave_shields {
+
+AdBlockResourceStore::AdBlockResourceStore(std::string resources_json)
+    : resources_json_(std::move(resources_json)) {}
+
+AdBlockResourceStore::~AdBlockResourceStore() = default;
+
+void AdBlockResourceStore::UseResources(adblock::Engine* engine) {
+  DCHECK(engine);
+
+  base::AutoLock lock(lock_);
+  if (!resources_) {
+    resources_ = std::make_unique<adblock::Resources>(resources_json_);
+    std::string().swap(resources_json_);
+    parse_count_++;
+  }
+
+  engine->useResources(*resources_);
+}
+
+size_t AdBlockResourceStore::GetParseCountForTesting() const {
+  base::AutoLock lock(lock_);
+  return parse_count_;
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,53 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_STORE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_STORE_H_
+
+#include <memory>
+#include <string>
+
+#include "base/memory/ref_counted.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+
+namespace adblock {
+class Engine;
+class Resources;
+}  // namespace adblock
+
+namespace brave_shields {
+
+// Scriptlet and redirect resources from one load of an
+// AdBlockResourceProvider. The resources JSON, which can be megabytes, is
+// parsed by the first engine using it and the other engines updated by the
+// same load reuse that parse. The provider keeps the current store for
+// engines loaded later, until newer resources replace it.
+class AdBlockResourceStore
+    : public base::RefCountedThreadSafe<AdBlockResourceStore> {
+ public:
+  explicit AdBlockResourceStore(std::string resources_json);
+  AdBlockResourceStore(const AdBlockResourceStore&) = delete;
+  AdBlockResourceStore& operator=(const AdBlockResourceStore&) = delete;
+
+  // Makes |engine| use these resources.
+  void UseResources(adblock::Engine* engine);
+
+  size_t GetParseCountForTesting() const;
+
+ private:
+  friend class base::RefCountedThreadSafe<AdBlockResourceStore>;
+  ~AdBlockResourceStore();
+
+  mutable base::Lock lock_;
+  // Cleared once parsed into |resources_|.
+  std::string resources_json_ GUARDED_BY(lock_);
+  std::unique_ptr<adblock::Resources> resources_ GUARDED_BY(lock_);
+  size_t parse_count_ GUARDED_BY(lock_) = 0;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_STORE_H_
@@ -0,0 +1,59 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
+
+#include <string>
+
+#include "base/memory/scoped_refptr.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_shields {
+
+namespace {
+
+constexpr char kContent[] =
+    "KGZ1bmN0aW9uKCkgewogICAgJ3VzZSBzdHJpY3QnOwp9KSgpOwo=";
+
+constexpr char kResources[] = R"([{
+    "name": "noopjs",
+    "aliases": ["noop.js"],
+    "kind": {"mime": "application/javascript"},
+    "content": "KGZ1bmN0aW9uKCkgewogICAgJ3VzZSBzdHJpY3QnOwp9KSgpOwo="
+  }])";
+
+}  // namespace
+
+TEST(AdBlockResourceStoreTest, ResourcesAreParsedOncePerLoad) {
+  auto resources = base::MakeRefCounted<AdBlockResourceStore>(kResources);
+  adblock::Engine engine1("||example.com^$redirect=noopjs");
+  adblock::Engine engine2("||example.org^$redirect=noop.js");
+
+  resources->UseResources(&engine1);
+  resources->UseResources(&engine2);
+  EXPECT_EQ(1u, resources->GetParseCountForTesting());
+}
+
+TEST(AdBlockResourceStoreTest, EngineUsesRedirectResource) {
+  auto resources = base::MakeRefCounted<AdBlockResourceStore>(kResources);
+  adblock::Engine engine("||example.com/ad.js$script,redirect=noop.js");
+  resources->UseResources(&engine);
+  // The engine keeps its own copy of the resources.
+  resources.reset();
+
+  bool did_match_rule = false;
+  bool did_match_exception = false;
+  bool did_match_important = false;
+  std::string redirect;
+  engine.matches("https://example.com/ad.js", "example.com", "example.net",
+                 true, "script", &did_match_rule, &did_match_exception,
+                 &did_match_important, &redirect);
+  EXPECT_TRUE(did_match_rule);
+  EXPECT_EQ(std::string("data:application/javascript;base64,") + kContent,
+            redirect);
+}
+
+}  // namespace brave_shields
@@ -17,11 +17,14 @@
 #include "base/memory/ptr_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "base/threading/thread_restrictions.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
 #include "brave/components/brave_shields/browser/ad_block_component_filters_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_default_resource_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_engine.h"
+#include "brave/components/brave_shields/browser/ad_block_engine_cache.h"
 #include "brave/components/brave_shields/browser/ad_block_filter_list_catalog_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_regional_service_manager.h"
 #include "brave/components/brave_shields/browser/ad_block_service_helper.h"
@@ -69,7 +72,10 @@ AdBlockService::SourceProviderObserver::SourceProviderObserver(
       filters_provider_(filters_provider),
       resource_provider_(resource_provider),
       on_metadata_retrieved_(on_metadata_retrieved),
-      task_runner_(task_runner) {
+      task_runner_(task_runner),
+      compile_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {
   filters_provider_->AddObserver(this);
   filters_provider_->LoadDAT(this);
 }
@@ -86,29 +92,50 @@ void AdBlockService::SourceProviderObserver::OnDATLoaded(
   dat_buf_ = std::move(dat_buf);
   // multiple AddObserver calls are ignored
   resource_provider_->AddObserver(this);
-  resource_provider_->LoadResources(base::BindOnce(
-      &SourceProviderObserver::OnResourcesLoaded, weak_factory_.GetWeakPtr()));
+  resource_provider_->LoadResourceStore(
+      base::BindOnce(&SourceProviderObserver::OnResourcesLoaded,
+                     weak_factory_.GetWeakPtr()));
 }
 
 void AdBlockService::SourceProviderObserver::OnResourcesLoaded(
-    const std::string& resources_json) {
+    scoped_refptr<AdBlockResourceStore> resources) {
   if (dat_buf_.empty()) {
+    // The filters were already handed to an engine load. A compile still in
+    // progress picks these resources up when it is done.
+    if (compile_resources_) {
+      compile_resources_ = resources;
+    }
     task_runner_->PostTask(
-        FROM_HERE, base::BindOnce(&AdBlockEngine::AddResources, adblock_engine_,
-                                  resources_json));
+        FROM_HERE, base::BindOnce(&AdBlockEngine::UseResources, adblock_engine_,
+                                  std::move(resources)));
+    return;
+  }
+
+  const uint64_t load_id = ++load_id_;
+  if (!deserialize_) {
+    compile_resources_ = std::move(resources);
+    compile_task_runner_->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(&LoadOrCompileEngine, std::move(dat_buf_),
+                       filters_provider_->GetCompiledEngineCachePath()),
+        base::BindOnce(&SourceProviderObserver::OnEngineCompiled,
+                       weak_factory_.GetWeakPtr(), load_id));
   } else {
+    compile_resources_.reset();
     auto engine_load_callback = base::BindOnce(
         [](base::WeakPtr<AdBlockEngine> engine, bool deserialize,
-           DATFileDataBuffer dat_buf, const std::string& resources_json)
+           DATFileDataBuffer dat_buf,
+           scoped_refptr<AdBlockResourceStore> resources)
             -> absl::optional<adblock::FilterListMetadata> {
           if (engine) {
             return engine->Load(deserialize, std::move(dat_buf),
-                                resources_json);
+                                std::move(resources));
           } else {
             return absl::nullopt;
           }
         },
-        adblock_engine_, deserialize_, std::move(dat_buf_), resources_json);
+        adblock_engine_, deserialize_, std::move(dat_buf_),
+        std::move(resources));
     task_runner_->PostTaskAndReplyWithResult(
         FROM_HERE, std::move(engine_load_callback),
         base::BindOnce(&SourceProviderObserver::OnEngineReplaced,
@@ -116,6 +143,22 @@ void AdBlockService::SourceProviderObserver::OnResourcesLoaded(
   }
 }
 
+void AdBlockService::SourceProviderObserver::OnEngineCompiled(
+    uint64_t load_id,
+    std::pair<absl::optional<adblock::FilterListMetadata>,
+              std::unique_ptr<adblock::Engine>> metadata_and_engine) {
+  if (load_id != load_id_) {
+    return;
+  }
+
+  task_runner_->PostTask(
+      FROM_HERE,
+      base::BindOnce(&AdBlockEngine::LoadCompiled, adblock_engine_,
+                     std::move(metadata_and_engine.second),
+                     std::move(compile_resources_)));
+  OnEngineReplaced(std::move(metadata_and_engine.first));
+}
+
 void AdBlockService::SourceProviderObserver::OnEngineReplaced(
     const absl::optional<adblock::FilterListMetadata> maybe_metadata) {
   if (maybe_metadata) {
@@ -275,7 +318,8 @@ AdBlockRegionalServiceManager* AdBlockService::regional_service_manager() {
   if (!regional_service_manager_) {
     regional_service_manager_ =
         brave_shields::AdBlockRegionalServiceManagerFactory(
-            local_state_, locale_, component_update_service_, GetTaskRunner());
+            local_state_, locale_, component_update_service_, GetTaskRunner(),
+            component_engine_cache_dir_);
     regional_service_manager_->Init(resource_provider_.get(),
                                     filter_list_catalog_provider_.get());
   }
@@ -325,11 +369,16 @@ AdBlockService::AdBlockService(
     component_updater::ComponentUpdateService* cus,
     scoped_refptr<base::SequencedTaskRunner> task_runner,
     std::unique_ptr<AdBlockSubscriptionServiceManager>
-        subscription_service_manager)
+        subscription_service_manager,
+    const base::FilePath& user_data_dir)
     : local_state_(local_state),
       locale_(locale),
       component_update_service_(cus),
       task_runner_(task_runner),
+      component_engine_cache_dir_(
+          user_data_dir.empty()
+              ? base::FilePath()
+              : user_data_dir.Append(kAdBlockComponentEngineCacheDir)),
       custom_filters_service_(nullptr, base::OnTaskRunnerDeleter(task_runner_)),
       default_service_(nullptr, base::OnTaskRunnerDeleter(task_runner_)),
       subscription_service_manager_(std::move(subscription_service_manager)) {
@@ -339,7 +388,8 @@ AdBlockService::AdBlockService(
   default_filters_provider_ =
       std::make_unique<brave_shields::AdBlockComponentFiltersProvider>(
           component_update_service_, g_ad_block_component_id_,
-          g_ad_block_component_base64_public_key_, kAdBlockComponentName);
+          g_ad_block_component_base64_public_key_, kAdBlockComponentName,
+          component_engine_cache_dir_);
   resource_provider_ =
       std::make_unique<brave_shields::AdBlockDefaultResourceProvider>(
           component_update_service_);
@@ -10,15 +10,19 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/browser/ad_block_filters_provider.h"
 #include "brave/components/brave_shields/browser/ad_block_resource_provider.h"
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "content/public/browser/browser_thread.h"
@@ -39,6 +43,7 @@ class ComponentUpdateService;
 }  // namespace component_updater
 
 namespace adblock {
+class Engine;
 struct FilterListMetadata;
 }  // namespace adblock
 
@@ -75,12 +80,23 @@ class AdBlockService {
                      const DATFileDataBuffer& dat_buf) override;
 
     // AdBlockResourceProvider::Observer
-    void OnResourcesLoaded(const std::string& resources_json) override;
+    void OnResourcesLoaded(
+        scoped_refptr<AdBlockResourceStore> resources) override;
 
+    void OnEngineCompiled(
+        uint64_t load_id,
+        std::pair<absl::optional<adblock::FilterListMetadata>,
+                  std::unique_ptr<adblock::Engine>> metadata_and_engine);
     void OnEngineReplaced(
         const absl::optional<adblock::FilterListMetadata> maybe_metadata);
 
     bool deserialize_;
+    // Identifies the latest engine load so that a compiled engine does not
+    // replace an engine loaded after it.
+    uint64_t load_id_ = 0;
+    // The newest resources for the engine being compiled, if any. Resources
+    // loaded during the compile replace these.
+    scoped_refptr<AdBlockResourceStore> compile_resources_;
     DATFileDataBuffer dat_buf_;
     base::WeakPtr<AdBlockEngine> adblock_engine_;
     raw_ptr<AdBlockFiltersProvider> filters_provider_;    // not owned
@@ -88,6 +104,10 @@ class AdBlockService {
     base::RepeatingCallback<void(const adblock::FilterListMetadata&)>
         on_metadata_retrieved_;
     scoped_refptr<base::SequencedTaskRunner> task_runner_;
+    // Filter list text is compiled, or its cached engine deserialized, here
+    // rather than on |task_runner_|, so the current engine keeps matching
+    // requests until the new one is ready.
+    scoped_refptr<base::SequencedTaskRunner> compile_task_runner_;
 
     base::WeakPtrFactory<SourceProviderObserver> weak_factory_{this};
   };
@@ -97,7 +117,8 @@ class AdBlockService {
       std::string locale,
       component_updater::ComponentUpdateService* cus,
       scoped_refptr<base::SequencedTaskRunner> task_runner,
-      std::unique_ptr<AdBlockSubscriptionServiceManager> manager);
+      std::unique_ptr<AdBlockSubscriptionServiceManager> manager,
+      const base::FilePath& user_data_dir);
   AdBlockService(const AdBlockService&) = delete;
   AdBlockService& operator=(const AdBlockService&) = delete;
   ~AdBlockService();
@@ -158,6 +179,10 @@ class AdBlockService {
 
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
 
+  // Engines compiled from the default and regional filter list components
+  // are persisted here.
+  base::FilePath component_engine_cache_dir_;
+
   std::unique_ptr<brave_shields::AdBlockDefaultResourceProvider>
       resource_provider_;
   std::unique_ptr<brave_shields::AdBlockCustomFiltersProvider>
@@ -0,0 +1,159 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/test/task_environment.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "brave/components/brave_shields/browser/ad_block_engine.h"
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
+#include "brave/components/brave_shields/browser/ad_block_service.h"
+#include "brave/components/brave_shields/browser/test_filters_provider.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+// npm run test -- brave_unit_tests --filter=AdBlockSourceProviderObserverTest.*
+
+namespace brave_shields {
+
+namespace {
+
+constexpr char kRules[] = "||example.com/ad.js$script,redirect=noop.js";
+
+constexpr char kContent[] =
+    "KGZ1bmN0aW9uKCkgewogICAgJ3VzZSBzdHJpY3QnOwp9KSgpOwo=";
+
+constexpr char kResources[] = R"([{
+    "name": "noopjs",
+    "aliases": ["noop.js"],
+    "kind": {"mime": "application/javascript"},
+    "content": "KGZ1bmN0aW9uKCkgewogICAgJ3VzZSBzdHJpY3QnOwp9KSgpOwo="
+  }])";
+
+// Lets the test announce new resources like the resources component does
+// when it is updated, and load them asynchronously like reading them from
+// disk does.
+class TestResourcesProvider : public TestFiltersProvider {
+ public:
+  using TestFiltersProvider::TestFiltersProvider;
+
+  void LoadResources(
+      base::OnceCallback<void(const std::string& resources_json)> cb) override {
+    ++load_count_;
+    if (!load_async_) {
+      TestFiltersProvider::LoadResources(std::move(cb));
+      return;
+    }
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE,
+        base::BindOnce(&TestResourcesProvider::LoadResourcesNow,
+                       base::Unretained(this), std::move(cb)));
+  }
+
+  void UpdateResources(const std::string& resources_json) {
+    OnResourcesLoaded(resources_json);
+  }
+
+  void set_load_async(bool load_async) { load_async_ = load_async; }
+  size_t load_count() const { return load_count_; }
+
+ private:
+  void LoadResourcesNow(
+      base::OnceCallback<void(const std::string& resources_json)> cb) {
+    TestFiltersProvider::LoadResources(std::move(cb));
+  }
+
+  bool load_async_ = false;
+  size_t load_count_ = 0;
+};
+
+}  // namespace
+
+class AdBlockSourceProviderObserverTest : public testing::Test {
+ protected:
+  // Returns the redirect |engine| uses for the script blocked by kRules, or
+  // an empty string if the script isn't blocked.
+  std::string GetRedirect(AdBlockEngine* engine) {
+    bool did_match_rule = false;
+    bool did_match_exception = false;
+    bool did_match_important = false;
+    std::string mock_data_url;
+    engine->ShouldStartRequest(
+        GURL("https://example.com/ad.js"), blink::mojom::ResourceType::kScript,
+        "example.net", false, &did_match_rule, &did_match_exception,
+        &did_match_important, &mock_data_url);
+    return did_match_rule ? mock_data_url : std::string();
+  }
+
+  base::test::TaskEnvironment task_environment_;
+};
+
+TEST_F(AdBlockSourceProviderObserverTest, ResourcesLoadedDuringCompile) {
+  AdBlockEngine engine;
+  TestResourcesProvider provider(kRules, "[]");
+  AdBlockService::SourceProviderObserver observer(
+      engine.AsWeakPtr(), &provider, &provider,
+      base::SequencedTaskRunnerHandle::Get());
+
+  // The filters are still being compiled when newer resources arrive. The
+  // compiled engine is used with them rather than thrown away.
+  provider.UpdateResources(kResources);
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(std::string("data:application/javascript;base64,") + kContent,
+            GetRedirect(&engine));
+}
+
+TEST_F(AdBlockSourceProviderObserverTest, ResourcesLoadedAfterCompile) {
+  AdBlockEngine engine;
+  TestResourcesProvider provider(kRules, "[]");
+  AdBlockService::SourceProviderObserver observer(
+      engine.AsWeakPtr(), &provider, &provider,
+      base::SequencedTaskRunnerHandle::Get());
+  task_environment_.RunUntilIdle();
+
+  provider.UpdateResources(kResources);
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(std::string("data:application/javascript;base64,") + kContent,
+            GetRedirect(&engine));
+}
+
+TEST_F(AdBlockSourceProviderObserverTest, EnginesShareResourceStore) {
+  AdBlockEngine engine1;
+  AdBlockEngine engine2;
+  TestResourcesProvider provider(kRules, kResources);
+  // Both engines ask for resources before the first load is done, like at
+  // startup.
+  provider.set_load_async(true);
+  AdBlockService::SourceProviderObserver observer1(
+      engine1.AsWeakPtr(), &provider, &provider,
+      base::SequencedTaskRunnerHandle::Get());
+  AdBlockService::SourceProviderObserver observer2(
+      engine2.AsWeakPtr(), &provider, &provider,
+      base::SequencedTaskRunnerHandle::Get());
+  task_environment_.RunUntilIdle();
+
+  const std::string redirect =
+      std::string("data:application/javascript;base64,") + kContent;
+  EXPECT_EQ(redirect, GetRedirect(&engine1));
+  EXPECT_EQ(redirect, GetRedirect(&engine2));
+
+  scoped_refptr<AdBlockResourceStore> resources;
+  provider.LoadResourceStore(base::BindOnce(
+      [](scoped_refptr<AdBlockResourceStore>* out,
+         scoped_refptr<AdBlockResourceStore> resources) {
+        *out = std::move(resources);
+      },
+      &resources));
+  ASSERT_TRUE(resources);
+  EXPECT_EQ(1u, provider.load_count());
+  EXPECT_EQ(1u, resources->GetParseCountForTesting());
+}
+
+}  // namespace brave_shields
@@ -7,8 +7,10 @@
 
 #include <utility>
 
+#include "base/files/file_path.h"
 #include "base/logging.h"
 #include "base/task/thread_pool.h"
+#include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "brave/components/brave_shields/common/pref_names.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_task_traits.h"
@@ -33,4 +35,9 @@ void AdBlockSubscriptionFiltersProvider::LoadDATBuffer(
       base::BindOnce(std::move(cb), false));
 }
 
+base::FilePath AdBlockSubscriptionFiltersProvider::GetCompiledEngineCachePath()
+    const {
+  return list_file_.DirName().Append(kCustomSubscriptionCompiledEngine);
+}
+
 }  // namespace brave_shields
@@ -39,6 +39,15 @@ const char kObsoleteFingerprinting[] = "fingerprinting";
 const base::FilePath::CharType kCustomSubscriptionListText[] =
     FILE_PATH_LITERAL("list_text.txt");
 
+// Filename for the engine compiled from a custom filter list subscription
+const base::FilePath::CharType kCustomSubscriptionCompiledEngine[] =
+    FILE_PATH_LITERAL("list_engine.dat");
+
+// Directory under the user data directory for engines compiled from the
+// default and regional filter list components
+const base::FilePath::CharType kAdBlockComponentEngineCacheDir[] =
+    FILE_PATH_LITERAL("AdBlockEngineCache");
+
 const char kCookieListUuid[] = "AC023D22-AE88-4060-A978-4FEEEC4221693";
 
 constexpr webui::LocalizedString kLocalizedStrings[] = {
@@ -75,6 +75,13 @@ const base::Feature kCosmeticFilteringExtraPerfMetrics{
 const base::Feature kCosmeticFilteringJsPerformance{
     "CosmeticFilteringJsPerformance", base::FEATURE_DISABLED_BY_DEFAULT};
 
+// When enabled, class names and ids for generic cosmetic filters are collected
+// by Blink instead of a MutationObserver in content_cosmetic.ts. The
+// CosmeticFilteringJsPerformance parameters only apply to the script path.
+const base::Feature kCosmeticFilteringNativeClassIdCollection{
+    "CosmeticFilteringNativeClassIdCollection",
+    base::FEATURE_ENABLED_BY_DEFAULT};
+
 constexpr base::FeatureParam<std::string>
     kCosmeticFilteringSubFrameFirstSelectorsPollingDelayMs{
         &kCosmeticFilteringJsPerformance, "subframes_first_query_delay_ms",
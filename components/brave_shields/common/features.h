@@ -29,6 +29,7 @@ extern const base::Feature kBraveDarkModeBlock;
 extern const base::Feature kCosmeticFilteringSyncLoad;
 extern const base::Feature kCosmeticFilteringExtraPerfMetrics;
 extern const base::Feature kCosmeticFilteringJsPerformance;
+extern const base::Feature kCosmeticFilteringNativeClassIdCollection;
 extern const base::FeatureParam<std::string>
     kCosmeticFilteringSubFrameFirstSelectorsPollingDelayMs;
 extern const base::FeatureParam<std::string>
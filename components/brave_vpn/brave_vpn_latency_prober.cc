@@ -0,0 +1,108 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_vpn/brave_vpn_latency_prober.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/logging.h"
+#include "net/base/load_flags.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/traffic_annotation/network_traffic_annotation.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/shared_url_loader_factory.h"
+#include "services/network/public/cpp/simple_url_loader.h"
+#include "url/gurl.h"
+#include "url/url_constants.h"
+
+namespace brave_vpn {
+
+namespace {
+
+// Hosts which take longer than this are not worth connecting to.
+constexpr base::TimeDelta kProbeTimeout = base::Seconds(3);
+
+net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
+  return net::DefineNetworkTrafficAnnotation("brave_vpn_latency_prober", R"(
+      semantics {
+        sender: "Brave VPN Service"
+        description:
+          "Measures the latency to the Brave VPN hosts of the region the "
+          "user connects to, so that the closest host is picked."
+        trigger:
+          "Triggered by user connecting the Brave VPN."
+        data:
+          "No user data is sent."
+        destination: WEBSITE
+      }
+      policy {
+        cookies_allowed: NO
+        policy_exception_justification:
+          "Not implemented."
+      }
+    )");
+}
+
+}  // namespace
+
+BraveVPNLatencyProber::BraveVPNLatencyProber(
+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
+    : url_loader_factory_(std::move(url_loader_factory)) {}
+
+BraveVPNLatencyProber::~BraveVPNLatencyProber() = default;
+
+void BraveVPNLatencyProber::Probe(const std::string& hostname,
+                                  ProbeCallback callback) {
+  const GURL url(std::string(url::kHttpsScheme) + "://" + hostname);
+  if (!url.is_valid()) {
+    std::move(callback).Run(absl::nullopt);
+    return;
+  }
+
+  auto request = std::make_unique<network::ResourceRequest>();
+  request->url = url;
+  request->method = net::HttpRequestHeaders::kHeadMethod;
+  request->credentials_mode = network::mojom::CredentialsMode::kOmit;
+  request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE;
+
+  auto loader = network::SimpleURLLoader::Create(
+      std::move(request), GetNetworkTrafficAnnotationTag());
+  loader->SetTimeoutDuration(kProbeTimeout);
+  loader->SetAllowHttpErrorResults(true);
+
+  auto loader_it = url_loaders_.insert(url_loaders_.end(), std::move(loader));
+  (*loader_it)
+      ->DownloadHeadersOnly(
+          url_loader_factory_.get(),
+          base::BindOnce(&BraveVPNLatencyProber::OnProbeComplete,
+                         weak_ptr_factory_.GetWeakPtr(), loader_it,
+                         base::TimeTicks::Now(), std::move(callback)));
+}
+
+void BraveVPNLatencyProber::OnProbeComplete(
+    URLLoaderList::iterator loader_it,
+    base::TimeTicks start_time,
+    ProbeCallback callback,
+    scoped_refptr<net::HttpResponseHeaders> headers) {
+  const base::TimeDelta elapsed = base::TimeTicks::Now() - start_time;
+  const int net_error = (*loader_it)->NetError();
+  url_loaders_.erase(loader_it);
+
+  // A host which completed the TLS handshake but has no valid certificate for
+  // its hostname was still reached.
+  if (headers || net::IsCertificateError(net_error)) {
+    std::move(callback).Run(elapsed);
+    return;
+  }
+
+  VLOG(2) << __func__
+          << " : probe failed with " << net::ErrorToString(net_error);
+  std::move(callback).Run(absl::nullopt);
+}
+
+}  // namespace brave_vpn
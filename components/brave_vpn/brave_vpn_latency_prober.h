@@ -0,0 +1,64 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_VPN_BRAVE_VPN_LATENCY_PROBER_H_
+#define BRAVE_COMPONENTS_BRAVE_VPN_BRAVE_VPN_LATENCY_PROBER_H_
+
+#include <list>
+#include <memory>
+#include <string>
+
+#include "base/callback.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace net {
+class HttpResponseHeaders;
+}  // namespace net
+
+namespace network {
+class SharedURLLoaderFactory;
+class SimpleURLLoader;
+}  // namespace network
+
+namespace brave_vpn {
+
+// Measures the round trip time of a HEAD request to a VPN host over HTTPS. The
+// request is not cached and the host is not expected to serve anything, so the
+// time is dominated by the TCP connect and the TLS handshake.
+class BraveVPNLatencyProber {
+ public:
+  // Runs with the round trip time, or with absl::nullopt if the host could not
+  // be reached.
+  using ProbeCallback =
+      base::OnceCallback<void(absl::optional<base::TimeDelta>)>;
+
+  explicit BraveVPNLatencyProber(
+      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
+  BraveVPNLatencyProber(const BraveVPNLatencyProber&) = delete;
+  BraveVPNLatencyProber& operator=(const BraveVPNLatencyProber&) = delete;
+  ~BraveVPNLatencyProber();
+
+  // Probes can run in parallel.
+  void Probe(const std::string& hostname, ProbeCallback callback);
+
+ private:
+  using URLLoaderList = std::list<std::unique_ptr<network::SimpleURLLoader>>;
+
+  void OnProbeComplete(URLLoaderList::iterator loader_it,
+                       base::TimeTicks start_time,
+                       ProbeCallback callback,
+                       scoped_refptr<net::HttpResponseHeaders> headers);
+
+  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
+  URLLoaderList url_loaders_;
+  base::WeakPtrFactory<BraveVPNLatencyProber> weak_ptr_factory_{this};
+};
+
+}  // namespace brave_vpn
+
+#endif  // BRAVE_COMPONENTS_BRAVE_VPN_BRAVE_VPN_LATENCY_PROBER_H_
@@ -10,6 +10,8 @@
 
 #include "base/bind.h"
 #include "base/check_is_test.h"
+#include "base/containers/flat_map.h"
+#include "base/feature_list.h"
 #include "base/json/json_reader.h"
 #include "base/power_monitor/power_monitor.h"
 #include "brave/components/brave_vpn/brave_vpn_api_request.h"
@@ -17,6 +19,7 @@
 #include "brave/components/brave_vpn/brave_vpn_data_types.h"
 #include "brave/components/brave_vpn/brave_vpn_service_helper.h"
 #include "brave/components/brave_vpn/brave_vpn_utils.h"
+#include "brave/components/brave_vpn/features.h"
 #include "brave/components/brave_vpn/pref_names.h"
 #include "brave/components/brave_vpn/vpn_response_parser.h"
 #include "components/prefs/pref_service.h"
@@ -26,6 +29,15 @@ namespace brave_vpn {
 
 using ConnectionState = mojom::ConnectionState;
 
+namespace {
+
+// Probing every host of a region would take long on slow networks, and the
+// hosts with the lowest capacity scores are unlikely to be picked anyway.
+constexpr size_t kMaxProbedHostnames = 5;
+constexpr base::TimeDelta kHostnameLatencyExpiry = base::Minutes(10);
+
+}  // namespace
+
 BraveVPNOSConnectionAPI::BraveVPNOSConnectionAPI() {
   base::PowerMonitor::AddPowerSuspendObserver(this);
   net::NetworkChangeNotifier::AddDNSObserver(this);
@@ -168,6 +180,22 @@ bool BraveVPNOSConnectionAPI::GetIsSimulation() const {
   return false;
 }
 
+void BraveVPNOSConnectionAPI::ProbeHostnameImpl(
+    const std::string& hostname,
+    BraveVPNLatencyProber::ProbeCallback callback) {
+  if (!url_loader_factory_) {
+    CHECK_IS_TEST();
+    std::move(callback).Run(absl::nullopt);
+    return;
+  }
+
+  if (!latency_prober_) {
+    latency_prober_ =
+        std::make_unique<BraveVPNLatencyProber>(url_loader_factory_);
+  }
+  latency_prober_->Probe(hostname, std::move(callback));
+}
+
 void BraveVPNOSConnectionAPI::OnCreated() {
   VLOG(2) << __func__;
 
@@ -267,6 +295,9 @@ void BraveVPNOSConnectionAPI::OnDNSChanged() {
           net::NetworkChangeNotifier::CONNECTION_UNKNOWN)
     return;
 
+  // Latencies measured from the previous network are meaningless now.
+  hostname_latencies_.clear();
+
   VLOG(2) << __func__ << " Should reconnect:" << reconnect_on_resume_;
   if (reconnect_on_resume_) {
     Connect();
@@ -341,6 +372,7 @@ void BraveVPNOSConnectionAPI::FetchHostnamesForRegion(const std::string& name) {
 
   // Hostname will be replaced with latest one.
   hostname_.reset();
+  probe_weak_factory_.InvalidateWeakPtrs();
 
   if (!GetAPIRequest()) {
     CHECK_IS_TEST();
@@ -391,7 +423,91 @@ void BraveVPNOSConnectionAPI::ParseAndCacheHostnames(
     return;
   }
 
-  hostname_ = PickBestHostname(hostnames);
+  if (base::FeatureList::IsEnabled(features::kBraveVPNProbeHostnameLatency)) {
+    ProbeHostnames(region, hostnames);
+    return;
+  }
+
+  OnPickHostname(region, PickBestHostname(hostnames));
+}
+
+void BraveVPNOSConnectionAPI::ProbeHostnames(
+    const std::string& region,
+    const std::vector<Hostname>& hostnames) {
+  probe_weak_factory_.InvalidateWeakPtrs();
+  probing_region_ = region;
+  probing_hostnames_ = GetHostnamesToProbe(hostnames, kMaxProbedHostnames);
+  if (probing_hostnames_.empty()) {
+    OnPickHostname(region, PickBestHostname(hostnames));
+    return;
+  }
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+  std::vector<std::string> hostnames_to_probe;
+  for (const auto& hostname : probing_hostnames_) {
+    auto latency_it = hostname_latencies_.find(hostname.hostname);
+    if (latency_it != hostname_latencies_.end() &&
+        now - latency_it->second.probed_at < kHostnameLatencyExpiry) {
+      continue;
+    }
+    hostnames_to_probe.push_back(hostname.hostname);
+  }
+
+  VLOG(2) << __func__ << " : probing " << hostnames_to_probe.size() << " of "
+          << probing_hostnames_.size() << " hostnames for " << region;
+  pending_probes_ = static_cast<int>(hostnames_to_probe.size());
+  if (!pending_probes_) {
+    OnProbeHostnamesComplete();
+    return;
+  }
+
+  // Probes run in parallel and may complete synchronously, so
+  // |pending_probes_| is set before any of them starts.
+  for (const auto& hostname : hostnames_to_probe) {
+    ProbeHostnameImpl(
+        hostname, base::BindOnce(&BraveVPNOSConnectionAPI::OnProbeHostname,
+                                 probe_weak_factory_.GetWeakPtr(), hostname));
+  }
+}
+
+void BraveVPNOSConnectionAPI::OnProbeHostname(
+    const std::string& hostname,
+    absl::optional<base::TimeDelta> latency) {
+  VLOG(2) << __func__ << " : " << hostname << " : "
+          << (latency ? *latency : base::TimeDelta::Max());
+  hostname_latencies_[hostname] = {latency, base::TimeTicks::Now()};
+
+  DCHECK_GT(pending_probes_, 0);
+  if (--pending_probes_)
+    return;
+
+  OnProbeHostnamesComplete();
+}
+
+void BraveVPNOSConnectionAPI::OnProbeHostnamesComplete() {
+  if (cancel_connecting_) {
+    UpdateAndNotifyConnectionStateChange(ConnectionState::DISCONNECTED);
+    cancel_connecting_ = false;
+    return;
+  }
+
+  base::flat_map<std::string, base::TimeDelta> latencies;
+  for (const auto& hostname : probing_hostnames_) {
+    auto latency_it = hostname_latencies_.find(hostname.hostname);
+    if (latency_it != hostname_latencies_.end() &&
+        latency_it->second.latency) {
+      latencies[hostname.hostname] = *latency_it->second.latency;
+    }
+  }
+
+  OnPickHostname(probing_region_,
+                 PickLowestLatencyHostname(probing_hostnames_, latencies));
+}
+
+void BraveVPNOSConnectionAPI::OnPickHostname(
+    const std::string& region,
+    std::unique_ptr<Hostname> hostname) {
+  hostname_ = std::move(hostname);
   if (hostname_->hostname.empty()) {
     VLOG(2) << __func__ << " : got empty hostnames list for " << region;
     UpdateAndNotifyConnectionStateChange(ConnectionState::CONNECT_FAILED);
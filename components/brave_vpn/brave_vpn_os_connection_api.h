@@ -6,20 +6,26 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_VPN_BRAVE_VPN_OS_CONNECTION_API_H_
 #define BRAVE_COMPONENTS_BRAVE_VPN_BRAVE_VPN_OS_CONNECTION_API_H_
 
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "base/power_monitor/power_observer.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_vpn/brave_vpn_connection_info.h"
+#include "brave/components/brave_vpn/brave_vpn_latency_prober.h"
 #include "brave/components/brave_vpn/mojom/brave_vpn.mojom.h"
 #include "net/base/network_change_notifier.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 class PrefService;
@@ -89,6 +95,10 @@ class BraveVPNOSConnectionAPI : public base::PowerSuspendObserver,
   virtual void RemoveVPNConnectionImpl(const std::string& name) = 0;
   virtual void CheckConnectionImpl(const std::string& name) = 0;
   virtual bool GetIsSimulation() const;
+  // Measures the round trip time to |hostname| when picking a host. Runs
+  // |callback| with absl::nullopt if |hostname| could not be reached.
+  virtual void ProbeHostnameImpl(const std::string& hostname,
+                                 BraveVPNLatencyProber::ProbeCallback callback);
 
   // Subclass should call below callbacks whenever corresponding event happens.
   void OnCreated();
@@ -104,6 +114,12 @@ class BraveVPNOSConnectionAPI : public base::PowerSuspendObserver,
  private:
   friend class BraveVPNServiceTest;
 
+  struct HostnameLatency {
+    // absl::nullopt if the host could not be reached.
+    absl::optional<base::TimeDelta> latency;
+    base::TimeTicks probed_at;
+  };
+
   // base::PowerMonitor
   void OnSuspend() override;
   void OnResume() override;
@@ -121,6 +137,13 @@ class BraveVPNOSConnectionAPI : public base::PowerSuspendObserver,
                         bool success);
   void ParseAndCacheHostnames(const std::string& region,
                               const base::Value::List& hostnames_value);
+  void ProbeHostnames(const std::string& region,
+                      const std::vector<Hostname>& hostnames);
+  void OnProbeHostname(const std::string& hostname,
+                       absl::optional<base::TimeDelta> latency);
+  void OnProbeHostnamesComplete();
+  void OnPickHostname(const std::string& region,
+                      std::unique_ptr<Hostname> hostname);
   void OnGetSubscriberCredentialV12(const std::string& subscriber_credential,
                                     bool success);
   void OnGetProfileCredentials(const std::string& profile_credential,
@@ -140,9 +163,19 @@ class BraveVPNOSConnectionAPI : public base::PowerSuspendObserver,
   BraveVPNConnectionInfo connection_info_;
   raw_ptr<PrefService> local_prefs_ = nullptr;
   std::unique_ptr<Hostname> hostname_;
+  // Hostnames of |probing_region_| which are being probed.
+  std::string probing_region_;
+  std::vector<Hostname> probing_hostnames_;
+  int pending_probes_ = 0;
+  // Latencies are cached for a while because they are measured from the
+  // current network, and cleared when the network changes.
+  std::map<std::string, HostnameLatency> hostname_latencies_;
+  std::unique_ptr<BraveVPNLatencyProber> latency_prober_;
   base::ObserverList<Observer> observers_;
   std::unique_ptr<BraveVpnAPIRequest> api_request_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
+  // Invalidated when a new host is picked, so that stale probes are ignored.
+  base::WeakPtrFactory<BraveVPNOSConnectionAPI> probe_weak_factory_{this};
 };
 
 }  // namespace brave_vpn
@@ -5,6 +5,8 @@
 
 #include "brave/components/brave_vpn/brave_vpn_os_connection_api_sim.h"
 
+#include <utility>
+
 #include "base/logging.h"
 #include "base/notreached.h"
 #include "base/rand_util.h"
@@ -87,6 +89,27 @@ bool BraveVPNOSConnectionAPISim::GetIsSimulation() const {
   return true;
 }
 
+void BraveVPNOSConnectionAPISim::SetHostnameLatencyForTesting(
+    const std::string& hostname,
+    absl::optional<base::TimeDelta> latency) {
+  hostname_latencies_[hostname] = latency;
+}
+
+void BraveVPNOSConnectionAPISim::ProbeHostnameImpl(
+    const std::string& hostname,
+    BraveVPNLatencyProber::ProbeCallback callback) {
+  auto latency_it = hostname_latencies_.find(hostname);
+  if (latency_it == hostname_latencies_.end()) {
+    BraveVPNOSConnectionAPI::ProbeHostnameImpl(hostname, std::move(callback));
+    return;
+  }
+
+  const absl::optional<base::TimeDelta> latency = latency_it->second;
+  base::SequencedTaskRunnerHandle::Get()->PostDelayedTask(
+      FROM_HERE, base::BindOnce(std::move(callback), latency),
+      latency.value_or(base::TimeDelta()));
+}
+
 void BraveVPNOSConnectionAPISim::OnCreated(const std::string& name,
                                            bool success) {
   if (!success)
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
 #include "base/no_destructor.h"
 #include "brave/components/brave_vpn/brave_vpn_os_connection_api.h"
@@ -20,6 +21,12 @@ class BraveVPNOSConnectionAPISim : public BraveVPNOSConnectionAPI {
   BraveVPNOSConnectionAPISim& operator=(const BraveVPNOSConnectionAPISim&) =
       delete;
 
+  // Probes of |hostname| complete after |latency| instead of reaching the
+  // host, or fail if |latency| is absl::nullopt. Hostnames without a latency
+  // are probed over the network, e.g. to reach local stand-in endpoints.
+  void SetHostnameLatencyForTesting(const std::string& hostname,
+                                    absl::optional<base::TimeDelta> latency);
+
  protected:
   friend class base::NoDestructor<BraveVPNOSConnectionAPISim>;
 
@@ -33,6 +40,9 @@ class BraveVPNOSConnectionAPISim : public BraveVPNOSConnectionAPI {
   void DisconnectImpl(const std::string& name) override;
   void CheckConnectionImpl(const std::string& name) override;
   bool GetIsSimulation() const override;
+  void ProbeHostnameImpl(
+      const std::string& hostname,
+      BraveVPNLatencyProber::ProbeCallback callback) override;
 
  private:
   void OnCreated(const std::string& name, bool success);
@@ -43,6 +53,8 @@ class BraveVPNOSConnectionAPISim : public BraveVPNOSConnectionAPI {
   void OnRemoved(const std::string& name, bool success);
 
   bool disconnect_requested_ = false;
+  base::flat_map<std::string, absl::optional<base::TimeDelta>>
+      hostname_latencies_;
   base::WeakPtrFactory<BraveVPNOSConnectionAPISim> weak_factory_{this};
 };
 
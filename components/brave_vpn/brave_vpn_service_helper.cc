@@ -105,6 +105,51 @@ std::unique_ptr<Hostname> PickBestHostname(
   return std::make_unique<Hostname>(filtered_hostnames[0]);
 }
 
+std::vector<Hostname> GetHostnamesToProbe(
+    const std::vector<Hostname>& hostnames,
+    size_t max_count) {
+  std::vector<Hostname> filtered_hostnames;
+  std::copy_if(hostnames.begin(), hostnames.end(),
+               std::back_inserter(filtered_hostnames),
+               [](const Hostname& hostname) { return !hostname.is_offline; });
+
+  std::stable_sort(filtered_hostnames.begin(), filtered_hostnames.end(),
+                   [](const Hostname& a, const Hostname& b) {
+                     return a.capacity_score > b.capacity_score;
+                   });
+
+  if (filtered_hostnames.size() > max_count)
+    filtered_hostnames.resize(max_count);
+  return filtered_hostnames;
+}
+
+std::unique_ptr<Hostname> PickLowestLatencyHostname(
+    const std::vector<Hostname>& hostnames,
+    const base::flat_map<std::string, base::TimeDelta>& latencies) {
+  const Hostname* best_hostname = nullptr;
+  base::TimeDelta best_latency;
+  for (const auto& hostname : hostnames) {
+    if (hostname.is_offline)
+      continue;
+
+    const auto latency_it = latencies.find(hostname.hostname);
+    if (latency_it == latencies.end())
+      continue;
+
+    if (!best_hostname || latency_it->second < best_latency ||
+        (latency_it->second == best_latency &&
+         hostname.capacity_score > best_hostname->capacity_score)) {
+      best_hostname = &hostname;
+      best_latency = latency_it->second;
+    }
+  }
+
+  if (!best_hostname)
+    return PickBestHostname(hostnames);
+
+  return std::make_unique<Hostname>(*best_hostname);
+}
+
 std::vector<Hostname> ParseHostnames(const base::Value::List& hostnames_value) {
   std::vector<Hostname> hostnames;
   for (const auto& value : hostnames_value) {
@@ -10,6 +10,8 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "brave/components/brave_vpn/mojom/brave_vpn.mojom.h"
 
@@ -23,6 +25,16 @@ std::string GetBraveVPNPaymentsEnv(const std::string& env);
 base::Value::Dict GetValueFromRegion(const mojom::Region& region);
 std::unique_ptr<Hostname> PickBestHostname(
     const std::vector<Hostname>& hostnames);
+// Returns up to |max_count| online hostnames, highest capacity score first.
+std::vector<Hostname> GetHostnamesToProbe(
+    const std::vector<Hostname>& hostnames,
+    size_t max_count);
+// Picks the hostname with the lowest latency in |latencies|, preferring the
+// higher capacity score on a tie. Falls back to |PickBestHostname| if none of
+// |hostnames| has a latency.
+std::unique_ptr<Hostname> PickLowestLatencyHostname(
+    const std::vector<Hostname>& hostnames,
+    const base::flat_map<std::string, base::TimeDelta>& latencies);
 std::vector<Hostname> ParseHostnames(const base::Value::List& hostnames);
 std::vector<mojom::Region> ParseRegionList(
     const base::Value::List& region_list);
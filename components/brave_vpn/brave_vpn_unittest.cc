@@ -12,13 +12,16 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/run_loop.h"
 #include "base/test/metrics/histogram_tester.h"
+#include "base/test/scoped_command_line.h"
 #include "base/test/scoped_feature_list.h"
 #include "brave/components/brave_vpn/brave_vpn_os_connection_api.h"
+#include "brave/components/brave_vpn/brave_vpn_os_connection_api_sim.h"
 #include "brave/components/brave_vpn/brave_vpn_service.h"
 #include "brave/components/brave_vpn/brave_vpn_service_helper.h"
 #include "brave/components/brave_vpn/brave_vpn_utils.h"
 #include "brave/components/brave_vpn/features.h"
 #include "brave/components/brave_vpn/pref_names.h"
+#include "brave/components/brave_vpn/switches.h"
 #include "brave/components/skus/browser/pref_names.h"
 #include "brave/components/skus/browser/skus_context_impl.h"
 #include "brave/components/skus/browser/skus_service_impl.h"
@@ -360,6 +363,12 @@ class BraveVPNServiceTest : public testing::Test {
     return service_->GetBraveVPNConnectionAPI();
   }
 
+  BraveVPNOSConnectionAPISim* GetBraveVPNConnectionAPISim() {
+    DCHECK(service_->is_simulation_);
+    return static_cast<BraveVPNOSConnectionAPISim*>(
+        GetBraveVPNConnectionAPI());
+  }
+
   void SetDeviceRegion(const std::string& name) {
     service_->SetDeviceRegion(name);
   }
@@ -640,6 +649,63 @@ TEST_F(BraveVPNServiceTest, HostnamesTest) {
   EXPECT_FALSE(hostname());
 }
 
+TEST_F(BraveVPNServiceTest, HostnamesLatencyTest) {
+  base::test::ScopedFeatureList feature_list(
+      features::kBraveVPNProbeHostnameLatency);
+  base::test::ScopedCommandLine command_line;
+  command_line.GetProcessCommandLine()->AppendSwitch(
+      switches::kBraveVPNSimulation);
+  ResetVpnService();
+
+  auto* api = GetBraveVPNConnectionAPISim();
+  api->SetHostnameLatencyForTesting("host-1.brave.com", base::Milliseconds(90));
+  api->SetHostnameLatencyForTesting("host-2.brave.com",
+                                    base::Milliseconds(300));
+  api->SetHostnameLatencyForTesting("host-3.brave.com", absl::nullopt);
+  api->SetHostnameLatencyForTesting("host-4.brave.com", base::Milliseconds(40));
+  api->SetHostnameLatencyForTesting("host-5.brave.com", base::Milliseconds(40));
+
+  // No host is picked until all probes completed.
+  hostname().reset();
+  OnFetchHostnames("region-a", GetHostnamesData(), true);
+  EXPECT_FALSE(hostname());
+  task_environment_.FastForwardBy(base::Milliseconds(100));
+  EXPECT_FALSE(hostname());
+  task_environment_.FastForwardBy(base::Milliseconds(200));
+  // host-4 and host-5 are equally fast, host-5 has the higher capacity score.
+  ASSERT_TRUE(hostname());
+  EXPECT_EQ("host-5.brave.com", hostname()->hostname);
+
+  // Cached latencies are used until they expire.
+  api->SetHostnameLatencyForTesting("host-1.brave.com", base::Milliseconds(10));
+  hostname().reset();
+  OnFetchHostnames("region-a", GetHostnamesData(), true);
+  ASSERT_TRUE(hostname());
+  EXPECT_EQ("host-5.brave.com", hostname()->hostname);
+
+  task_environment_.FastForwardBy(base::Minutes(10));
+  hostname().reset();
+  OnFetchHostnames("region-a", GetHostnamesData(), true);
+  EXPECT_FALSE(hostname());
+  task_environment_.FastForwardBy(base::Milliseconds(300));
+  ASSERT_TRUE(hostname());
+  EXPECT_EQ("host-1.brave.com", hostname()->hostname);
+
+  // The host with the highest capacity score is picked if no host could be
+  // reached.
+  for (const auto* host : {"host-1.brave.com", "host-2.brave.com",
+                           "host-3.brave.com", "host-4.brave.com",
+                           "host-5.brave.com"}) {
+    api->SetHostnameLatencyForTesting(host, absl::nullopt);
+  }
+  task_environment_.FastForwardBy(base::Minutes(10));
+  hostname().reset();
+  OnFetchHostnames("region-a", GetHostnamesData(), true);
+  task_environment_.RunUntilIdle();
+  ASSERT_TRUE(hostname());
+  EXPECT_EQ("host-2.brave.com", hostname()->hostname);
+}
+
 TEST_F(BraveVPNServiceTest, LoadPurchasedStateTest) {
   std::string env = skus::GetDefaultEnvironment();
   std::string domain = skus::GetDomain("vpn", env);
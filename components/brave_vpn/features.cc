@@ -21,6 +21,11 @@ const base::Feature kBraveVPN {
 #endif
 };
 
+// Picks the host of a region with the lowest latency instead of the one with
+// the highest capacity score.
+const base::Feature kBraveVPNProbeHostnameLatency{
+    "BraveVPNProbeHostnameLatency", base::FEATURE_DISABLED_BY_DEFAULT};
+
 }  // namespace features
 
 }  // namespace brave_vpn
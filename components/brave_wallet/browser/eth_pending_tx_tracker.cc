@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "base/logging.h"
 #include "base/synchronization/lock.h"
@@ -35,16 +36,23 @@ bool EthPendingTxTracker::UpdatePendingTransactions(size_t* num_pending) {
 
   auto pending_transactions = tx_state_manager_->GetTransactionsByStatus(
       mojom::TransactionStatus::Submitted, absl::nullopt);
+  std::vector<std::string> ids;
+  std::vector<std::string> tx_hashes;
   for (const auto& pending_transaction : pending_transactions) {
     if (IsNonceTaken(static_cast<const EthTxMeta&>(*pending_transaction))) {
       DropTransaction(pending_transaction.get());
       continue;
     }
-    std::string id = pending_transaction->id();
-    json_rpc_service_->GetTransactionReceipt(
-        pending_transaction->tx_hash(),
-        base::BindOnce(&EthPendingTxTracker::OnGetTxReceipt,
-                       weak_factory_.GetWeakPtr(), std::move(id)));
+    ids.push_back(pending_transaction->id());
+    tx_hashes.push_back(pending_transaction->tx_hash());
+  }
+
+  // Receipts of all pending transactions are fetched together so a new block
+  // costs one request instead of one per pending transaction.
+  if (!tx_hashes.empty()) {
+    json_rpc_service_->GetTransactionReceipts(
+        tx_hashes, base::BindOnce(&EthPendingTxTracker::OnGetTxReceipts,
+                                  weak_factory_.GetWeakPtr(), std::move(ids)));
   }
 
   nonce_lock->Release();
@@ -74,6 +82,19 @@ void EthPendingTxTracker::Reset() {
   dropped_blocks_counter_.clear();
 }
 
+void EthPendingTxTracker::OnGetTxReceipts(
+    std::vector<std::string> ids,
+    std::vector<absl::optional<TransactionReceipt>> receipts) {
+  DCHECK_EQ(ids.size(), receipts.size());
+  for (size_t i = 0; i < ids.size() && i < receipts.size(); ++i) {
+    // Transactions without a receipt are not mined yet.
+    if (!receipts[i])
+      continue;
+    OnGetTxReceipt(ids[i], std::move(*receipts[i]),
+                   mojom::ProviderError::kSuccess, "");
+  }
+}
+
 void EthPendingTxTracker::OnGetTxReceipt(std::string id,
                                          TransactionReceipt receipt,
                                          mojom::ProviderError error,
@@ -270,6 +270,21 @@ std::string eth_getTransactionReceipt(const std::string& transaction_hash) {
   return GetJsonRpcString("eth_getTransactionReceipt", transaction_hash);
 }
 
+std::string eth_getTransactionReceipts(
+    const std::vector<std::string>& transaction_hashes) {
+  base::Value::List batch;
+  for (size_t i = 0; i < transaction_hashes.size(); ++i) {
+    base::Value::List params;
+    params.Append(transaction_hashes[i]);
+    auto dict =
+        GetJsonRpcDictionary("eth_getTransactionReceipt", std::move(params));
+    // Requests in a batch are told apart by id.
+    dict.Set("id", static_cast<int>(i + 1));
+    batch.Append(std::move(dict));
+  }
+  return GetJSON(batch);
+}
+
 std::string eth_getUncleByBlockHashAndIndex(const std::string& transaction_hash,
                                             const std::string& uncle_index) {
   return GetJsonRpcString("eth_getUncleByBlockHashAndIndex", transaction_hash,
@@ -148,6 +148,10 @@ std::string eth_getTransactionByBlockNumberAndIndex(
     const std::string& transaction_index);
 // Returns the receipt of a transaction by transaction hash.
 std::string eth_getTransactionReceipt(const std::string& transaction_hash);
+// Returns a batch of eth_getTransactionReceipt requests, one per transaction
+// hash, to be sent as a single request.
+std::string eth_getTransactionReceipts(
+    const std::vector<std::string>& transaction_hashes);
 // Returns information about a uncle of a block by hash and uncle index
 // position.
 std::string eth_getUncleByBlockHashAndIndex(
@@ -12,6 +12,7 @@
 #include "base/values.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_wallet {
 
@@ -30,6 +31,14 @@ bool ParseEthGetBalance(const std::string& json, std::string* hex_balance);
 bool ParseEthGetTransactionCount(const std::string& json, uint256_t* count);
 bool ParseEthGetTransactionReceipt(const std::string& json,
                                    TransactionReceipt* receipt);
+// Parses the response to a batch of eth_getTransactionReceipt requests built
+// by |eth_getTransactionReceipts|. |receipts| must have one entry per request
+// and receipts are stored at the index of their request. Returns false if
+// |json| is not a batch response, for example because the endpoint does not
+// support batch requests.
+bool ParseEthGetTransactionReceipts(
+    const std::string& json,
+    std::vector<absl::optional<TransactionReceipt>>* receipts);
 bool ParseEthSendRawTransaction(const std::string& json, std::string* tx_hash);
 bool ParseEthCall(const std::string& json, std::string* result);
 absl::optional<std::vector<std::string>> DecodeEthCallResponse(
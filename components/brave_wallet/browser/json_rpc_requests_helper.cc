@@ -9,14 +9,39 @@
 #include <utility>
 
 #include "base/environment.h"
+#include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "brave/components/brave_wallet/common/eth_request_helper.h"
 #include "brave/components/brave_wallet/common/web3_provider_constants.h"
 #include "brave/components/constants/brave_services_key.h"
 #include "net/http/http_util.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_wallet {
 
+namespace {
+
+// Returns the method of a batch request if all of its requests use the same
+// method.
+absl::optional<std::string> GetBatchRequestMethod(
+    const std::string& json_payload) {
+  absl::optional<base::Value> batch = base::JSONReader::Read(json_payload);
+  if (!batch || !batch->is_list() || batch->GetList().empty())
+    return absl::nullopt;
+
+  absl::optional<std::string> batch_method;
+  for (const auto& request : batch->GetList()) {
+    const std::string* method =
+        request.is_dict() ? request.GetDict().FindString("method") : nullptr;
+    if (!method || (batch_method && *batch_method != *method))
+      return absl::nullopt;
+    batch_method = *method;
+  }
+  return batch_method;
+}
+
+}  // namespace
+
 namespace internal {
 
 base::Value::Dict ComposeRpcDict(base::StringPiece method) {
@@ -60,6 +85,9 @@ base::flat_map<std::string, std::string> MakeCommonJsonRpcHeaders(
     } else if (method == kEthBlockNumber) {
       request_headers["X-Eth-Block"] = "true";
     }
+  } else if (auto batch_method = GetBatchRequestMethod(json_payload)) {
+    if (net::HttpUtil::IsValidHeaderValue(*batch_method))
+      request_headers["X-Eth-Method"] = *batch_method;
   }
 
   std::unique_ptr<base::Environment> env(base::Environment::Create());
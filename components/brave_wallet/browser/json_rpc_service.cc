@@ -8,7 +8,9 @@
 #include <memory>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include "base/barrier_callback.h"
 #include "base/base64.h"
 #include "base/bind.h"
 #include "base/feature_list.h"
@@ -967,6 +969,86 @@ void JsonRpcService::OnGetTransactionReceipt(
   std::move(callback).Run(receipt, mojom::ProviderError::kSuccess, "");
 }
 
+void JsonRpcService::GetTransactionReceipts(
+    const std::vector<std::string>& tx_hashes,
+    GetTxReceiptsCallback callback) {
+  const GURL& network_url = network_urls_[mojom::CoinType::ETH];
+  if (tx_hashes.size() < 2 ||
+      networks_without_batch_requests_.contains(network_url)) {
+    GetTransactionReceiptsSeparately(tx_hashes, std::move(callback));
+    return;
+  }
+
+  auto internal_callback = base::BindOnce(
+      &JsonRpcService::OnGetTransactionReceipts, weak_ptr_factory_.GetWeakPtr(),
+      tx_hashes, network_url, std::move(callback));
+  RequestInternal(eth::eth_getTransactionReceipts(tx_hashes), true,
+                  network_url, std::move(internal_callback));
+}
+
+void JsonRpcService::OnGetTransactionReceipts(
+    const std::vector<std::string>& tx_hashes,
+    const GURL& network_url,
+    GetTxReceiptsCallback callback,
+    APIRequestResult api_request_result) {
+  if (!api_request_result.Is2XXResponseCode()) {
+    GetTransactionReceiptsSeparately(tx_hashes, std::move(callback));
+    return;
+  }
+
+  std::vector<absl::optional<TransactionReceipt>> receipts(tx_hashes.size());
+  if (!eth::ParseEthGetTransactionReceipts(api_request_result.body(),
+                                           &receipts)) {
+    mojom::ProviderError error;
+    std::string error_message;
+    ParseErrorResult<mojom::ProviderError>(api_request_result.body(), &error,
+                                           &error_message);
+    // Other errors may be transient, only stop batching when the node rejects
+    // the batch itself.
+    if (error == mojom::ProviderError::kInvalidRequest)
+      networks_without_batch_requests_.insert(network_url);
+    GetTransactionReceiptsSeparately(tx_hashes, std::move(callback));
+    return;
+  }
+
+  std::move(callback).Run(std::move(receipts));
+}
+
+void JsonRpcService::GetTransactionReceiptsSeparately(
+    const std::vector<std::string>& tx_hashes,
+    GetTxReceiptsCallback callback) {
+  using IndexedReceipt = std::pair<size_t, absl::optional<TransactionReceipt>>;
+  auto barrier_callback = base::BarrierCallback<IndexedReceipt>(
+      tx_hashes.size(),
+      base::BindOnce(
+          [](size_t count, GetTxReceiptsCallback callback,
+             std::vector<IndexedReceipt> indexed_receipts) {
+            std::vector<absl::optional<TransactionReceipt>> receipts(count);
+            for (auto& [index, receipt] : indexed_receipts) {
+              receipts[index] = std::move(receipt);
+            }
+            std::move(callback).Run(std::move(receipts));
+          },
+          tx_hashes.size(), std::move(callback)));
+
+  for (size_t i = 0; i < tx_hashes.size(); ++i) {
+    GetTransactionReceipt(
+        tx_hashes[i],
+        base::BindOnce(
+            [](size_t index,
+               base::RepeatingCallback<void(IndexedReceipt)> barrier_callback,
+               TransactionReceipt receipt, mojom::ProviderError error,
+               const std::string& error_message) {
+              if (error != mojom::ProviderError::kSuccess) {
+                barrier_callback.Run({index, absl::nullopt});
+                return;
+              }
+              barrier_callback.Run({index, std::move(receipt)});
+            },
+            i, barrier_callback));
+  }
+}
+
 void JsonRpcService::SendRawTransaction(const std::string& signed_tx,
                                         SendRawTxCallback callback) {
   auto internal_callback =
@@ -14,6 +14,7 @@
 
 #include "base/callback.h"
 #include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list_threadsafe.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
@@ -142,6 +143,15 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
   void GetTransactionReceipt(const std::string& tx_hash,
                              GetTxReceiptCallback callback);
 
+  // Receipts are in the same order as |tx_hashes| and are absl::nullopt for
+  // transactions which are not mined yet or could not be fetched.
+  using GetTxReceiptsCallback = base::OnceCallback<void(
+      std::vector<absl::optional<TransactionReceipt>> receipts)>;
+  // Fetches the receipts of |tx_hashes| with a single batch request, or with
+  // one request per transaction if the network does not support batches.
+  void GetTransactionReceipts(const std::vector<std::string>& tx_hashes,
+                              GetTxReceiptsCallback callback);
+
   using SendRawTxCallback =
       base::OnceCallback<void(const std::string& tx_hash,
                               mojom::ProviderError error,
@@ -437,6 +447,13 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
                                  APIRequestResult api_request_result);
   void OnGetTransactionReceipt(GetTxReceiptCallback callback,
                                APIRequestResult api_request_result);
+  void OnGetTransactionReceipts(const std::vector<std::string>& tx_hashes,
+                                const GURL& network_url,
+                                GetTxReceiptsCallback callback,
+                                APIRequestResult api_request_result);
+  void GetTransactionReceiptsSeparately(
+      const std::vector<std::string>& tx_hashes,
+      GetTxReceiptsCallback callback);
   void OnSendRawTransaction(SendRawTxCallback callback,
                             APIRequestResult api_request_result);
   void OnGetERC20TokenBalance(GetERC20TokenBalanceCallback callback,
@@ -563,6 +580,9 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
   std::unique_ptr<APIRequestHelper> api_request_helper_;
   std::unique_ptr<APIRequestHelper> api_request_helper_ens_offchain_;
   base::flat_map<mojom::CoinType, GURL> network_urls_;
+  // Networks which answered a batch request with something else than a batch
+  // response.
+  base::flat_set<GURL> networks_without_batch_requests_;
   // <mojom::CoinType, chain_id>
   base::flat_map<mojom::CoinType, std::string> chain_ids_;
   // <chain_id, mojom::AddChainRequest>
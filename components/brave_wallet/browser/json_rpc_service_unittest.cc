@@ -12,11 +12,14 @@
 #include "base/base64.h"
 #include "base/bind.h"
 #include "base/callback.h"
+#include "base/containers/adapters.h"
 #include "base/containers/contains.h"
 #include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "base/notreached.h"
 #include "base/ranges/algorithm.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/test/bind.h"
 #include "base/test/mock_callback.h"
@@ -5420,4 +5423,152 @@ TEST_F(ENSL2JsonRpcServiceUnitTest, GetContentHash_Consent) {
   }
 }
 
+TEST_F(JsonRpcServiceUnitTest, GetTransactionReceipts) {
+  constexpr char kMinedTxHash[] =
+      "0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238";
+  constexpr char kPendingTxHash[] =
+      "0xc6ef2fc5426d6ad6fd9e2a26abeab0aa2411b7ab17f30a99d3cb96aed1d1055b";
+  auto make_response = [&](int id, const std::string& tx_hash) {
+    if (tx_hash != kMinedTxHash) {
+      return base::StringPrintf(R"({"jsonrpc":"2.0","id":%d,"result":null})",
+                                id);
+    }
+    return base::StringPrintf(R"({
+      "jsonrpc":"2.0",
+      "id":%d,
+      "result": {
+        "transactionHash": "%s",
+        "transactionIndex":  "0x1",
+        "blockNumber": "0xb",
+        "blockHash": "0xc6ef2fc5426d6ad6fd9e2a26abeab0aa2411b7ab17f30a99d3cb96aed1d1055b",
+        "cumulativeGasUsed": "0x33bc",
+        "gasUsed": "0x4dc",
+        "contractAddress": null,
+        "logs": [],
+        "logsBloom": "0x00...0",
+        "status": "0x1"
+      }
+    })",
+                              id, tx_hash.c_str());
+  };
+
+  // Reply to batch requests with this error when set.
+  std::string batch_error;
+  size_t batch_requests = 0;
+  size_t single_requests = 0;
+  url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) {
+        std::string header_value;
+        EXPECT_TRUE(request.headers.GetHeader("X-Eth-Method", &header_value));
+        EXPECT_EQ(header_value, "eth_getTransactionReceipt");
+        auto payload = ToValue(request);
+        ASSERT_TRUE(payload);
+        url_loader_factory_.ClearResponses();
+        if (payload->is_list()) {
+          ++batch_requests;
+          if (!batch_error.empty()) {
+            url_loader_factory_.AddResponse(request.url.spec(), batch_error);
+            return;
+          }
+          // Responses to a batch may come in any order.
+          std::vector<std::string> responses;
+          for (const auto& entry : base::Reversed(payload->GetList())) {
+            responses.push_back(
+                make_response(*entry.GetDict().FindInt("id"),
+                              *entry.GetDict().FindList("params")->begin()
+                                   ->GetIfString()));
+          }
+          url_loader_factory_.AddResponse(
+              request.url.spec(),
+              "[" + base::JoinString(responses, ",") + "]");
+          return;
+        }
+        ++single_requests;
+        url_loader_factory_.AddResponse(
+            request.url.spec(),
+            make_response(1, *payload->GetDict()
+                                  .FindList("params")
+                                  ->begin()
+                                  ->GetIfString()));
+      }));
+
+  auto check_receipts =
+      [&](std::vector<absl::optional<TransactionReceipt>> receipts) {
+        ASSERT_EQ(receipts.size(), 2u);
+        EXPECT_FALSE(receipts[0]);
+        ASSERT_TRUE(receipts[1]);
+        EXPECT_EQ(receipts[1]->transaction_hash, kMinedTxHash);
+        EXPECT_TRUE(receipts[1]->status);
+      };
+
+  // Receipts are fetched with a single batch request.
+  {
+    base::RunLoop run_loop;
+    json_rpc_service_->GetTransactionReceipts(
+        {kPendingTxHash, kMinedTxHash},
+        base::BindLambdaForTesting(
+            [&](std::vector<absl::optional<TransactionReceipt>> receipts) {
+              check_receipts(std::move(receipts));
+              run_loop.Quit();
+            }));
+    run_loop.Run();
+    EXPECT_EQ(batch_requests, 1u);
+    EXPECT_EQ(single_requests, 0u);
+  }
+
+  // Other errors fall back to one request per transaction for this call only.
+  batch_error =
+      R"({"jsonrpc":"2.0","id":null,"error":{"code":-32603,"message":"Internal error"}})";  // NOLINT
+  batch_requests = 0;
+  {
+    base::RunLoop run_loop;
+    json_rpc_service_->GetTransactionReceipts(
+        {kPendingTxHash, kMinedTxHash},
+        base::BindLambdaForTesting(
+            [&](std::vector<absl::optional<TransactionReceipt>> receipts) {
+              check_receipts(std::move(receipts));
+              run_loop.Quit();
+            }));
+    run_loop.Run();
+    EXPECT_EQ(batch_requests, 1u);
+    EXPECT_EQ(single_requests, 2u);
+  }
+
+  // Networks without batch support fall back to one request per transaction.
+  batch_error =
+      R"({"jsonrpc":"2.0","id":null,"error":{"code":-32600,"message":"Invalid request"}})";  // NOLINT
+  batch_requests = 0;
+  single_requests = 0;
+  {
+    base::RunLoop run_loop;
+    json_rpc_service_->GetTransactionReceipts(
+        {kPendingTxHash, kMinedTxHash},
+        base::BindLambdaForTesting(
+            [&](std::vector<absl::optional<TransactionReceipt>> receipts) {
+              check_receipts(std::move(receipts));
+              run_loop.Quit();
+            }));
+    run_loop.Run();
+    EXPECT_EQ(batch_requests, 1u);
+    EXPECT_EQ(single_requests, 2u);
+  }
+
+  // Batch requests are not tried again for that network.
+  batch_requests = 0;
+  single_requests = 0;
+  {
+    base::RunLoop run_loop;
+    json_rpc_service_->GetTransactionReceipts(
+        {kPendingTxHash, kMinedTxHash},
+        base::BindLambdaForTesting(
+            [&](std::vector<absl::optional<TransactionReceipt>> receipts) {
+              check_receipts(std::move(receipts));
+              run_loop.Quit();
+            }));
+    run_loop.Run();
+    EXPECT_EQ(batch_requests, 0u);
+    EXPECT_EQ(single_requests, 2u);
+  }
+}
+
 }  // namespace brave_wallet
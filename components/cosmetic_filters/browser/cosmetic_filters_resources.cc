@@ -7,7 +7,6 @@
 
 #include <utility>
 
-#include "base/json/json_reader.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
@@ -23,43 +22,11 @@ CosmeticFiltersResources::CosmeticFiltersResources(
 CosmeticFiltersResources::~CosmeticFiltersResources() = default;
 
 void CosmeticFiltersResources::HiddenClassIdSelectors(
-    const std::string& input,
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions,
     HiddenClassIdSelectorsCallback callback) {
   DCHECK(ad_block_service_->GetTaskRunner()->RunsTasksInCurrentSequence());
-  absl::optional<base::Value> input_value = base::JSONReader::Read(input);
-  if (!input_value) {
-    // Nothing to work with
-    std::move(callback).Run(base::Value::Dict());
-
-    return;
-  }
-  base::Value::Dict* input_dict = input_value->GetIfDict();
-  if (!input_dict) {
-    std::move(callback).Run(base::Value::Dict());
-    return;
-  }
-  std::vector<std::string> classes;
-  base::Value::List* classes_list = input_dict->FindList("classes");
-  if (classes_list) {
-    for (const auto& class_item : *classes_list) {
-      if (!class_item.is_string()) {
-        continue;
-      }
-      classes.push_back(class_item.GetString());
-    }
-  }
-  std::vector<std::string> ids;
-  base::Value::List* ids_list = input_dict->FindList("ids");
-  if (ids_list) {
-    for (const auto& id_item : *ids_list) {
-      if (!id_item.is_string()) {
-        continue;
-      }
-      ids.push_back(id_item.GetString());
-    }
-  }
-
   auto selectors =
       ad_block_service_->HiddenClassIdSelectors(classes, ids, exceptions);
 
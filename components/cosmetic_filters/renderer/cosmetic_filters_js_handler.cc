@@ -78,6 +78,8 @@ const char kCosmeticFilteringInitScript[] =
           CC.hide1pContent = %s;
         if (CC.generichide === undefined)
           CC.generichide = %s;
+        if (CC.nativeClassIdCollection === undefined)
+          CC.nativeClassIdCollection = %s;
         if (CC.firstSelectorsPollingDelayMs === undefined)
           CC.firstSelectorsPollingDelayMs = %s;
         if (CC.switchToSelectorsPollingThreshold === undefined)
@@ -207,16 +209,33 @@ CosmeticFiltersJSHandler::CosmeticFiltersJSHandler(
 CosmeticFiltersJSHandler::~CosmeticFiltersJSHandler() = default;
 
 void CosmeticFiltersJSHandler::HiddenClassIdSelectors(
-    const std::string& input) {
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids) {
   if (!EnsureConnected())
     return;
 
   cosmetic_filters_resources_->HiddenClassIdSelectors(
-      input, exceptions_,
+      classes, ids, exceptions_,
       base::BindOnce(&CosmeticFiltersJSHandler::OnHiddenClassIdSelectors,
                      base::Unretained(this)));
 }
 
+void CosmeticFiltersJSHandler::OnClassIdsCollected(
+    blink::WebVector<blink::WebString> classes,
+    blink::WebVector<blink::WebString> ids) {
+  std::vector<std::string> class_names;
+  class_names.reserve(classes.size());
+  for (const auto& class_name : classes)
+    class_names.push_back(class_name.Utf8());
+
+  std::vector<std::string> id_names;
+  id_names.reserve(ids.size());
+  for (const auto& id : ids)
+    id_names.push_back(id.Utf8());
+
+  HiddenClassIdSelectors(class_names, id_names);
+}
+
 bool CosmeticFiltersJSHandler::OnIsFirstParty(const std::string& url_string) {
   const auto url = GURL(url_string);
   if (!url.is_valid())
@@ -431,9 +450,12 @@ void CosmeticFiltersJSHandler::ApplyRules(bool de_amp_enabled) {
   // Working on css rules
   generichide_ = resources_dict_->FindBool("generichide").value_or(false);
   namespace bf = brave_shields::features;
+  const bool native_class_id_collection = base::FeatureList::IsEnabled(
+      bf::kCosmeticFilteringNativeClassIdCollection);
   std::string cosmetic_filtering_init_script = base::StringPrintf(
       kCosmeticFilteringInitScript, enabled_1st_party_cf_ ? "true" : "false",
       generichide_ ? "true" : "false",
+      native_class_id_collection ? "true" : "false",
       render_frame_->IsMainFrame()
           ? "undefined"
           : bf::kCosmeticFilteringSubFrameFirstSelectorsPollingDelayMs.Get()
@@ -447,7 +469,16 @@ void CosmeticFiltersJSHandler::ApplyRules(bool de_amp_enabled) {
       isolated_world_id_,
       blink::WebScriptSource(blink::WebString::FromUTF8(pre_init_script)),
       blink::BackForwardCacheAware::kAllow);
-  ExecuteObservingBundleEntryPoint();
+
+  if (native_class_id_collection && !generichide_) {
+    web_frame->GetDocument().StartClassIdCollection(
+        base::BindRepeating(&CosmeticFiltersJSHandler::OnClassIdsCollected,
+                            weak_ptr_factory_.GetWeakPtr()));
+  }
+  // The bundle is only needed to observe the DOM or to unhide first party
+  // content.
+  if (!native_class_id_collection || !enabled_1st_party_cf_)
+    ExecuteObservingBundleEntryPoint();
 
   CSSRulesRoutine(*resources_dict_);
 }
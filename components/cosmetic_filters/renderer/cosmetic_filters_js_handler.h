@@ -17,6 +17,8 @@
 #include "content/public/renderer/render_frame_observer.h"
 #include "mojo/public/cpp/bindings/remote.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
+#include "third_party/blink/public/platform/web_string.h"
+#include "third_party/blink/public/platform/web_vector.h"
 #include "url/gurl.h"
 #include "v8/include/v8.h"
 
@@ -60,7 +62,11 @@ class CosmeticFiltersJSHandler {
   void CreateWorkerObject(v8::Isolate* isolate, v8::Local<v8::Context> context);
 
   // A function to be called from JS
-  void HiddenClassIdSelectors(const std::string& input);
+  void HiddenClassIdSelectors(const std::vector<std::string>& classes,
+                              const std::vector<std::string>& ids);
+  // Called by Blink with the classes and ids newly seen in the document.
+  void OnClassIdsCollected(blink::WebVector<blink::WebString> classes,
+                           blink::WebVector<blink::WebString> ids);
 
   void OnUrlCosmeticResources(base::OnceClosure callback,
                               base::Value result);
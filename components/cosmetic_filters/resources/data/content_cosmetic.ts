@@ -151,10 +151,7 @@ const fetchNewClassIdRules = () => {
   }
   // Callback to c++ renderer process
   // @ts-expect-error
-  cf_worker.hiddenClassIdSelectors(
-      JSON.stringify({
-        classes: notYetQueriedClasses, ids: notYetQueriedIds
-      }))
+  cf_worker.hiddenClassIdSelectors(notYetQueriedClasses, notYetQueriedIds)
   notYetQueriedClasses = []
   notYetQueriedIds = []
 }
@@ -642,7 +639,8 @@ const scheduleQueuePump = (hide1pContent: boolean, genericHide: boolean) => {
   // called, in which case set up a timer and quit
   CC._startCheckingId = window.requestIdleCallback(function ({ didTimeout }) {
     CC._hasDelayOcurred = true
-    if (!genericHide) {
+    // When classes and ids are collected natively there is nothing to observe.
+    if (!genericHide && !CC.nativeClassIdCollection) {
       if (CC.firstSelectorsPollingDelayMs === undefined) {
         startObserving()
       } else {
@@ -0,0 +1,243 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/de_amp/browser/amp_detector.h"
+
+#include <utility>
+#include <vector>
+
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+
+namespace de_amp {
+
+namespace {
+
+// Longest tag we are willing to buffer. Anything longer is skipped.
+constexpr size_t kMaxTagLength = 16 * 1024;
+
+constexpr char kCommentStart[] = "!--";
+constexpr char kCommentEnd[] = "-->";
+
+bool IsHTMLWhitespace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+bool IsRawTextElement(const std::string& name) {
+  return name == "script" || name == "style" || name == "title" ||
+         name == "textarea";
+}
+
+using Attributes = std::vector<std::pair<std::string, std::string>>;
+
+// Splits the part of a start tag that follows its name into attributes.
+// Names are lowercased, values are kept as is.
+Attributes ParseAttributes(base::StringPiece input) {
+  Attributes attributes;
+  size_t i = 0;
+  while (i < input.size()) {
+    while (i < input.size() && (IsHTMLWhitespace(input[i]) || input[i] == '/'))
+      ++i;
+    const size_t name_start = i;
+    while (i < input.size() && !IsHTMLWhitespace(input[i]) &&
+           input[i] != '=' && input[i] != '/') {
+      ++i;
+    }
+    if (i == name_start)
+      break;
+    std::string name =
+        base::ToLowerASCII(input.substr(name_start, i - name_start));
+
+    while (i < input.size() && IsHTMLWhitespace(input[i]))
+      ++i;
+    std::string value;
+    if (i < input.size() && input[i] == '=') {
+      ++i;
+      while (i < input.size() && IsHTMLWhitespace(input[i]))
+        ++i;
+      if (i < input.size() && (input[i] == '"' || input[i] == '\'')) {
+        const char quote = input[i++];
+        const size_t value_end = input.find(quote, i);
+        const size_t end =
+            value_end == base::StringPiece::npos ? input.size() : value_end;
+        value = std::string(input.substr(i, end - i));
+        i = end + 1;
+      } else {
+        const size_t value_start = i;
+        while (i < input.size() && !IsHTMLWhitespace(input[i]))
+          ++i;
+        value = std::string(input.substr(value_start, i - value_start));
+      }
+    }
+    attributes.emplace_back(std::move(name), std::move(value));
+  }
+  return attributes;
+}
+
+// https://amp.dev/documentation/guides-and-tutorials/learn/spec/amphtml/?format=websites#ampd
+bool HasAmpAttribute(const Attributes& attributes) {
+  for (const auto& attribute : attributes) {
+    if ((attribute.first == "amp" || attribute.first == "⚡") &&
+        base::TrimWhitespaceASCII(attribute.second, base::TRIM_ALL).empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// https://amp.dev/documentation/guides-and-tutorials/learn/spec/amphtml/?format=websites#canon
+std::string GetCanonicalHref(const Attributes& attributes) {
+  bool is_canonical = false;
+  std::string href;
+  for (const auto& attribute : attributes) {
+    if (attribute.first == "rel") {
+      const auto tokens = base::SplitStringPiece(
+          attribute.second, " \t\n\r\f", base::TRIM_WHITESPACE,
+          base::SPLIT_WANT_NONEMPTY);
+      for (const auto& token : tokens) {
+        if (base::EqualsCaseInsensitiveASCII(token, "canonical"))
+          is_canonical = true;
+      }
+    } else if (attribute.first == "href" && href.empty()) {
+      href = std::string(
+          base::TrimWhitespaceASCII(attribute.second, base::TRIM_ALL));
+    }
+  }
+  return is_canonical ? href : std::string();
+}
+
+}  // namespace
+
+AmpDetector::AmpDetector() = default;
+
+AmpDetector::~AmpDetector() = default;
+
+AmpDetector::Result AmpDetector::Feed(base::StringPiece chunk) {
+  for (size_t i = 0; i < chunk.size() && result_ == Result::kNeedMoreData;
+       ++i) {
+    const char c = chunk[i];
+    switch (state_) {
+      case State::kData:
+        if (c == '<') {
+          state_ = State::kTag;
+          tag_.clear();
+          quote_ = 0;
+        }
+        break;
+
+      case State::kTag:
+        if (quote_) {
+          if (c == quote_)
+            quote_ = 0;
+        } else if (c == '>') {
+          state_ = State::kData;
+          ProcessTag();
+          break;
+        } else if (tag_.empty() && !base::IsAsciiAlpha(c) && c != '/' &&
+                   c != '!' && c != '?') {
+          // Not a tag, e.g. "a < b".
+          state_ = c == '<' ? State::kTag : State::kData;
+          break;
+        } else if ((c == '"' || c == '\'') && !tag_.empty()) {
+          // Only quotes that open an attribute value count.
+          const size_t last = tag_.find_last_not_of(" \t\n\r\f");
+          if (last != std::string::npos && tag_[last] == '=')
+            quote_ = c;
+        }
+        tag_.push_back(c);
+        if (tag_ == kCommentStart) {
+          state_ = State::kComment;
+          tail_.clear();
+        } else if (tag_.size() > kMaxTagLength) {
+          state_ = State::kData;
+        }
+        break;
+
+      case State::kComment:
+        tail_.push_back(c);
+        if (tail_.size() > 3)
+          tail_.erase(0, tail_.size() - 3);
+        if (tail_ == kCommentEnd)
+          state_ = State::kData;
+        break;
+
+      case State::kRawText:
+        tail_.push_back(base::ToLowerASCII(c));
+        if (tail_.size() > raw_text_end_.size())
+          tail_.erase(0, tail_.size() - raw_text_end_.size());
+        if (tail_ == raw_text_end_) {
+          // Tokenize the rest of the end tag as usual.
+          state_ = State::kTag;
+          tag_ = raw_text_end_.substr(1);
+          quote_ = 0;
+        }
+        break;
+    }
+  }
+  return result_;
+}
+
+void AmpDetector::ProcessTag() {
+  if (tag_.empty() || tag_[0] == '!' || tag_[0] == '?')
+    return;
+
+  const bool is_end_tag = tag_[0] == '/';
+  const size_t name_start = is_end_tag ? 1 : 0;
+  size_t name_end = name_start;
+  while (name_end < tag_.size() && !IsHTMLWhitespace(tag_[name_end]) &&
+         tag_[name_end] != '/') {
+    ++name_end;
+  }
+  const std::string name = base::ToLowerASCII(
+      base::StringPiece(tag_).substr(name_start, name_end - name_start));
+
+  if (is_end_tag) {
+    OnEndTag(name);
+    return;
+  }
+
+  base::StringPiece attributes = base::StringPiece(tag_).substr(name_end);
+  // Drop the self-closing slash so it doesn't end up in an unquoted value.
+  if (base::EndsWith(attributes, "/"))
+    attributes.remove_suffix(1);
+  OnStartTag(name, attributes);
+  if (IsRawTextElement(name)) {
+    state_ = State::kRawText;
+    raw_text_end_ = "</" + name;
+    tail_.clear();
+  }
+}
+
+void AmpDetector::OnStartTag(const std::string& name,
+                             base::StringPiece attributes) {
+  if (!seen_html_) {
+    if (name == "html") {
+      seen_html_ = true;
+      is_amp_ = HasAmpAttribute(ParseAttributes(attributes));
+      if (!is_amp_)
+        result_ = Result::kNotAmp;
+    } else if (name == "body") {
+      result_ = Result::kNotAmp;
+    }
+    return;
+  }
+
+  if (name == "link") {
+    std::string href = GetCanonicalHref(ParseAttributes(attributes));
+    if (!href.empty()) {
+      canonical_url_ = std::move(href);
+      result_ = Result::kAmpWithCanonical;
+    }
+  } else if (name == "body") {
+    result_ = Result::kAmpWithoutCanonical;
+  }
+}
+
+void AmpDetector::OnEndTag(const std::string& name) {
+  if (is_amp_ && name == "head")
+    result_ = Result::kAmpWithoutCanonical;
+}
+
+}  // namespace de_amp
@@ -0,0 +1,71 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_DE_AMP_BROWSER_AMP_DETECTOR_H_
+#define BRAVE_COMPONENTS_DE_AMP_BROWSER_AMP_DETECTOR_H_
+
+#include <string>
+
+#include "base/strings/string_piece.h"
+
+namespace de_amp {
+
+// Incremental HTML tokenizer that looks for the AMP marker on the <html> tag
+// and for the canonical <link> in the document head. Every byte passed to
+// Feed() is looked at once, so callers can push chunks as they arrive from
+// the network instead of re-scanning an accumulated buffer.
+class AmpDetector {
+ public:
+  enum class Result {
+    // Haven't seen enough of the document to decide.
+    kNeedMoreData,
+    // <html> tag has no AMP attribute, or the body started without one.
+    kNotAmp,
+    // AMP page, |canonical_url()| holds the canonical link href.
+    kAmpWithCanonical,
+    // AMP page, but the head ended without a canonical link.
+    kAmpWithoutCanonical,
+  };
+
+  AmpDetector();
+  ~AmpDetector();
+
+  AmpDetector(const AmpDetector&) = delete;
+  AmpDetector& operator=(const AmpDetector&) = delete;
+
+  // Consumes the next chunk of the body. Once the result is not
+  // kNeedMoreData further input is ignored.
+  Result Feed(base::StringPiece chunk);
+
+  Result result() const { return result_; }
+  bool is_amp() const { return is_amp_; }
+  const std::string& canonical_url() const { return canonical_url_; }
+
+ private:
+  enum class State { kData, kTag, kComment, kRawText };
+
+  void ProcessTag();
+  void OnStartTag(const std::string& name, base::StringPiece attributes);
+  void OnEndTag(const std::string& name);
+
+  State state_ = State::kData;
+  Result result_ = Result::kNeedMoreData;
+
+  // Contents between '<' and '>' of the tag being tokenized.
+  std::string tag_;
+  char quote_ = 0;
+  // Tail of the input used to find the end of comments and raw text.
+  std::string tail_;
+  // Closing tag that ends kRawText, e.g. "</script".
+  std::string raw_text_end_;
+
+  bool seen_html_ = false;
+  bool is_amp_ = false;
+  std::string canonical_url_;
+};
+
+}  // namespace de_amp
+
+#endif  // BRAVE_COMPONENTS_DE_AMP_BROWSER_AMP_DETECTOR_H_
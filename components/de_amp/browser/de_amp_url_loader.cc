@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "base/logging.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
 #include "brave/components/de_amp/browser/de_amp_throttle.h"
 #include "brave/components/de_amp/browser/de_amp_util.h"
@@ -61,14 +62,17 @@ DeAmpURLLoader::DeAmpURLLoader(
 
 DeAmpURLLoader::~DeAmpURLLoader() = default;
 
-void DeAmpURLLoader::OnBodyReadable(MojoResult) {
+void DeAmpURLLoader::OnBodyReadable(MojoResult result) {
   if (state_ == State::kSending) {
-    // The pipe becoming readable when kSending means all buffered body has
-    // already been sent.
-    ForwardBodyToClient();
+    BodySnifferURLLoader::OnBodyReadable(result);
     return;
   }
-  if (!CheckBufferedBody(kMaxBytesToCheck - buffered_body_.size())) {
+  if (!ReadAndSniffBody(kMaxBytesToCheck - buffered_body_.size())) {
+    return;
+  }
+  if (amp_detector_.result() == AmpDetector::Result::kNeedMoreData &&
+      read_bytes_ < kMaxBytesToCheck) {
+    body_consumer_watcher_.ArmOrNotify();
     return;
   }
   if (MaybeRedirectToCanonicalLink()) {
@@ -76,15 +80,23 @@ void DeAmpURLLoader::OnBodyReadable(MojoResult) {
     Abort();
     return;
   }
-  // If we were not redirected and we didn't find AMP, or
-  // if we did find AMP previously and we've already read more bytes than
-  // max, complete the load.
-  if (!found_amp_ || read_bytes_ >= kMaxBytesToCheck) {
-    found_amp_ = false;  // reset
-    CompleteLoading(std::move(buffered_body_));
-    return;
+  // No usable canonical link or we've already read more bytes than max.
+  StartPassThrough();
+}
+
+body_sniffer::BodySnifferURLLoader::SniffAction DeAmpURLLoader::SniffBody(
+    base::StringPiece chunk) {
+  switch (amp_detector_.Feed(chunk)) {
+    case AmpDetector::Result::kNotAmp:
+    case AmpDetector::Result::kAmpWithoutCanonical:
+      // Nothing to do for this page, release the body right away.
+      return SniffAction::kPassThrough;
+    case AmpDetector::Result::kNeedMoreData:
+    case AmpDetector::Result::kAmpWithCanonical:
+      return SniffAction::kBuffer;
   }
-  body_consumer_watcher_.ArmOrNotify();
+  NOTREACHED();
+  return SniffAction::kBuffer;
 }
 
 bool DeAmpURLLoader::MaybeRedirectToCanonicalLink() {
@@ -92,92 +104,27 @@ bool DeAmpURLLoader::MaybeRedirectToCanonicalLink() {
     return false;
   }
 
-  // If we are not already on an AMP page, check if this chunk has the AMP HTML
-  if (!found_amp_ && !CheckIfAmpPage(buffered_body_)) {
-    return false;
-  }
-
-  found_amp_ = true;  // If we get to this point, we know we have an AMP page
-
-  auto canonical_link = FindCanonicalAmpUrl(buffered_body_);
-  if (!canonical_link.has_value()) {
-    VLOG(2) << __func__ << canonical_link.error();
+  if (amp_detector_.result() != AmpDetector::Result::kAmpWithCanonical) {
+    VLOG(2) << __func__ << " no canonical link, is AMP: "
+            << amp_detector_.is_amp();
     return false;
   }
 
-  bool redirected = false;
-  const GURL canonical_url(canonical_link.value());
+  const GURL canonical_url(amp_detector_.canonical_url());
   // Validate the found canonical AMP URL
-  if (VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
-    // Attempt to go to the canonical URL
-    VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
-    if (de_amp_throttle_->OpenCanonicalURL(canonical_url, response_url_)) {
-      redirected = true;
-    } else {
-      VLOG(2) << __func__ << " failed to open canonical url: " << canonical_url;
-    }
-  } else {
+  if (!VerifyCanonicalAmpUrl(canonical_url, response_url_)) {
     VLOG(2) << __func__ << " canonical link verification failed "
             << canonical_url;
-  }
-  // At this point we've either redirected, or we should stop trying
-  found_amp_ = false;
-  return redirected;
-}
-
-void DeAmpURLLoader::OnBodyWritable(MojoResult r) {
-  DCHECK_EQ(State::kSending, state_);
-  if (bytes_remaining_in_buffer_ > 0) {
-    SendBufferedBodyToClient();
-  } else {
-    ForwardBodyToClient();
-  }
-}
-
-// No buffered data to be sent, read and forward data to producer
-void DeAmpURLLoader::ForwardBodyToClient() {
-  DCHECK_EQ(0u, bytes_remaining_in_buffer_);
-  // Send the body from the consumer to the producer.
-  const void* buffer;
-  uint32_t buffer_size = 0;
-  MojoResult result = body_consumer_handle_->BeginReadData(
-      &buffer, &buffer_size, MOJO_BEGIN_READ_DATA_FLAG_NONE);
-  switch (result) {
-    case MOJO_RESULT_OK:
-      break;
-    case MOJO_RESULT_SHOULD_WAIT:
-      body_consumer_watcher_.ArmOrNotify();
-      return;
-    case MOJO_RESULT_FAILED_PRECONDITION:
-      // All data has been sent.
-      CompleteSending();
-      return;
-    default:
-      NOTREACHED();
-      return;
+    return false;
   }
 
-  result = body_producer_handle_->WriteData(buffer, &buffer_size,
-                                            MOJO_WRITE_DATA_FLAG_NONE);
-  switch (result) {
-    case MOJO_RESULT_OK:
-      break;
-    case MOJO_RESULT_FAILED_PRECONDITION:
-      // The pipe is closed unexpectedly. |this| should be deleted once
-      // URLLoader on the destination is released.
-      Abort();
-      return;
-    case MOJO_RESULT_SHOULD_WAIT:
-      body_consumer_handle_->EndReadData(0);
-      body_producer_watcher_.ArmOrNotify();
-      return;
-    default:
-      NOTREACHED();
-      return;
+  // Attempt to go to the canonical URL
+  VLOG(2) << __func__ << " de-amping and loading " << canonical_url;
+  if (!de_amp_throttle_->OpenCanonicalURL(canonical_url, response_url_)) {
+    VLOG(2) << __func__ << " failed to open canonical url: " << canonical_url;
+    return false;
   }
-
-  body_consumer_handle_->EndReadData(buffer_size);
-  body_consumer_watcher_.ArmOrNotify();
+  return true;
 }
 
 }  // namespace de_amp
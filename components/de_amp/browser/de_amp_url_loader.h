@@ -13,6 +13,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/task/sequenced_task_runner.h"
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
+#include "brave/components/de_amp/browser/amp_detector.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "services/network/public/mojom/url_loader.mojom.h"
@@ -43,12 +44,12 @@ class DeAmpURLLoader : public body_sniffer::BodySnifferURLLoader {
                      destination_url_loader_client,
                  scoped_refptr<base::SequencedTaskRunner> task_runner);
   void OnBodyReadable(MojoResult) override;
-  void OnBodyWritable(MojoResult) override;
+  SniffAction SniffBody(base::StringPiece chunk) override;
   bool MaybeRedirectToCanonicalLink();
-  void ForwardBodyToClient();
 
   base::WeakPtr<DeAmpThrottle> de_amp_throttle_;
-  bool found_amp_ = false;
+  // Sees every body byte once, in place, until it has made up its mind.
+  AmpDetector amp_detector_;
 };
 
 }  // namespace de_amp
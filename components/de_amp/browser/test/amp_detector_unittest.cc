@@ -0,0 +1,156 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/de_amp/browser/amp_detector.h"
+
+#include <string>
+
+#include "base/strings/string_piece.h"
+#include "brave/components/de_amp/browser/de_amp_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace de_amp {
+
+namespace {
+
+using Result = AmpDetector::Result;
+
+// Feeds |body| in |chunk_size| pieces and checks that splitting the input
+// doesn't change the outcome.
+void CheckDetectorResult(const std::string& body,
+                         Result expected_result,
+                         const std::string& expected_canonical_url) {
+  for (size_t chunk_size : {body.size(), size_t{7}, size_t{1}}) {
+    AmpDetector detector;
+    for (size_t i = 0; i < body.size(); i += chunk_size)
+      detector.Feed(base::StringPiece(body).substr(i, chunk_size));
+    EXPECT_EQ(expected_result, detector.result()) << chunk_size;
+    EXPECT_EQ(expected_canonical_url, detector.canonical_url()) << chunk_size;
+  }
+}
+
+// Roughly the shape of a news article: a long head full of scripts, styles
+// and meta tags, then a large body.
+std::string MakeNewsPage(bool is_amp) {
+  std::string page = "<!doctype html>\n";
+  page += is_amp ? "<html amp lang=\"en\">\n" : "<html lang=\"en\">\n";
+  page += "<head><meta charset=\"utf-8\">\n";
+  for (int i = 0; i < 200; ++i) {
+    page += "<meta property=\"og:tag" + std::to_string(i) +
+            "\" content=\"Some <b>content</b> for tag\">\n";
+    page += "<script>var x" + std::to_string(i) +
+            " = '<link rel=\"canonical\" href=\"https://bad.com\">';</script>\n";
+    page += "<style>.c" + std::to_string(i) + " { color: red; }</style>\n";
+  }
+  page += "<link rel=\"canonical\" href=\"https://news.example.com/a\">\n";
+  page += "</head><body>";
+  while (page.size() < 3 * 65536)
+    page += "<p class=\"article\">Lorem ipsum dolor sit amet.</p>\n";
+  page += "</body></html>";
+  return page;
+}
+
+}  // namespace
+
+TEST(AmpDetectorUnitTest, DetectAmpWithEmoji) {
+  CheckDetectorResult(
+      "<html ⚡><head><link rel=\"canonical\" href=\"https://abc.com\"/>"
+      "</head><body></body></html>",
+      Result::kAmpWithCanonical, "https://abc.com");
+}
+
+TEST(AmpDetectorUnitTest, DetectAmpMixedCase) {
+  CheckDetectorResult(
+      "<!DOCTYPE html><HTML AMP lang=en>\n<head>"
+      "<LINK rel=\"author\" href=\"https://xyz.com\"/>"
+      "<link REL=CANONICAL href=https://abc.com/>"
+      "</head><body></body></html>",
+      Result::kAmpWithCanonical, "https://abc.com");
+}
+
+TEST(AmpDetectorUnitTest, DetectAmpWithEmptyAttribute) {
+  CheckDetectorResult(
+      "<html amp=''><head><link href='https://abc.com' rel='canonical'>"
+      "</head></html>",
+      Result::kAmpWithCanonical, "https://abc.com");
+}
+
+TEST(AmpDetectorUnitTest, NotAmp) {
+  CheckDetectorResult(
+      "<html><head><link rel=\"canonical\" href=\"https://abc.com\"/>"
+      "</head><body></body></html>",
+      Result::kNotAmp, "");
+  CheckDetectorResult("<html amp=\"no\"><head></head></html>", Result::kNotAmp,
+                      "");
+  CheckDetectorResult(
+      "<xyz html amp xyzzy>\n<head>"
+      "<link rel=\"canonical\" href=\"https://abc.com\"/>"
+      "</head><body></body></html>",
+      Result::kNotAmp, "");
+}
+
+TEST(AmpDetectorUnitTest, AmpWithoutCanonical) {
+  CheckDetectorResult(
+      "<html amp><head><link rel=\"author\" href=\"https://xyz.com\"/>"
+      "</head><body><link rel=\"canonical\" href=\"https://abc.com\"/>"
+      "</body></html>",
+      Result::kAmpWithoutCanonical, "");
+}
+
+TEST(AmpDetectorUnitTest, IgnoresCommentsAndRawText) {
+  CheckDetectorResult(
+      "<!-- <html amp> -->"
+      "<html amp><head>"
+      "<script>if (a < b && c > d) {}"
+      "var s = '<link rel=canonical href=https://bad.com>';</script>"
+      "<!-- <link rel=canonical href=https://bad2.com> -->"
+      "<title>a <link rel=canonical href=https://bad3.com></title>"
+      "<link rel=\"canonical\" href=\"https://abc.com\">"
+      "</head></html>",
+      Result::kAmpWithCanonical, "https://abc.com");
+}
+
+TEST(AmpDetectorUnitTest, QuotedGreaterThanInAttribute) {
+  CheckDetectorResult(
+      "<html amp data-x=\"a>b\"><head>"
+      "<meta content='x>y'>"
+      "<link rel=canonical href=\"https://abc.com/?a>b\">"
+      "</head></html>",
+      Result::kAmpWithCanonical, "https://abc.com/?a>b");
+}
+
+TEST(AmpDetectorUnitTest, StopsConsumingAfterResult) {
+  AmpDetector detector;
+  EXPECT_EQ(Result::kNeedMoreData, detector.Feed("<html amp><he"));
+  EXPECT_EQ(Result::kAmpWithCanonical,
+            detector.Feed("ad><link rel=canonical href=https://abc.com>"));
+  EXPECT_EQ(Result::kAmpWithCanonical,
+            detector.Feed("<link rel=canonical href=https://xyz.com>"));
+  EXPECT_EQ("https://abc.com", detector.canonical_url());
+}
+
+TEST(AmpDetectorUnitTest, LargeNewsPage) {
+  CheckDetectorResult(MakeNewsPage(true), Result::kAmpWithCanonical,
+                      "https://news.example.com/a");
+  CheckDetectorResult(MakeNewsPage(false), Result::kNotAmp, "");
+}
+
+// The streaming detector agrees with the regexes DeAmpURLLoader used to run
+// over the accumulated buffer.
+TEST(AmpDetectorUnitTest, LargeNewsPageMatchesRegexes) {
+  for (bool is_amp : {true, false}) {
+    const std::string page = MakeNewsPage(is_amp);
+    AmpDetector detector;
+    detector.Feed(page);
+    EXPECT_EQ(CheckIfAmpPage(page), detector.is_amp());
+    const auto canonical_url = FindCanonicalAmpUrl(page);
+    if (is_amp) {
+      ASSERT_TRUE(canonical_url.has_value());
+      EXPECT_EQ(canonical_url.value(), detector.canonical_url());
+    }
+  }
+}
+
+}  // namespace de_amp
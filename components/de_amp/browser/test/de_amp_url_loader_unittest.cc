@@ -0,0 +1,127 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/de_amp/browser/de_amp_url_loader.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/run_loop.h"
+#include "base/strings/string_piece.h"
+#include "base/test/task_environment.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "brave/components/de_amp/browser/de_amp_throttle.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/system/data_pipe.h"
+#include "mojo/public/cpp/system/data_pipe_utils.h"
+#include "net/base/net_errors.h"
+#include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
+#include "services/network/test/test_url_loader_client.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/public/common/loader/url_loader_throttle.h"
+#include "url/gurl.h"
+
+namespace de_amp {
+
+namespace {
+
+class MockThrottleDelegate : public blink::URLLoaderThrottle::Delegate {
+ public:
+  void CancelWithError(int error_code,
+                       base::StringPiece custom_reason) override {
+    NOTREACHED();
+  }
+  void Resume() override { is_resumed_ = true; }
+
+  bool is_resumed() const { return is_resumed_; }
+
+ private:
+  bool is_resumed_ = false;
+};
+
+}  // namespace
+
+class DeAmpURLLoaderTest : public testing::Test {
+ public:
+  DeAmpURLLoaderTest()
+      : throttle_(base::SequencedTaskRunnerHandle::Get(),
+                  network::ResourceRequest(),
+                  base::BindRepeating(
+                      []() -> content::WebContents* { return nullptr; })) {
+    throttle_.set_delegate(&delegate_);
+  }
+  ~DeAmpURLLoaderTest() override = default;
+
+  // Runs |body| through a DeAmpURLLoader and returns what reaches the client.
+  std::string LoadBody(const std::string& body) {
+    auto [loader_remote, client_receiver, loader] =
+        DeAmpURLLoader::CreateLoader(throttle_.AsWeakPtr(),
+                                     GURL("https://example.com/"),
+                                     base::SequencedTaskRunnerHandle::Get());
+    mojo::Remote<network::mojom::URLLoader> destination_loader(
+        std::move(loader_remote));
+    EXPECT_TRUE(mojo::FusePipes(std::move(client_receiver),
+                                destination_client_.CreateRemote()));
+    mojo::ScopedDataPipeConsumerHandle destination_body =
+        std::move(*loader->GetNextConsumerHandle());
+
+    mojo::PendingRemote<network::mojom::URLLoader> source_loader;
+    auto source_loader_receiver =
+        source_loader.InitWithNewPipeAndPassReceiver();
+    mojo::Remote<network::mojom::URLLoaderClient> source_client;
+    mojo::ScopedDataPipeProducerHandle source_producer;
+    mojo::ScopedDataPipeConsumerHandle source_consumer;
+    EXPECT_EQ(MOJO_RESULT_OK,
+              mojo::CreateDataPipe(body.size(), source_producer,
+                                   source_consumer));
+    uint32_t size = body.size();
+    EXPECT_EQ(MOJO_RESULT_OK,
+              source_producer->WriteData(body.data(), &size,
+                                         MOJO_WRITE_DATA_FLAG_ALL_OR_NONE));
+    source_producer.reset();
+
+    loader->Start(std::move(source_loader),
+                  source_client.BindNewPipeAndPassReceiver(),
+                  std::move(source_consumer));
+    source_client->OnComplete(network::URLLoaderCompletionStatus(net::OK));
+    base::RunLoop().RunUntilIdle();
+
+    std::string result;
+    EXPECT_TRUE(mojo::BlockingCopyToString(std::move(destination_body),
+                                           &result));
+    destination_client_.RunUntilComplete();
+    return result;
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  MockThrottleDelegate delegate_;
+  DeAmpThrottle throttle_;
+  network::TestURLLoaderClient destination_client_;
+};
+
+TEST_F(DeAmpURLLoaderTest, NonAmpBodyDecidedByFirstChunk) {
+  std::string body = "<html lang=\"en\"><head></head><body>";
+  while (body.size() < 16 * 1024)
+    body += "<p>Lorem ipsum dolor sit amet.</p>\n";
+  body += "</body></html>";
+
+  EXPECT_EQ(body, LoadBody(body));
+  EXPECT_TRUE(delegate_.is_resumed());
+  EXPECT_EQ(net::OK, destination_client_.completion_status().error_code);
+}
+
+TEST_F(DeAmpURLLoaderTest, AmpBodyWithoutCanonicalLink) {
+  const std::string body =
+      "<html amp><head><title>AMP</title></head><body>Hello</body></html>";
+
+  EXPECT_EQ(body, LoadBody(body));
+  EXPECT_TRUE(delegate_.is_resumed());
+}
+
+}  // namespace de_amp
@@ -31,6 +31,7 @@ declare global {
       observingHasStarted: boolean
       hide1pContent: boolean
       generichide: boolean
+      nativeClassIdCollection: boolean
       firstRunQueue: Set<string>
       secondRunQueue: Set<string>
       finalRunQueue: Set<string>
@@ -0,0 +1,15 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/greaselion/browser/features.h"
+
+namespace greaselion {
+namespace features {
+
+const base::Feature kGreaselionBundleRules{"GreaselionBundleRules",
+                                           base::FEATURE_DISABLED_BY_DEFAULT};
+
+}  // namespace features
+}  // namespace greaselion
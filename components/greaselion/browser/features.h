@@ -0,0 +1,21 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_GREASELION_BROWSER_FEATURES_H_
+#define BRAVE_COMPONENTS_GREASELION_BROWSER_FEATURES_H_
+
+#include "base/feature_list.h"
+
+namespace greaselion {
+namespace features {
+
+// Installs all active rules which do not have localized messages as a single
+// extension, instead of one extension per rule.
+extern const base::Feature kGreaselionBundleRules;
+
+}  // namespace features
+}  // namespace greaselion
+
+#endif  // BRAVE_COMPONENTS_GREASELION_BROWSER_FEATURES_H_
@@ -173,12 +173,17 @@ bool GreaselionRule::Matches(
   if (!PreconditionFulfilled(preconditions_.auto_contribution_enabled,
                              state[greaselion::AUTO_CONTRIBUTION]))
     return false;
-  if (!PreconditionFulfilled(preconditions_.supports_minimum_brave_version,
-                          state[greaselion::SUPPORTS_MINIMUM_BRAVE_VERSION]))
-    return false;
   if (!PreconditionFulfilled(preconditions_.ads_enabled,
                              state[greaselion::ADS]))
     return false;
+  return MatchesStaticPreconditions(state, browser_version);
+}
+
+bool GreaselionRule::MatchesStaticPreconditions(
+    GreaselionFeatures state, const base::Version& browser_version) const {
+  if (!PreconditionFulfilled(preconditions_.supports_minimum_brave_version,
+                          state[greaselion::SUPPORTS_MINIMUM_BRAVE_VERSION]))
+    return false;
   // Validate against browser version.
   if (base::Version::IsValidWildcardString(minimum_brave_version_)) {
     bool rule_version_is_higher_than_browser =
@@ -66,6 +66,11 @@ class GreaselionRule {
              const base::FilePath& resource_dir);
   bool Matches(
       GreaselionFeatures state, const base::Version& browser_version) const;
+  // Like |Matches|, but ignores the preconditions on features which can be
+  // toggled at runtime, i.e. every feature except
+  // SUPPORTS_MINIMUM_BRAVE_VERSION.
+  bool MatchesStaticPreconditions(
+      GreaselionFeatures state, const base::Version& browser_version) const;
   std::string name() const { return name_; }
   std::vector<std::string> url_patterns() const { return url_patterns_; }
   std::vector<base::FilePath> scripts() const { return scripts_; }
@@ -75,6 +80,9 @@ class GreaselionRule {
   base::FilePath messages() const {
     return messages_;
   }
+  const GreaselionPreconditions& preconditions() const {
+    return preconditions_;
+  }
   bool has_unknown_preconditions() const { return has_unknown_preconditions_; }
 
  private:
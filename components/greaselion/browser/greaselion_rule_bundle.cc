@@ -0,0 +1,270 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/greaselion/browser/greaselion_rule_bundle.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/json/json_writer.h"
+#include "base/logging.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "base/values.h"
+#include "brave/components/greaselion/browser/greaselion_download_service.h"
+#include "extensions/common/url_pattern.h"
+#include "url/url_constants.h"
+
+namespace greaselion {
+
+namespace {
+
+constexpr char kRegexSpecialCharacters[] = "\\^$.|?*+()[]{}";
+
+// Features which can be toggled at runtime, and the preconditions on them.
+// Rules are gated on these by the bundle script, so that toggling one of them
+// does not change the bundle.
+constexpr struct {
+  GreaselionFeature feature;
+  GreaselionPreconditionValue GreaselionPreconditions::*precondition;
+} kRuntimeFeatures[] = {
+    {REWARDS, &GreaselionPreconditions::rewards_enabled},
+    {TWITTER_TIPS, &GreaselionPreconditions::twitter_tips_enabled},
+    {REDDIT_TIPS, &GreaselionPreconditions::reddit_tips_enabled},
+    {GITHUB_TIPS, &GreaselionPreconditions::github_tips_enabled},
+    {AUTO_CONTRIBUTION, &GreaselionPreconditions::auto_contribution_enabled},
+    {ADS, &GreaselionPreconditions::ads_enabled},
+};
+
+// The dispatcher looks up the page host, then each of its parent domains, in
+// |hostIndex| and only tests the scheme, port and path of the patterns it
+// finds. Patterns without a host match every host and are always tested.
+// Matching rules without preconditions run in rule order. Matching rules with
+// preconditions run in rule order once the feature state has been read from
+// storage, if the state fulfills them. An exception thrown by one rule does
+// not stop the others.
+//
+// The rules are passed in as arguments, so that they are declared outside of
+// the dispatcher and only see the same globals as separate content scripts.
+constexpr char kDispatcherScriptStart[] = R"((function (patterns, hostIndex,
+    anyHostPatterns, rulePreconditions, stateKey, rules) {
+  const defaultPorts = {'http:': '80', 'https:': '443'};
+  const scheme = location.protocol.slice(0, -1);
+  const port = location.port || defaultPorts[location.protocol] || '';
+  const path = location.pathname + location.search;
+  const matchedRules = new Set();
+  const matchPatterns = (indices, subdomainsOnly) => {
+    for (const index of indices) {
+      const pattern = patterns[index];
+      if ((subdomainsOnly && !pattern.matchSubdomains) ||
+          !pattern.schemes.includes(scheme) ||
+          (pattern.port !== '*' && pattern.port !== port) ||
+          !new RegExp(pattern.path).test(path)) {
+        continue;
+      }
+      matchedRules.add(pattern.rule);
+    }
+  };
+  const lookupHost = (host) =>
+      Object.prototype.hasOwnProperty.call(hostIndex, host) ?
+          hostIndex[host] : [];
+  let host = location.hostname;
+  matchPatterns(lookupHost(host), false);
+  for (let dot = host.indexOf('.'); dot !== -1; dot = host.indexOf('.')) {
+    host = host.slice(dot + 1);
+    matchPatterns(lookupHost(host), true);
+  }
+  matchPatterns(anyHostPatterns, false);
+  if (!matchedRules.size) {
+    return;
+  }
+  const runRule = (rule) => {
+    try {
+      // Top-level |this| is the global object in a content script.
+      rules[rule].call(window);
+    } catch (e) {
+      console.error(e);
+    }
+  };
+  const gatedRules = [];
+  for (let rule = 0; rule < rules.length; ++rule) {
+    if (!matchedRules.has(rule)) {
+      continue;
+    }
+    if (Object.keys(rulePreconditions[rule]).length) {
+      gatedRules.push(rule);
+      continue;
+    }
+    runRule(rule);
+  }
+  if (!gatedRules.length) {
+    return;
+  }
+  chrome.storage.local.get(stateKey, (items) => {
+    const state = (items && items[stateKey]) || {};
+    for (const rule of gatedRules) {
+      const preconditions = rulePreconditions[rule];
+      if (Object.keys(preconditions).every(
+              (feature) => !!state[feature] === preconditions[feature])) {
+        runRule(rule);
+      }
+    }
+  });
+})()";
+
+constexpr char kDispatcherScriptEnd[] = R"(
+]);
+)";
+
+// Converts a URL pattern path glob to a regular expression which matches the
+// same paths as |URLPattern::MatchesPath|. Only '*' is a wildcard.
+std::string PathGlobToRegex(base::StringPiece path) {
+  // A path ending in "/*" also matches the path without the trailing slash.
+  const bool matches_without_trailing_slash = base::EndsWith(path, "/*");
+  if (matches_without_trailing_slash) {
+    path.remove_suffix(2);
+  }
+
+  std::string regex = "^";
+  for (const char c : path) {
+    if (c == '*') {
+      regex += ".*";
+      continue;
+    }
+
+    if (base::StringPiece(kRegexSpecialCharacters).find(c) !=
+        base::StringPiece::npos) {
+      regex += '\\';
+    }
+    regex += c;
+  }
+
+  if (matches_without_trailing_slash) {
+    regex += "(?:/.*)?";
+  }
+
+  return regex + "$";
+}
+
+std::string ToJson(const base::Value& value) {
+  std::string json;
+  base::JSONWriter::Write(value, &json);
+  return json;
+}
+
+}  // namespace
+
+const char kGreaselionRuleBundleStateKey[] = "greaselionState";
+
+bool CanBundleGreaselionRule(const GreaselionRule& rule) {
+  return rule.messages().empty();
+}
+
+base::Value::Dict GetGreaselionRuleBundlePreconditions(
+    const GreaselionRule& rule) {
+  base::Value::Dict preconditions;
+  for (const auto& runtime_feature : kRuntimeFeatures) {
+    const GreaselionPreconditionValue precondition =
+        rule.preconditions().*runtime_feature.precondition;
+    if (precondition == kAny) {
+      continue;
+    }
+    preconditions.Set(base::NumberToString(runtime_feature.feature),
+                      precondition == kMustBeTrue);
+  }
+  return preconditions;
+}
+
+base::Value::Dict GetGreaselionRuleBundleState(
+    const GreaselionFeatures& state) {
+  base::Value::Dict bundle_state;
+  for (const auto& runtime_feature : kRuntimeFeatures) {
+    const auto it = state.find(runtime_feature.feature);
+    bundle_state.Set(base::NumberToString(runtime_feature.feature),
+                     it != state.end() && it->second);
+  }
+  return bundle_state;
+}
+
+absl::optional<std::string> BuildGreaselionRuleBundleScript(
+    const std::vector<GreaselionRule>& rules) {
+  base::Value::List patterns;
+  base::Value::Dict host_index;
+  base::Value::List any_host_patterns;
+  base::Value::List rule_preconditions;
+  std::string rule_functions;
+
+  for (size_t rule_index = 0; rule_index < rules.size(); ++rule_index) {
+    const GreaselionRule& rule = rules[rule_index];
+    rule_preconditions.Append(GetGreaselionRuleBundlePreconditions(rule));
+
+    for (const auto& url_pattern : rule.url_patterns()) {
+      URLPattern pattern(URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS);
+      if (pattern.Parse(url_pattern) != URLPattern::ParseResult::kSuccess) {
+        // Patterns are validated when the rules are parsed.
+        NOTREACHED();
+        continue;
+      }
+
+      base::Value::List schemes;
+      for (const char* scheme : {url::kHttpScheme, url::kHttpsScheme}) {
+        if (pattern.MatchesScheme(scheme)) {
+          schemes.Append(scheme);
+        }
+      }
+
+      base::Value::Dict pattern_dict;
+      pattern_dict.Set("rule", static_cast<int>(rule_index));
+      pattern_dict.Set("schemes", std::move(schemes));
+      pattern_dict.Set("matchSubdomains", pattern.match_subdomains());
+      pattern_dict.Set("port", pattern.port());
+      pattern_dict.Set("path", PathGlobToRegex(pattern.path()));
+
+      const int pattern_index = static_cast<int>(patterns.size());
+      patterns.Append(std::move(pattern_dict));
+
+      if (pattern.host().empty()) {
+        any_host_patterns.Append(pattern_index);
+        continue;
+      }
+
+      base::Value::List* host_patterns = host_index.FindList(pattern.host());
+      if (!host_patterns) {
+        host_patterns =
+            host_index.Set(pattern.host(), base::Value::List())->GetIfList();
+      }
+      host_patterns->Append(pattern_index);
+    }
+
+    // Scripts of a rule shared a scope when they were injected separately, so
+    // they share a function.
+    rule_functions += "function () {\n";
+    for (const auto& script : rule.scripts()) {
+      std::string contents;
+      if (!base::ReadFileToString(script, &contents)) {
+        LOG(ERROR) << "Could not read Greaselion script at path: "
+                   << script.LossyDisplayName();
+        return absl::nullopt;
+      }
+      base::StrAppend(&rule_functions, {contents, "\n;\n"});
+    }
+    rule_functions += "},\n";
+  }
+
+  return base::StrCat(
+      {kDispatcherScriptStart, ToJson(base::Value(std::move(patterns))), ",\n",
+       ToJson(base::Value(std::move(host_index))), ",\n",
+       ToJson(base::Value(std::move(any_host_patterns))), ",\n",
+       ToJson(base::Value(std::move(rule_preconditions))), ",\n",
+       ToJson(base::Value(kGreaselionRuleBundleStateKey)), ", [\n",
+       rule_functions, kDispatcherScriptEnd});
+}
+
+}  // namespace greaselion
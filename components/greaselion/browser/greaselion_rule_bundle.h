@@ -0,0 +1,55 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_GREASELION_BROWSER_GREASELION_RULE_BUNDLE_H_
+#define BRAVE_COMPONENTS_GREASELION_BROWSER_GREASELION_RULE_BUNDLE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/values.h"
+#include "brave/components/greaselion/browser/greaselion_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace greaselion {
+
+class GreaselionRule;
+
+// The key under which the state of the features that bundled rules depend on
+// is stored in the bundle extension's chrome.storage.local.
+extern const char kGreaselionRuleBundleStateKey[];
+
+// Returns |true| if |rule| can be bundled with other rules into a single
+// extension. Rules with localized messages cannot be bundled because each
+// extension only has one set of locales.
+bool CanBundleGreaselionRule(const GreaselionRule& rule);
+
+// Returns the preconditions of |rule| on features which can be toggled at
+// runtime, as they are checked by the bundle script.
+base::Value::Dict GetGreaselionRuleBundlePreconditions(
+    const GreaselionRule& rule);
+
+// Returns the value to store under |kGreaselionRuleBundleStateKey| for
+// |state|.
+base::Value::Dict GetGreaselionRuleBundleState(
+    const GreaselionFeatures& state);
+
+// Builds a content script which runs the scripts of every rule in |rules|
+// whose URL patterns match the current page. Rule URL patterns are indexed by
+// host, so the page is looked up once instead of being matched against the
+// URL patterns of every rule. Rules are bundled regardless of the feature
+// state, and rules with preconditions on features only run once the bundle
+// has read the state stored under |kGreaselionRuleBundleStateKey|. Each rule's
+// scripts are wrapped in a function outside of the dispatcher, so that
+// bundled rules do not share top-level declarations with each other or with
+// the dispatcher. Returns |absl::nullopt| if a script could not be read.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+absl::optional<std::string> BuildGreaselionRuleBundleScript(
+    const std::vector<GreaselionRule>& rules);
+
+}  // namespace greaselion
+
+#endif  // BRAVE_COMPONENTS_GREASELION_BROWSER_GREASELION_RULE_BUNDLE_H_
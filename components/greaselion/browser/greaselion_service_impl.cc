@@ -6,8 +6,10 @@
 #include "brave/components/greaselion/browser/greaselion_service_impl.h"
 
 #include <stddef.h>
+#include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -16,13 +18,18 @@
 #include "base/callback_helpers.h"
 #include "base/command_line.h"
 #include "base/containers/contains.h"
+#include "base/containers/flat_set.h"
 #include "base/feature_list.h"
+#include "base/files/file_enumerator.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/files/scoped_temp_dir.h"
 #include "base/json/json_file_value_serializer.h"
+#include "base/json/json_writer.h"
 #include "base/one_shot_event.h"
 #include "base/ranges/algorithm.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/task_runner_util.h"
@@ -30,12 +37,18 @@
 #include "base/version.h"
 #include "brave/components/brave_component_updater/browser/features.h"
 #include "brave/components/brave_component_updater/browser/switches.h"
+#include "brave/components/greaselion/browser/features.h"
 #include "brave/components/greaselion/browser/greaselion_download_service.h"
+#include "brave/components/greaselion/browser/greaselion_rule_bundle.h"
 #include "brave/components/update_client/buildflags.h"
 #include "brave/components/version_info//version_info.h"
 #include "chrome/browser/extensions/extension_service.h"
+#include "components/value_store/value_store.h"
 #include "components/version_info/version_info.h"
+#include "crypto/secure_hash.h"
 #include "crypto/sha2.h"
+#include "extensions/browser/api/storage/settings_namespace.h"
+#include "extensions/browser/api/storage/storage_frontend.h"
 #include "extensions/browser/computed_hashes.h"
 #include "extensions/browser/extension_registry.h"
 #include "extensions/browser/extension_system.h"
@@ -55,6 +68,14 @@ namespace {
 
 constexpr char kRunAtDocumentStart[] = "document_start";
 
+constexpr char kExtensionCacheDirectoryName[] = "Cache";
+
+constexpr char kBundledExtensionName[] = "Brave Greaselion";
+
+// Identifies the format of the bundle script, so that bundles cached by a
+// build with a different format are not reused.
+constexpr char kBundledExtensionFormatVersion[] = "2";
+
 bool ShouldComputeHashesForResource(
     const base::FilePath& relative_resource_path) {
   std::vector<base::FilePath::StringType> components =
@@ -62,29 +83,138 @@ bool ShouldComputeHashesForResource(
   return !components.empty() && components[0] != extensions::kMetadataFolder;
 }
 
-// Wraps a Greaselion rule in a component. The component is stored as
-// an unpacked extension in the user data dir. Returns a valid
-// extension that the caller should take ownership of, or nullptr.
+// Greaselion scripts are not signed, but the public key for an extension
+// doubles as its unique identity, and we need one of those, so we add the
+// rule name to a known Brave domain and hash the result to create a public
+// key.
+std::string GetPublicKeyPrefix() {
+  const base::CommandLine& command_line =
+      *base::CommandLine::ForCurrentProcess();
+  if (!command_line.HasSwitch(brave_component_updater::kUseGoUpdateDev) &&
+      !base::FeatureList::IsEnabled(
+          brave_component_updater::kUseDevUpdaterUrl)) {
+    return BUILDFLAG(UPDATER_DEV_ENDPOINT);
+  }
+
+  return BUILDFLAG(UPDATER_PROD_ENDPOINT);
+}
+
+void HashString(crypto::SecureHash* hash, const std::string& value) {
+  DCHECK(hash);
+
+  // Prefix with the length so that adjacent fields cannot run into each other.
+  const uint64_t length = value.length();
+  hash->Update(&length, sizeof(length));
+  hash->Update(value.data(), value.length());
+}
+
+bool HashFile(crypto::SecureHash* hash, const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents)) {
+    return false;
+  }
+
+  HashString(hash, contents);
+  return true;
+}
+
+// Returns a key which identifies the extension generated for |rule|, or
+// |absl::nullopt| if the rule's files could not be read. The key covers
+// everything that is written to the extension directory, so a cached
+// extension can be reused for as long as the key does not change.
 //
 // NOTE: This function does file IO and should not be called on the UI thread.
-absl::optional<greaselion::GreaselionServiceImpl::GreaselionConvertedExtension>
-ConvertGreaselionRuleToExtensionOnTaskRunner(
+absl::optional<std::string> ComputeExtensionCacheKey(
     const greaselion::GreaselionRule& rule,
-    const base::FilePath& install_dir) {
-  base::FilePath install_temp_dir =
-      extensions::file_util::GetInstallTempDir(install_dir);
-  if (install_temp_dir.empty()) {
-    LOG(ERROR) << "Could not get path to profile temp directory";
-    return absl::nullopt;
+    const std::string& browser_version) {
+  std::unique_ptr<crypto::SecureHash> hash =
+      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
+
+  // The Chromium version is included as it determines how the extension is
+  // loaded and verified.
+  HashString(hash.get(), version_info::GetVersionNumber());
+  HashString(hash.get(), browser_version);
+  HashString(hash.get(), GetPublicKeyPrefix());
+  HashString(hash.get(), rule.name());
+  HashString(hash.get(), rule.run_at());
+
+  for (const auto& url_pattern : rule.url_patterns()) {
+    HashString(hash.get(), url_pattern);
   }
 
-  base::ScopedTempDir temp_dir;
-  if (!temp_dir.CreateUniqueTempDirUnderPath(install_temp_dir)) {
-    LOG(ERROR) << "Could not create Greaselion temp directory";
-    return absl::nullopt;
+  for (const auto& script : rule.scripts()) {
+    HashString(hash.get(), script.BaseName().AsUTF8Unsafe());
+    if (!HashFile(hash.get(), script)) {
+      LOG(ERROR) << "Could not read Greaselion script at path: "
+                 << script.LossyDisplayName();
+      return absl::nullopt;
+    }
   }
 
-  // Create the manifest
+  if (!rule.messages().empty()) {
+    std::vector<base::FilePath> message_files;
+    base::FileEnumerator enumerator(rule.messages(), /*recursive*/ true,
+                                    base::FileEnumerator::FILES);
+    for (base::FilePath path = enumerator.Next(); !path.empty();
+         path = enumerator.Next()) {
+      message_files.push_back(path);
+    }
+    base::ranges::sort(message_files);
+
+    for (const auto& path : message_files) {
+      base::FilePath relative_path;
+      rule.messages().AppendRelativePath(path, &relative_path);
+      HashString(hash.get(), relative_path.AsUTF8Unsafe());
+      if (!HashFile(hash.get(), path)) {
+        LOG(ERROR) << "Could not read Greaselion messages at path: "
+                   << path.LossyDisplayName();
+        return absl::nullopt;
+      }
+    }
+  }
+
+  uint8_t digest[crypto::kSHA256Length];
+  hash->Finish(digest, sizeof(digest));
+  return base::ToLowerASCII(base::HexEncode(digest, sizeof(digest)));
+}
+
+// Returns a key which identifies the extension generated for the bundled
+// |rules|, or |absl::nullopt| if the files of one of the rules could not be
+// read. The bundle gates rules on the feature state when it runs, so the key
+// covers the rules' preconditions but not the state.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+absl::optional<std::string> ComputeBundledExtensionCacheKey(
+    const std::vector<greaselion::GreaselionRule>& rules,
+    const std::string& browser_version) {
+  std::unique_ptr<crypto::SecureHash> hash =
+      crypto::SecureHash::Create(crypto::SecureHash::SHA256);
+
+  HashString(hash.get(), kBundledExtensionName);
+  HashString(hash.get(), kBundledExtensionFormatVersion);
+  for (const auto& rule : rules) {
+    const absl::optional<std::string> cache_key =
+        ComputeExtensionCacheKey(rule, browser_version);
+    if (!cache_key) {
+      return absl::nullopt;
+    }
+    HashString(hash.get(), *cache_key);
+
+    std::string preconditions;
+    base::JSONWriter::Write(
+        base::Value(greaselion::GetGreaselionRuleBundlePreconditions(rule)),
+        &preconditions);
+    HashString(hash.get(), preconditions);
+  }
+
+  uint8_t digest[crypto::kSHA256Length];
+  hash->Finish(digest, sizeof(digest));
+  return base::ToLowerASCII(base::HexEncode(digest, sizeof(digest)));
+}
+
+// Creates a manifest for an extension named |name| without any content
+// scripts.
+base::Value::Dict CreateGreaselionManifest(const std::string& name) {
   base::Value::Dict root;
 
   // manifest version is always 2
@@ -92,33 +222,56 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
   root.SetByDottedPath(extensions::manifest_keys::kManifestVersion, 2);
 
   // Create the public key.
-  // Greaselion scripts are not signed, but the public key for an extension
-  // doubles as its unique identity, and we need one of those, so we add the
-  // rule name to a known Brave domain and hash the result to create a
-  // public key.
   char raw[crypto::kSHA256Length] = {0};
   std::string key;
-  std::string script_name = rule.name();
-  const base::CommandLine& command_line =
-      *base::CommandLine::ForCurrentProcess();
-  if (!command_line.HasSwitch(brave_component_updater::kUseGoUpdateDev) &&
-      !base::FeatureList::IsEnabled(
-          brave_component_updater::kUseDevUpdaterUrl)) {
-    crypto::SHA256HashString(BUILDFLAG(UPDATER_DEV_ENDPOINT) + script_name, raw,
-                             crypto::kSHA256Length);
-  } else {
-    crypto::SHA256HashString(BUILDFLAG(UPDATER_PROD_ENDPOINT) + script_name,
-                             raw, crypto::kSHA256Length);
-  }
+  crypto::SHA256HashString(GetPublicKeyPrefix() + name, raw,
+                           crypto::kSHA256Length);
   base::Base64Encode(base::StringPiece(raw, crypto::kSHA256Length), &key);
 
-  root.SetByDottedPath(extensions::manifest_keys::kName, script_name);
+  root.SetByDottedPath(extensions::manifest_keys::kName, name);
   root.SetByDottedPath(extensions::manifest_keys::kVersion, "1.0");
   root.SetByDottedPath(extensions::manifest_keys::kDescription, "");
   root.SetByDottedPath(extensions::manifest_keys::kPublicKey, key);
   root.SetByDottedPath("incognito",
                        extensions::manifest_values::kIncognitoNotAllowed);
 
+  return root;
+}
+
+extensions::api::content_scripts::RunAt GetContentScriptRunAt(
+    const std::string& run_at) {
+  // All Greaselion scripts default to document end.
+  return run_at == kRunAtDocumentStart
+             ? extensions::api::content_scripts::RUN_AT_DOCUMENT_START
+             : extensions::api::content_scripts::RUN_AT_DOCUMENT_END;
+}
+
+bool WriteGreaselionManifest(base::Value::Dict root,
+                             const base::FilePath& extension_dir) {
+  base::FilePath manifest_path =
+      extension_dir.Append(extensions::kManifestFilename);
+  JSONFileValueSerializer serializer(manifest_path);
+  // If you read the header file for this function, it says not to use it
+  // outside unit tests because it writes to disk (which blocks the thread). I
+  // just want to assure you that it's okay. We want to write to disk here, and
+  // we're already on a task runner specifically for writing extension-related
+  // files to disk.
+  if (!serializer.Serialize(base::Value(std::move(root)))) {
+    LOG(ERROR) << "Could not write Greaselion manifest";
+    return false;
+  }
+
+  return true;
+}
+
+// Writes the unpacked extension for |rule| to |extension_dir|.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+bool WriteGreaselionExtension(const greaselion::GreaselionRule& rule,
+                              const base::FilePath& extension_dir) {
+  // Create the manifest
+  base::Value::Dict root = CreateGreaselionManifest(rule.name());
+
   std::vector<std::string> matches;
   matches.reserve(rule.url_patterns().size());
   for (auto url_pattern : rule.url_patterns())
@@ -131,11 +284,7 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
   for (auto script : rule.scripts())
     content_script.js->push_back(script.BaseName().AsUTF8Unsafe());
 
-  // All Greaselion scripts default to document end.
-  content_script.run_at =
-      rule.run_at() == kRunAtDocumentStart
-          ? extensions::api::content_scripts::RUN_AT_DOCUMENT_START
-          : extensions::api::content_scripts::RUN_AT_DOCUMENT_END;
+  content_script.run_at = GetContentScriptRunAt(rule.run_at());
 
   if (!rule.messages().empty()) {
     root.SetByDottedPath(extensions::manifest_keys::kDefaultLocale, "en_US");
@@ -147,47 +296,160 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
   root.Set(extensions::api::content_scripts::ManifestKeys::kContentScripts,
            std::move(content_scripts));
 
-  base::FilePath manifest_path =
-      temp_dir.GetPath().Append(extensions::kManifestFilename);
-  JSONFileValueSerializer serializer(manifest_path);
-  // If you read the header file for this function, it says not to use it
-  // outside unit tests because it writes to disk (which blocks the thread). I
-  // just want to assure you that it's okay. We want to write to disk here, and
-  // we're already on a task runner specifically for writing extension-related
-  // files to disk.
-  if (!serializer.Serialize(base::Value(std::move(root)))) {
-    LOG(ERROR) << "Could not write Greaselion manifest";
-    return absl::nullopt;
+  if (!WriteGreaselionManifest(std::move(root), extension_dir)) {
+    return false;
   }
 
   // Copy the messages directory to our extension directory.
   if (!rule.messages().empty()) {
     if (!base::CopyDirectory(
             rule.messages(),
-            temp_dir.GetPath().AppendASCII("_locales"), true)) {
+            extension_dir.AppendASCII("_locales"), true)) {
       LOG(ERROR) << "Could not copy Greaselion messages directory at path: "
                  << rule.messages().LossyDisplayName();
-      return absl::nullopt;
+      return false;
     }
   }
 
   // Copy the script files to our extension directory.
   for (auto script : rule.scripts()) {
-    if (!base::CopyFile(script,
-                        temp_dir.GetPath().Append(script.BaseName()))) {
+    if (!base::CopyFile(script, extension_dir.Append(script.BaseName()))) {
       LOG(ERROR) << "Could not copy Greaselion script at path: "
           << script.LossyDisplayName();
-      return absl::nullopt;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Writes a single unpacked extension for all of |rules| to |extension_dir|.
+// The extension has one content script per run_at value, which matches the
+// URL patterns of all of the rules and dispatches to the scripts of the rules
+// that match the page, see |BuildGreaselionRuleBundleScript|.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+bool WriteBundledGreaselionExtension(
+    const std::vector<greaselion::GreaselionRule>& rules,
+    const base::FilePath& extension_dir) {
+  std::map<extensions::api::content_scripts::RunAt,
+           std::vector<greaselion::GreaselionRule>>
+      run_at_rules;
+  for (const auto& rule : rules) {
+    run_at_rules[GetContentScriptRunAt(rule.run_at())].push_back(rule);
+  }
+
+  base::Value::List content_scripts;
+  for (const auto& [run_at, rules_to_bundle] : run_at_rules) {
+    const absl::optional<std::string> script =
+        greaselion::BuildGreaselionRuleBundleScript(rules_to_bundle);
+    if (!script) {
+      return false;
     }
+
+    const std::string script_name = base::StrCat(
+        {"greaselion_", extensions::api::content_scripts::ToString(run_at),
+         ".js"});
+    if (!base::WriteFile(extension_dir.AppendASCII(script_name), *script)) {
+      LOG(ERROR) << "Could not write Greaselion bundle script";
+      return false;
+    }
+
+    base::flat_set<std::string> matches;
+    for (const auto& rule : rules_to_bundle) {
+      const std::vector<std::string> url_patterns = rule.url_patterns();
+      matches.insert(url_patterns.cbegin(), url_patterns.cend());
+    }
+
+    extensions::api::content_scripts::ContentScript content_script;
+    content_script.matches = std::move(matches).extract();
+    content_script.js.emplace();
+    content_script.js->push_back(script_name);
+    content_script.run_at = run_at;
+    content_scripts.Append(content_script.ToValue());
   }
 
+  base::Value::Dict root = CreateGreaselionManifest(kBundledExtensionName);
+  root.Set(extensions::api::content_scripts::ManifestKeys::kContentScripts,
+           std::move(content_scripts));
+
+  // The bundle reads the feature state from chrome.storage.local.
+  base::Value::List permissions;
+  permissions.Append("storage");
+  root.Set(extensions::manifest_keys::kPermissions, std::move(permissions));
+
+  return WriteGreaselionManifest(std::move(root), extension_dir);
+}
+
+scoped_refptr<Extension> LoadGreaselionExtension(
+    const base::FilePath& extension_dir) {
   std::string error;
   scoped_refptr<Extension> extension = extensions::file_util::LoadExtension(
-      temp_dir.GetPath(), ManifestLocation::kComponent, Extension::NO_FLAGS,
+      extension_dir, ManifestLocation::kComponent, Extension::NO_FLAGS,
       &error);
   if (!extension.get()) {
     LOG(ERROR) << "Could not load Greaselion extension";
     LOG(ERROR) << error;
+    return nullptr;
+  }
+
+  return extension;
+}
+
+// Loads the unpacked extension cached under |cache_key|, or writes it using
+// |write_extension| if it is not already cached. Returns a valid extension
+// that the caller should take ownership of, or nullptr.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+absl::optional<greaselion::GreaselionServiceImpl::GreaselionConvertedExtension>
+LoadOrCreateCachedExtension(
+    const std::string& cache_key,
+    const base::FilePath& install_dir,
+    base::OnceCallback<bool(const base::FilePath&)> write_extension) {
+  const base::FilePath cache_dir =
+      greaselion::GreaselionServiceImpl::GetExtensionCacheDirectory(
+          install_dir);
+  const base::FilePath extension_dir = cache_dir.AppendASCII(cache_key);
+  if (base::PathExists(extension_dir)) {
+    if (scoped_refptr<Extension> extension =
+            LoadGreaselionExtension(extension_dir)) {
+      return std::make_pair(extension, extension_dir);
+    }
+
+    // The cached extension is unusable, so generate it again.
+    base::DeletePathRecursively(extension_dir);
+  }
+
+  base::FilePath install_temp_dir =
+      extensions::file_util::GetInstallTempDir(install_dir);
+  if (install_temp_dir.empty()) {
+    LOG(ERROR) << "Could not get path to profile temp directory";
+    return absl::nullopt;
+  }
+
+  base::ScopedTempDir temp_dir;
+  if (!temp_dir.CreateUniqueTempDirUnderPath(install_temp_dir)) {
+    LOG(ERROR) << "Could not create Greaselion temp directory";
+    return absl::nullopt;
+  }
+
+  if (!std::move(write_extension).Run(temp_dir.GetPath())) {
+    return absl::nullopt;
+  }
+
+  // Move the complete extension into the cache so that a partially written
+  // extension is never reused.
+  if (!base::CreateDirectory(cache_dir) ||
+      !base::Move(temp_dir.GetPath(), extension_dir)) {
+    LOG(ERROR) << "Could not move Greaselion extension to cache directory";
+    return absl::nullopt;
+  }
+  // |temp_dir| no longer exists.
+  std::ignore = temp_dir.Take();
+
+  scoped_refptr<Extension> extension = LoadGreaselionExtension(extension_dir);
+  if (!extension) {
+    base::DeletePathRecursively(extension_dir);
     return absl::nullopt;
   }
 
@@ -204,28 +466,113 @@ ConvertGreaselionRuleToExtensionOnTaskRunner(
             extensions::file_util::GetComputedHashesPath(extension->path()));
   }
 
-  // Take ownership of this temporary directory; the service will delete it on
-  // exit
-  return std::make_pair(extension, temp_dir.Take());
+  return std::make_pair(extension, extension_dir);
 }
 
-void DeleteExtensionDirs(const std::vector<base::FilePath>& extension_dirs) {
-  for (const auto& extension_dir : extension_dirs) {
-    base::DeletePathRecursively(extension_dir);
+// Wraps a Greaselion rule in a component. The component is stored as an
+// unpacked extension in the extension cache directory, keyed by
+// |ComputeExtensionCacheKey|, and is only generated if it is not already
+// cached. Returns a valid extension that the caller should take ownership of,
+// or nullptr.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+absl::optional<greaselion::GreaselionServiceImpl::GreaselionConvertedExtension>
+ConvertGreaselionRuleToExtensionOnTaskRunner(
+    const greaselion::GreaselionRule& rule,
+    const base::FilePath& install_dir,
+    const std::string& browser_version) {
+  const absl::optional<std::string> cache_key =
+      ComputeExtensionCacheKey(rule, browser_version);
+  if (!cache_key) {
+    return absl::nullopt;
+  }
+
+  return LoadOrCreateCachedExtension(
+      *cache_key, install_dir,
+      base::BindOnce(&WriteGreaselionExtension, rule));
+}
+
+// Wraps all of |rules| in a single component, which is cached like the
+// components generated by |ConvertGreaselionRuleToExtensionOnTaskRunner|.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+absl::optional<greaselion::GreaselionServiceImpl::GreaselionConvertedExtension>
+ConvertGreaselionRulesToBundledExtensionOnTaskRunner(
+    const std::vector<greaselion::GreaselionRule>& rules,
+    const base::FilePath& install_dir,
+    const std::string& browser_version) {
+  const absl::optional<std::string> cache_key =
+      ComputeBundledExtensionCacheKey(rules, browser_version);
+  if (!cache_key) {
+    return absl::nullopt;
+  }
+
+  return LoadOrCreateCachedExtension(
+      *cache_key, install_dir,
+      base::BindOnce(&WriteBundledGreaselionExtension, rules));
+}
+
+// Deletes cached extensions which were not generated for any of |rules|, or
+// for the bundle of |bundled_rules|, i.e. for rules which were removed or
+// whose scripts changed.
+//
+// NOTE: This function does file IO and should not be called on the UI thread.
+void PruneExtensionCacheOnTaskRunner(
+    const std::vector<greaselion::GreaselionRule>& rules,
+    const std::vector<greaselion::GreaselionRule>& bundled_rules,
+    const base::FilePath& install_dir,
+    const std::string& browser_version) {
+  base::flat_set<std::string> cache_keys;
+  for (const auto& rule : rules) {
+    if (absl::optional<std::string> cache_key =
+            ComputeExtensionCacheKey(rule, browser_version)) {
+      cache_keys.insert(*cache_key);
+    }
+  }
+
+  if (!bundled_rules.empty()) {
+    if (absl::optional<std::string> cache_key =
+            ComputeBundledExtensionCacheKey(bundled_rules, browser_version)) {
+      cache_keys.insert(*cache_key);
+    }
+  }
+
+  base::FileEnumerator enumerator(
+      greaselion::GreaselionServiceImpl::GetExtensionCacheDirectory(
+          install_dir),
+      /*recursive*/ false, base::FileEnumerator::DIRECTORIES);
+  for (base::FilePath path = enumerator.Next(); !path.empty();
+       path = enumerator.Next()) {
+    if (!cache_keys.contains(path.BaseName().AsUTF8Unsafe())) {
+      base::DeletePathRecursively(path);
+    }
   }
 }
 
+void WriteBundledExtensionStateToStorage(base::Value::Dict state,
+                                         value_store::ValueStore* storage) {
+  if (!storage) {
+    return;
+  }
+
+  storage->Set(value_store::ValueStore::DEFAULTS,
+               greaselion::kGreaselionRuleBundleStateKey,
+               base::Value(std::move(state)));
+}
+
 }  // namespace
 
 namespace greaselion {
 
 GreaselionServiceImpl::GreaselionServiceImpl(
+    content::BrowserContext* browser_context,
     GreaselionDownloadService* download_service,
     const base::FilePath& install_directory,
     extensions::ExtensionSystem* extension_system,
     extensions::ExtensionRegistry* extension_registry,
     scoped_refptr<base::SequencedTaskRunner> task_runner)
-    : download_service_(download_service),
+    : browser_context_(browser_context),
+      download_service_(download_service),
       install_directory_(install_directory),
       extension_system_(extension_system),
       extension_service_(extension_system->extension_service()),
@@ -251,8 +598,12 @@ GreaselionServiceImpl::~GreaselionServiceImpl() = default;
 void GreaselionServiceImpl::Shutdown() {
   download_service_->RemoveObserver(this);
   extension_registry_->RemoveObserver(this);
-  task_runner_->PostTask(FROM_HERE,
-                         base::BindOnce(&DeleteExtensionDirs, extension_dirs_));
+}
+
+// static
+base::FilePath GreaselionServiceImpl::GetExtensionCacheDirectory(
+    const base::FilePath& install_directory) {
+  return install_directory.AppendASCII(kExtensionCacheDirectoryName);
 }
 
 bool GreaselionServiceImpl::IsGreaselionExtension(const std::string& id) {
@@ -296,41 +647,101 @@ void GreaselionServiceImpl::CreateAndInstallExtensions() {
   all_rules_installed_successfully_ = true;
   pending_installs_ = 0;
 
-  // At this point, any GL extensions that were previously loaded have now been
-  // unloaded. We can now clean up their corresponding temp folders.
-  if (!extension_dirs_.empty()) {
-    task_runner_->PostTask(
-        FROM_HERE,
-        base::BindOnce(&DeleteExtensionDirs, std::move(extension_dirs_)));
-  }
-
   std::vector<std::unique_ptr<GreaselionRule>>* rules =
       download_service_->rules();
+
+  // When bundling is enabled, rules which can be bundled are installed as a
+  // single extension and all other rules are installed as an extension each.
+  // The bundle contains every bundled rule whatever the feature state, and
+  // gates them on the state when it runs, so that toggling a feature does not
+  // change the bundle.
+  std::vector<GreaselionRule> all_rules;
+  std::vector<GreaselionRule> rules_to_install;
+  std::vector<GreaselionRule> rules_to_bundle;
   for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_, browser_version_) &&
-        rule->has_unknown_preconditions() == false) {
-      pending_installs_ += 1;
+    all_rules.push_back(*rule);
+    if (rule->has_unknown_preconditions()) {
+      continue;
+    }
+    if (ShouldBundleRule(*rule)) {
+      if (rule->MatchesStaticPreconditions(state_, browser_version_)) {
+        rules_to_bundle.push_back(*rule);
+      }
+    } else if (rule->Matches(state_, browser_version_)) {
+      rules_to_install.push_back(*rule);
     }
   }
+
+  // At this point, any GL extensions that were previously loaded have now been
+  // unloaded. Cached extensions for rules which no longer exist or whose
+  // scripts changed can be deleted. Extensions for rules which do not match
+  // the current state are kept so that toggling a feature does not regenerate
+  // them.
+  task_runner_->PostTask(
+      FROM_HERE,
+      base::BindOnce(&PruneExtensionCacheOnTaskRunner, std::move(all_rules),
+                     rules_to_bundle, install_directory_,
+                     browser_version_.GetString()));
+
+  pending_installs_ =
+      static_cast<int>(rules_to_install.size()) + !rules_to_bundle.empty();
   if (!pending_installs_) {
     // no rules match, nothing else to do
     MaybeNotifyObservers();
     return;
   }
-  for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_, browser_version_) &&
-        rule->has_unknown_preconditions() == false) {
-      // Convert script file to component extension. This must run on extension
-      // file task runner, which was passed in in the constructor.
-      GreaselionRule rule_copy(*rule);
-      base::PostTaskAndReplyWithResult(
-          task_runner_.get(), FROM_HERE,
-          base::BindOnce(&ConvertGreaselionRuleToExtensionOnTaskRunner,
-                         rule_copy, install_directory_),
-          base::BindOnce(&GreaselionServiceImpl::PostConvert,
-                         weak_factory_.GetWeakPtr()));
-    }
+  // Convert script files to component extensions. This must run on extension
+  // file task runner, which was passed in in the constructor.
+  for (const GreaselionRule& rule : rules_to_install) {
+    base::PostTaskAndReplyWithResult(
+        task_runner_.get(), FROM_HERE,
+        base::BindOnce(&ConvertGreaselionRuleToExtensionOnTaskRunner, rule,
+                       install_directory_, browser_version_.GetString()),
+        base::BindOnce(&GreaselionServiceImpl::PostConvert,
+                       weak_factory_.GetWeakPtr()));
+  }
+  if (!rules_to_bundle.empty()) {
+    base::PostTaskAndReplyWithResult(
+        task_runner_.get(), FROM_HERE,
+        base::BindOnce(&ConvertGreaselionRulesToBundledExtensionOnTaskRunner,
+                       std::move(rules_to_bundle), install_directory_,
+                       browser_version_.GetString()),
+        base::BindOnce(&GreaselionServiceImpl::PostConvertBundle,
+                       weak_factory_.GetWeakPtr()));
+  }
+}
+
+bool GreaselionServiceImpl::ShouldBundleRule(const GreaselionRule& rule) const {
+  return base::FeatureList::IsEnabled(features::kGreaselionBundleRules) &&
+         CanBundleGreaselionRule(rule);
+}
+
+void GreaselionServiceImpl::PostConvertBundle(
+    absl::optional<GreaselionConvertedExtension> converted_extension) {
+  if (converted_extension) {
+    bundled_extension_ = converted_extension->first;
+    // Store the state before the bundle is added, so that it is there by the
+    // time the bundle first runs.
+    WriteBundledExtensionState();
+  }
+  PostConvert(std::move(converted_extension));
+}
+
+void GreaselionServiceImpl::WriteBundledExtensionState() {
+  if (!bundled_extension_) {
+    return;
   }
+
+  extensions::StorageFrontend* frontend =
+      extensions::StorageFrontend::Get(browser_context_);
+  if (!frontend) {
+    return;
+  }
+
+  frontend->RunWithStorage(
+      bundled_extension_, extensions::settings_namespace::LOCAL,
+      base::BindOnce(&WriteBundledExtensionStateToStorage,
+                     GetGreaselionRuleBundleState(state_)));
 }
 
 void GreaselionServiceImpl::PostConvert(
@@ -342,7 +753,6 @@ void GreaselionServiceImpl::PostConvert(
     LOG(ERROR) << "Could not load Greaselion script";
   } else {
     greaselion_extensions_.push_back(converted_extension->first->id());
-    extension_dirs_.push_back(converted_extension->second);
     extension_system_->ready().Post(
         FROM_HERE, base::BindOnce(&GreaselionServiceImpl::Install,
                                   weak_factory_.GetWeakPtr(),
@@ -377,6 +787,9 @@ void GreaselionServiceImpl::OnExtensionUnloaded(
     return;
   }
   greaselion_extensions_.erase(index);
+  if (bundled_extension_ && bundled_extension_->id() == extension->id()) {
+    bundled_extension_.reset();
+  }
   if (update_in_progress_ && greaselion_extensions_.empty()) {
     // It's time!
     CreateAndInstallExtensions();
@@ -415,10 +828,35 @@ void GreaselionServiceImpl::OnRulesReady(
 void GreaselionServiceImpl::SetFeatureEnabled(GreaselionFeature feature,
                                               bool enabled) {
   DCHECK(feature >= 0 && feature < LAST_FEATURE);
+  const GreaselionFeatures previous_state = state_;
   state_[feature] = enabled;
+
+  // Bundled rules are gated on the stored state when the bundle runs, so once
+  // the bundle is installed, only a change to the rules which are installed as
+  // separate extensions needs a reinstall.
+  if (bundled_extension_ && !update_in_progress_ &&
+      !InstalledRulesChanged(previous_state)) {
+    WriteBundledExtensionState();
+    return;
+  }
   UpdateInstalledExtensions();
 }
 
+bool GreaselionServiceImpl::InstalledRulesChanged(
+    const GreaselionFeatures& previous_state) const {
+  for (const std::unique_ptr<GreaselionRule>& rule :
+       *download_service_->rules()) {
+    if (rule->has_unknown_preconditions() || ShouldBundleRule(*rule)) {
+      continue;
+    }
+    if (rule->Matches(previous_state, browser_version_) !=
+        rule->Matches(state_, browser_version_)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool GreaselionServiceImpl::ready() {
   return !update_in_progress_;
 }
@@ -40,6 +40,7 @@ class GreaselionServiceImpl : public GreaselionService,
                               public GreaselionDownloadService::Observer {
  public:
   explicit GreaselionServiceImpl(
+      content::BrowserContext* browser_context,
       GreaselionDownloadService* download_service,
       const base::FilePath& install_directory,
       extensions::ExtensionSystem* extension_system,
@@ -71,17 +72,31 @@ class GreaselionServiceImpl : public GreaselionService,
   using GreaselionConvertedExtension =
       std::pair<scoped_refptr<extensions::Extension>, base::FilePath>;
 
+  // Generated extensions are cached in this directory across restarts, keyed
+  // by a hash of the rule, its scripts and the browser version.
+  static base::FilePath GetExtensionCacheDirectory(
+      const base::FilePath& install_directory);
+
  private:
   void SetBrowserVersionForTesting(const base::Version& version) override;
   void CreateAndInstallExtensions();
   void PostConvert(
       absl::optional<GreaselionConvertedExtension> converted_extension);
+  void PostConvertBundle(
+      absl::optional<GreaselionConvertedExtension> converted_extension);
+  bool ShouldBundleRule(const GreaselionRule& rule) const;
+  // Returns |true| if changing the feature state from |previous_state| to
+  // |state_| changes which rules are installed as separate extensions.
+  bool InstalledRulesChanged(const GreaselionFeatures& previous_state) const;
+  // Stores |state_| for the bundle to gate its rules on.
+  void WriteBundledExtensionState();
   void Install(scoped_refptr<extensions::Extension> extension);
   void MaybeNotifyObservers();
 
   // GreaselionDownloadService::Observer:
   void OnRulesReady(GreaselionDownloadService* download_service) override;
 
+  raw_ptr<content::BrowserContext> browser_context_ = nullptr;  // NOT OWNED
   raw_ptr<GreaselionDownloadService> download_service_ = nullptr;  // NOT OWNED
   GreaselionFeatures state_;
   const base::FilePath install_directory_;
@@ -98,7 +113,7 @@ class GreaselionServiceImpl : public GreaselionService,
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   base::ObserverList<GreaselionService::Observer> observers_;
   std::vector<extensions::ExtensionId> greaselion_extensions_;
-  std::vector<base::FilePath> extension_dirs_;
+  scoped_refptr<const extensions::Extension> bundled_extension_;
   base::Version browser_version_;
   base::WeakPtrFactory<GreaselionServiceImpl> weak_factory_;
 };
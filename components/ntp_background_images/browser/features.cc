@@ -25,5 +25,10 @@ const base::Feature kBraveNTPSuperReferralWallpaper {
 };
 #endif
 
+// Keeps wallpaper images in memory and prefetches the next ones so that NTP
+// doesn't read them from the component directory on every open.
+const base::Feature kBraveNTPImageCache{"BraveNTPImageCache",
+                                        base::FEATURE_ENABLED_BY_DEFAULT};
+
 }  // namespace features
 }  // namespace ntp_background_images
@@ -12,6 +12,7 @@ namespace ntp_background_images {
 namespace features {
 extern const base::Feature kBraveNTPBrandedWallpaperDemo;
 extern const base::Feature kBraveNTPSuperReferralWallpaper;
+extern const base::Feature kBraveNTPImageCache;
 }  // namespace features
 }  // namespace ntp_background_images
 
@@ -9,9 +9,9 @@
 #include <string>
 
 #include "base/memory/raw_ptr.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/memory/weak_ptr.h"
 #include "content/public/browser/url_data_source.h"
-#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace base {
 class FilePath;
@@ -47,7 +47,7 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   void GetImageFile(const base::FilePath& image_file_path,
                     GotDataCallback callback);
   void OnGotImageFile(GotDataCallback callback,
-                      absl::optional<std::string> input);
+                      scoped_refptr<base::RefCountedMemory> bytes);
   int GetWallpaperIndexFromPath(const std::string& path) const;
 
   raw_ptr<NTPBackgroundImagesService> service_ = nullptr;  // not owned
@@ -0,0 +1,172 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
+
+#include <string>
+#include <utility>
+
+#include "base/bind.h"
+#include "base/feature_list.h"
+#include "base/files/file_util.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/ntp_background_images/browser/features.h"
+
+namespace ntp_background_images {
+
+namespace {
+
+scoped_refptr<base::RefCountedMemory> ReadFileToMemory(
+    const base::FilePath& path) {
+  std::string contents;
+  if (!base::ReadFileToString(path, &contents))
+    return nullptr;
+  return base::RefCountedString::TakeString(&contents);
+}
+
+}  // namespace
+
+NTPImageCache::NTPImageCache(size_t max_bytes)
+    : max_bytes_(max_bytes),
+      cache_(decltype(cache_)::NO_AUTO_EVICT),
+      memory_pressure_listener_(std::make_unique<base::MemoryPressureListener>(
+          FROM_HERE,
+          base::BindRepeating(&NTPImageCache::OnMemoryPressure,
+                              base::Unretained(this)))) {}
+
+NTPImageCache::~NTPImageCache() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+}
+
+void NTPImageCache::GetImage(const base::FilePath& image_file_path,
+                             GetImageCallback callback) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!base::FeatureList::IsEnabled(features::kBraveNTPImageCache)) {
+    read_count_++;
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+        base::BindOnce(&ReadFileToMemory, image_file_path),
+        std::move(callback));
+    return;
+  }
+
+  if (auto bytes = GetCachedImage(image_file_path)) {
+    std::move(callback).Run(std::move(bytes));
+    return;
+  }
+
+  auto& callbacks = pending_reads_[image_file_path];
+  callbacks.push_back(std::move(callback));
+  if (callbacks.size() == 1)
+    ReadImage(image_file_path);
+}
+
+void NTPImageCache::Prefetch(const base::FilePath& image_file_path) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!base::FeatureList::IsEnabled(features::kBraveNTPImageCache))
+    return;
+
+  if (image_file_path.empty() || cache_.Peek(image_file_path) != cache_.end() ||
+      pending_reads_.count(image_file_path)) {
+    return;
+  }
+
+  pending_reads_[image_file_path];
+  ReadImage(image_file_path);
+}
+
+scoped_refptr<base::RefCountedMemory> NTPImageCache::GetCachedImage(
+    const base::FilePath& image_file_path) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  auto it = cache_.Get(image_file_path);
+  if (it == cache_.end())
+    return nullptr;
+  return it->second;
+}
+
+void NTPImageCache::Clear() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  cache_.Clear();
+  size_in_bytes_ = 0;
+  // Reads already in flight may return files from a removed install dir.
+  generation_++;
+}
+
+size_t NTPImageCache::GetReadCountForTesting() const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return read_count_;
+}
+
+void NTPImageCache::ReadImage(const base::FilePath& image_file_path) {
+  read_count_++;
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ReadFileToMemory, image_file_path),
+      base::BindOnce(&NTPImageCache::OnReadImage, weak_factory_.GetWeakPtr(),
+                     image_file_path, generation_));
+}
+
+void NTPImageCache::OnReadImage(const base::FilePath& image_file_path,
+                                uint64_t generation,
+                                scoped_refptr<base::RefCountedMemory> bytes) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (bytes && generation == generation_)
+    Put(image_file_path, bytes);
+
+  auto node = pending_reads_.extract(image_file_path);
+  if (node.empty())
+    return;
+
+  for (auto& callback : node.mapped())
+    std::move(callback).Run(bytes);
+}
+
+void NTPImageCache::Put(const base::FilePath& image_file_path,
+                        scoped_refptr<base::RefCountedMemory> bytes) {
+  // Don't let a single oversized image flush everything else.
+  if (bytes->size() > max_bytes_)
+    return;
+
+  auto it = cache_.Peek(image_file_path);
+  if (it != cache_.end()) {
+    size_in_bytes_ -= it->second->size();
+    cache_.Erase(it);
+  }
+
+  EvictUntilWithinLimit(max_bytes_ - bytes->size());
+  size_in_bytes_ += bytes->size();
+  cache_.Put(image_file_path, std::move(bytes));
+}
+
+void NTPImageCache::EvictUntilWithinLimit(size_t limit) {
+  while (size_in_bytes_ > limit && !cache_.empty()) {
+    auto oldest = cache_.rbegin();
+    size_in_bytes_ -= oldest->second->size();
+    cache_.Erase(oldest);
+  }
+}
+
+void NTPImageCache::OnMemoryPressure(
+    base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  switch (memory_pressure_level) {
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
+      EvictUntilWithinLimit(max_bytes_ / 2);
+      break;
+    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
+      Clear();
+      break;
+  }
+}
+
+}  // namespace ntp_background_images
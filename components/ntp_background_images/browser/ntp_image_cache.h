@@ -0,0 +1,101 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
+#define BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
+
+#include <stdint.h>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/gtest_prod_util.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequence_checker.h"
+
+namespace ntp_background_images {
+
+// Bounded in-memory cache of wallpaper/logo image bytes that is shared by
+// NTPBackgroundImagesSource and NTPSponsoredImagesSource. Images are keyed by
+// their path in the component directory. Entries are evicted in LRU order
+// once |max_bytes| is exceeded and dropped on memory pressure.
+class NTPImageCache {
+ public:
+  using GetImageCallback =
+      base::OnceCallback<void(scoped_refptr<base::RefCountedMemory>)>;
+
+  // Images are at most a few MB each, so this keeps the current and the next
+  // background and sponsored image plus their logos around.
+  static constexpr size_t kDefaultMaxBytes = 16 * 1024 * 1024;
+
+  explicit NTPImageCache(size_t max_bytes = kDefaultMaxBytes);
+  ~NTPImageCache();
+
+  NTPImageCache(const NTPImageCache&) = delete;
+  NTPImageCache& operator=(const NTPImageCache&) = delete;
+
+  // Runs |callback| with the image bytes, served from memory when cached and
+  // read from disk on a thread pool task otherwise. |callback| gets null when
+  // the file can't be read. Concurrent requests for the same path share one
+  // read.
+  void GetImage(const base::FilePath& image_file_path,
+                GetImageCallback callback);
+
+  // Loads |image_file_path| into the cache if it isn't there yet.
+  void Prefetch(const base::FilePath& image_file_path);
+
+  // Returns cached bytes without touching the disk.
+  scoped_refptr<base::RefCountedMemory> GetCachedImage(
+      const base::FilePath& image_file_path);
+
+  // Drops every cached image. Called when component data is updated because
+  // the previous install dir can be removed. Reads started before this call
+  // still run their callbacks but aren't cached.
+  void Clear();
+
+  size_t size_in_bytes() const { return size_in_bytes_; }
+  size_t entry_count() const { return cache_.size(); }
+
+  size_t GetReadCountForTesting() const;
+
+ private:
+  FRIEND_TEST_ALL_PREFIXES(NTPImageCacheTest, MemoryPressureEvictsCache);
+
+  void ReadImage(const base::FilePath& image_file_path);
+  void OnReadImage(const base::FilePath& image_file_path,
+                   uint64_t generation,
+                   scoped_refptr<base::RefCountedMemory> bytes);
+  void Put(const base::FilePath& image_file_path,
+           scoped_refptr<base::RefCountedMemory> bytes);
+  void EvictUntilWithinLimit(size_t limit);
+  void OnMemoryPressure(
+      base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level);
+
+  const size_t max_bytes_;
+  size_t size_in_bytes_ = 0;
+  // Incremented by Clear(). A read only populates the cache if no Clear()
+  // happened since it was started.
+  uint64_t generation_ = 0;
+  size_t read_count_ = 0;
+  base::LRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>> cache_;
+  // Callbacks waiting for an in-flight read. Prefetch adds an entry with no
+  // callback.
+  std::map<base::FilePath, std::vector<GetImageCallback>> pending_reads_;
+  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+
+  base::WeakPtrFactory<NTPImageCache> weak_factory_{this};
+};
+
+}  // namespace ntp_background_images
+
+#endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_NTP_IMAGE_CACHE_H_
@@ -0,0 +1,188 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ntp_background_images/browser/ntp_image_cache.h"
+
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/run_loop.h"
+#include "base/test/bind.h"
+#include "base/test/scoped_feature_list.h"
+#include "base/test/task_environment.h"
+#include "brave/components/ntp_background_images/browser/features.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ntp_background_images {
+
+class NTPImageCacheTest : public testing::Test {
+ public:
+  NTPImageCacheTest() = default;
+
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  base::FilePath WriteImage(const std::string& name, size_t size) {
+    const base::FilePath path = temp_dir_.GetPath().AppendASCII(name);
+    EXPECT_TRUE(base::WriteFile(path, std::string(size, 'x')));
+    return path;
+  }
+
+  scoped_refptr<base::RefCountedMemory> GetImage(NTPImageCache* cache,
+                                                 const base::FilePath& path) {
+    scoped_refptr<base::RefCountedMemory> result;
+    base::RunLoop run_loop;
+    cache->GetImage(path, base::BindLambdaForTesting(
+                              [&](scoped_refptr<base::RefCountedMemory> bytes) {
+                                result = std::move(bytes);
+                                run_loop.Quit();
+                              }));
+    run_loop.Run();
+    return result;
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(NTPImageCacheTest, ServesCachedImageWithoutDiskRead) {
+  NTPImageCache cache;
+  const base::FilePath path = WriteImage("wallpaper-1.jpg", 100);
+
+  auto bytes = GetImage(&cache, path);
+  ASSERT_TRUE(bytes);
+  EXPECT_EQ(100u, bytes->size());
+  EXPECT_EQ(1u, cache.entry_count());
+
+  // Second request must not touch the disk.
+  ASSERT_TRUE(base::DeleteFile(path));
+  bool called = false;
+  cache.GetImage(path, base::BindLambdaForTesting(
+                           [&](scoped_refptr<base::RefCountedMemory> bytes) {
+                             called = true;
+                             ASSERT_TRUE(bytes);
+                             EXPECT_EQ(100u, bytes->size());
+                           }));
+  // Served synchronously.
+  EXPECT_TRUE(called);
+}
+
+TEST_F(NTPImageCacheTest, MissingFileIsNotCached) {
+  NTPImageCache cache;
+  const base::FilePath path = temp_dir_.GetPath().AppendASCII("missing.jpg");
+  EXPECT_FALSE(GetImage(&cache, path));
+  EXPECT_EQ(0u, cache.entry_count());
+}
+
+TEST_F(NTPImageCacheTest, PrefetchLoadsImage) {
+  NTPImageCache cache;
+  const base::FilePath path = WriteImage("wallpaper-2.jpg", 10);
+
+  cache.Prefetch(path);
+  EXPECT_FALSE(cache.GetCachedImage(path));
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(cache.GetCachedImage(path));
+}
+
+TEST_F(NTPImageCacheTest, EvictsLeastRecentlyUsed) {
+  NTPImageCache cache(250);
+  const base::FilePath path1 = WriteImage("1.jpg", 100);
+  const base::FilePath path2 = WriteImage("2.jpg", 100);
+  const base::FilePath path3 = WriteImage("3.jpg", 100);
+
+  GetImage(&cache, path1);
+  GetImage(&cache, path2);
+  // Touch |path1| so |path2| becomes the oldest.
+  EXPECT_TRUE(cache.GetCachedImage(path1));
+  GetImage(&cache, path3);
+
+  EXPECT_EQ(2u, cache.entry_count());
+  EXPECT_EQ(200u, cache.size_in_bytes());
+  EXPECT_TRUE(cache.GetCachedImage(path1));
+  EXPECT_FALSE(cache.GetCachedImage(path2));
+  EXPECT_TRUE(cache.GetCachedImage(path3));
+
+  // Images larger than the cache are served but not kept.
+  const base::FilePath big_path = WriteImage("big.jpg", 300);
+  EXPECT_TRUE(GetImage(&cache, big_path));
+  EXPECT_FALSE(cache.GetCachedImage(big_path));
+  EXPECT_EQ(2u, cache.entry_count());
+}
+
+TEST_F(NTPImageCacheTest, MemoryPressureEvictsCache) {
+  NTPImageCache cache(400);
+  GetImage(&cache, WriteImage("1.jpg", 100));
+  GetImage(&cache, WriteImage("2.jpg", 100));
+  GetImage(&cache, WriteImage("3.jpg", 100));
+  EXPECT_EQ(300u, cache.size_in_bytes());
+
+  cache.OnMemoryPressure(
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
+  EXPECT_EQ(200u, cache.size_in_bytes());
+
+  cache.OnMemoryPressure(
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL);
+  EXPECT_EQ(0u, cache.entry_count());
+  EXPECT_EQ(0u, cache.size_in_bytes());
+}
+
+TEST_F(NTPImageCacheTest, ReadsFileOnce) {
+  NTPImageCache cache;
+  const base::FilePath path = WriteImage("wallpaper-3.jpg", 100);
+
+  // Requests made while the prefetch is in flight share its read.
+  cache.Prefetch(path);
+  int called = 0;
+  for (int i = 0; i < 2; ++i) {
+    cache.GetImage(path, base::BindLambdaForTesting(
+                             [&](scoped_refptr<base::RefCountedMemory> bytes) {
+                               EXPECT_TRUE(bytes);
+                               called++;
+                             }));
+  }
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(2, called);
+
+  EXPECT_TRUE(GetImage(&cache, path));
+  EXPECT_EQ(1u, cache.GetReadCountForTesting());
+}
+
+TEST_F(NTPImageCacheTest, ReadStartedBeforeClearIsNotCached) {
+  NTPImageCache cache;
+  const base::FilePath path = WriteImage("wallpaper-4.jpg", 100);
+
+  bool called = false;
+  cache.GetImage(path, base::BindLambdaForTesting(
+                           [&](scoped_refptr<base::RefCountedMemory> bytes) {
+                             EXPECT_TRUE(bytes);
+                             called = true;
+                           }));
+  cache.Clear();
+  task_environment_.RunUntilIdle();
+
+  EXPECT_TRUE(called);
+  EXPECT_EQ(0u, cache.entry_count());
+  EXPECT_EQ(0u, cache.size_in_bytes());
+}
+
+TEST_F(NTPImageCacheTest, FeatureDisabled) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndDisableFeature(features::kBraveNTPImageCache);
+  NTPImageCache cache;
+  const base::FilePath path = WriteImage("wallpaper-5.jpg", 100);
+
+  cache.Prefetch(path);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(0u, cache.GetReadCountForTesting());
+
+  EXPECT_TRUE(GetImage(&cache, path));
+  EXPECT_TRUE(GetImage(&cache, path));
+  EXPECT_EQ(0u, cache.entry_count());
+  EXPECT_EQ(2u, cache.GetReadCountForTesting());
+}
+
+}  // namespace ntp_background_images
@@ -41,6 +41,13 @@ std::tuple<size_t, size_t> ViewCounterModel::GetCurrentBrandedImageIndex()
           campaigns_current_branded_image_index_[current_campaign_index_]};
 }
 
+int ViewCounterModel::GetNextWallpaperImageIndex() const {
+  if (total_image_count_ == 0)
+    return current_wallpaper_image_index_;
+
+  return (current_wallpaper_image_index_ + 1) % total_image_count_;
+}
+
 bool ViewCounterModel::ShouldShowBrandedWallpaper() const {
   if (always_show_branded_wallpaper_)
     return true;
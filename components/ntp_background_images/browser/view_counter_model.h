@@ -32,6 +32,10 @@ class ViewCounterModel {
     return current_wallpaper_image_index_;
   }
 
+  // Returns the background image index that the next page view will most
+  // likely use. Only used as a hint for prefetching image data.
+  int GetNextWallpaperImageIndex() const;
+
   void set_total_image_count(int count) { total_image_count_ = count; }
 
   void set_always_show_branded_wallpaper(bool show) {
@@ -332,6 +332,7 @@ void ViewCounterService::RegisterPageView() {
   service_->CheckNTPSIComponentUpdateIfNeeded();
   model_.RegisterPageView();
   MaybePrefetchNewTabPageAd();
+  PrefetchWallpaperImages();
 }
 
 void ViewCounterService::BrandedWallpaperLogoClicked(
@@ -435,6 +436,48 @@ void ViewCounterService::MaybePrefetchNewTabPageAd() {
   ads_service_->PrefetchNewTabPageAd();
 }
 
+void ViewCounterService::PrefetchWallpaperImages() {
+  if (!base::FeatureList::IsEnabled(features::kBraveNTPImageCache))
+    return;
+
+  auto* image_cache = service_->image_cache();
+
+  if (IsBackgroundWallpaperActive() && !ShouldShowCustomBackground()) {
+    if (auto* data = GetCurrentWallpaperData();
+        data && !data->backgrounds.empty()) {
+      const size_t total = data->backgrounds.size();
+      image_cache->Prefetch(
+          data->backgrounds[model_.current_wallpaper_image_index() % total]
+              .image_file);
+      image_cache->Prefetch(
+          data->backgrounds[model_.GetNextWallpaperImageIndex() % total]
+              .image_file);
+    }
+  }
+
+  if (!IsBrandedWallpaperActive())
+    return;
+
+  // Branded image indexes are picked for the upcoming branded view when the
+  // previous one is registered, so the current index is the next one shown.
+  auto* data = GetCurrentBrandedWallpaperData();
+  if (!data || data->campaigns.empty())
+    return;
+
+  size_t campaign_index;
+  size_t background_index;
+  std::tie(campaign_index, background_index) =
+      model_.GetCurrentBrandedImageIndex();
+  if (campaign_index >= data->campaigns.size())
+    return;
+  const auto& backgrounds = data->campaigns[campaign_index].backgrounds;
+  if (background_index >= backgrounds.size())
+    return;
+
+  image_cache->Prefetch(backgrounds[background_index].image_file);
+  image_cache->Prefetch(backgrounds[background_index].logo.image_file);
+}
+
 void ViewCounterService::UpdateP3AValues() const {
   uint64_t new_tab_count = new_tab_count_state_->GetHighestValueInWeek();
   p3a_utils::RecordToHistogramBucket("Brave.NTP.NewTabsCreated",
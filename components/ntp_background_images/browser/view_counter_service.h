@@ -157,6 +157,10 @@ class ViewCounterService : public KeyedService,
 
   void MaybePrefetchNewTabPageAd();
 
+  // Loads the images that the current and the next NTP will show into the
+  // shared image cache so they are served without disk I/O.
+  void PrefetchWallpaperImages();
+
   void UpdateP3AValues() const;
 
   raw_ptr<NTPBackgroundImagesService> service_ = nullptr;
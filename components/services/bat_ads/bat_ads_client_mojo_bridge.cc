@@ -7,7 +7,12 @@
 
 #include <utility>
 
+#include "base/bind.h"
+#include "base/callback_helpers.h"
+#include "base/check.h"
+#include "base/json/values_util.h"
 #include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/time/time.h"
 #include "bat/ads/notification_ad_info.h"
 #include "bat/ads/notification_ad_value_util.h"
@@ -19,8 +24,14 @@
 namespace bat_ads {
 
 BatAdsClientMojoBridge::BatAdsClientMojoBridge(
-    mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info) {
+    mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
+    mojom::BatAdsClientStatePtr state) {
+  DCHECK(state);
+
   bat_ads_client_.Bind(std::move(client_info));
+
+  prefs_ = std::move(state->prefs);
+  is_browser_active_ = state->is_browser_active;
 }
 
 BatAdsClientMojoBridge::~BatAdsClientMojoBridge() = default;
@@ -47,13 +58,7 @@ bool BatAdsClientMojoBridge::IsNetworkConnectionAvailable() const {
 }
 
 bool BatAdsClientMojoBridge::IsBrowserActive() const {
-  if (!connected()) {
-    return false;
-  }
-
-  bool is_browser_active = false;
-  bat_ads_client_->IsBrowserActive(&is_browser_active);
-  return is_browser_active;
+  return is_browser_active_;
 }
 
 bool BatAdsClientMojoBridge::IsBrowserInFullScreenMode() const {
@@ -94,27 +99,13 @@ void BatAdsClientMojoBridge::RecordAdEventForId(
     const std::string& id,
     const std::string& ad_type,
     const std::string& confirmation_type,
-    const base::Time time) const {
+    const base::Time time) {
   if (connected()) {
     bat_ads_client_->RecordAdEventForId(id, ad_type, confirmation_type, time);
   }
 }
 
-std::vector<base::Time> BatAdsClientMojoBridge::GetAdEventHistory(
-    const std::string& ad_type,
-    const std::string& confirmation_type) const {
-  if (!connected()) {
-    return {};
-  }
-
-  std::vector<base::Time> ad_event_history;
-  bat_ads_client_->GetAdEventHistory(ad_type, confirmation_type,
-                                     &ad_event_history);
-  return ad_event_history;
-}
-
-void BatAdsClientMojoBridge::ResetAdEventHistoryForId(
-    const std::string& id) const {
+void BatAdsClientMojoBridge::ResetAdEventHistoryForId(const std::string& id) {
   if (connected()) {
     bat_ads_client_->ResetAdEventHistoryForId(id);
   }
@@ -271,6 +262,10 @@ void BatAdsClientMojoBridge::Log(
 }
 
 bool BatAdsClientMojoBridge::GetBooleanPref(const std::string& path) const {
+  if (const base::Value* value = FindPrefValue(path)) {
+    return value->GetIfBool().value_or(false);
+  }
+
   if (!connected()) {
     return false;
   }
@@ -284,11 +279,16 @@ void BatAdsClientMojoBridge::SetBooleanPref(
     const std::string& path,
     const bool value) {
   if (connected()) {
-    bat_ads_client_->SetBooleanPref(path, value);
+    bat_ads_client_->SetBooleanPref(path, value,
+                                    UpdatePref(path, base::Value(value)));
   }
 }
 
 int BatAdsClientMojoBridge::GetIntegerPref(const std::string& path) const {
+  if (const base::Value* value = FindPrefValue(path)) {
+    return value->GetIfInt().value_or(0);
+  }
+
   if (!connected()) {
     return 0;
   }
@@ -302,11 +302,16 @@ void BatAdsClientMojoBridge::SetIntegerPref(
     const std::string& path,
     const int value) {
   if (connected()) {
-    bat_ads_client_->SetIntegerPref(path, value);
+    bat_ads_client_->SetIntegerPref(path, value,
+                                    UpdatePref(path, base::Value(value)));
   }
 }
 
 double BatAdsClientMojoBridge::GetDoublePref(const std::string& path) const {
+  if (const base::Value* value = FindPrefValue(path)) {
+    return value->GetIfDouble().value_or(0.0);
+  }
+
   if (!connected()) {
     return 0.0;
   }
@@ -320,12 +325,18 @@ void BatAdsClientMojoBridge::SetDoublePref(
     const std::string& path,
     const double value) {
   if (connected()) {
-    bat_ads_client_->SetDoublePref(path, value);
+    bat_ads_client_->SetDoublePref(path, value,
+                                   UpdatePref(path, base::Value(value)));
   }
 }
 
 std::string BatAdsClientMojoBridge::GetStringPref(
     const std::string& path) const {
+  if (const base::Value* value = FindPrefValue(path)) {
+    const std::string* string_value = value->GetIfString();
+    return string_value ? *string_value : std::string();
+  }
+
   if (!connected()) {
     return {};
   }
@@ -339,11 +350,16 @@ void BatAdsClientMojoBridge::SetStringPref(
     const std::string& path,
     const std::string& value) {
   if (connected()) {
-    bat_ads_client_->SetStringPref(path, value);
+    bat_ads_client_->SetStringPref(path, value,
+                                   UpdatePref(path, base::Value(value)));
   }
 }
 
 int64_t BatAdsClientMojoBridge::GetInt64Pref(const std::string& path) const {
+  if (const base::Value* value = FindPrefValue(path)) {
+    return base::ValueToInt64(*value).value_or(0);
+  }
+
   if (!connected()) {
     return 0;
   }
@@ -357,11 +373,23 @@ void BatAdsClientMojoBridge::SetInt64Pref(
     const std::string& path,
     const int64_t value) {
   if (connected()) {
-    bat_ads_client_->SetInt64Pref(path, value);
+    // Stored as a string, the same as PrefService::SetInt64.
+    bat_ads_client_->SetInt64Pref(
+        path, value, UpdatePref(path, base::Int64ToValue(value)));
   }
 }
 
 uint64_t BatAdsClientMojoBridge::GetUint64Pref(const std::string& path) const {
+  if (const base::Value* value = FindPrefValue(path)) {
+    const std::string* string_value = value->GetIfString();
+    uint64_t uint64_value = 0;
+    if (!string_value || !base::StringToUint64(*string_value, &uint64_value)) {
+      return 0;
+    }
+
+    return uint64_value;
+  }
+
   if (!connected()) {
     return 0;
   }
@@ -375,11 +403,18 @@ void BatAdsClientMojoBridge::SetUint64Pref(
     const std::string& path,
     const uint64_t value) {
   if (connected()) {
-    bat_ads_client_->SetUint64Pref(path, value);
+    // Stored as a string, the same as PrefService::SetUint64.
+    bat_ads_client_->SetUint64Pref(
+        path, value,
+        UpdatePref(path, base::Value(base::NumberToString(value))));
   }
 }
 
 base::Time BatAdsClientMojoBridge::GetTimePref(const std::string& path) const {
+  if (const base::Value* value = FindPrefValue(path)) {
+    return base::ValueToTime(*value).value_or(base::Time());
+  }
+
   if (!connected()) {
     return {};
   }
@@ -392,12 +427,21 @@ base::Time BatAdsClientMojoBridge::GetTimePref(const std::string& path) const {
 void BatAdsClientMojoBridge::SetTimePref(const std::string& path,
                                          const base::Time value) {
   if (connected()) {
-    bat_ads_client_->SetTimePref(path, value);
+    bat_ads_client_->SetTimePref(path, value,
+                                 UpdatePref(path, base::TimeToValue(value)));
   }
 }
 
 absl::optional<base::Value::Dict> BatAdsClientMojoBridge::GetDictPref(
     const std::string& path) const {
+  if (const base::Value* value = FindPrefValue(path)) {
+    if (!value->is_dict()) {
+      return absl::nullopt;
+    }
+
+    return value->GetDict().Clone();
+  }
+
   if (!connected()) {
     return absl::nullopt;
   }
@@ -410,12 +454,21 @@ absl::optional<base::Value::Dict> BatAdsClientMojoBridge::GetDictPref(
 void BatAdsClientMojoBridge::SetDictPref(const std::string& path,
                                          base::Value::Dict value) {
   if (connected()) {
-    bat_ads_client_->SetDictPref(path, std::move(value));
+    base::OnceClosure callback = UpdatePref(path, base::Value(value.Clone()));
+    bat_ads_client_->SetDictPref(path, std::move(value), std::move(callback));
   }
 }
 
 absl::optional<base::Value::List> BatAdsClientMojoBridge::GetListPref(
     const std::string& path) const {
+  if (const base::Value* value = FindPrefValue(path)) {
+    if (!value->is_list()) {
+      return absl::nullopt;
+    }
+
+    return value->GetList().Clone();
+  }
+
   if (!connected()) {
     return absl::nullopt;
   }
@@ -428,18 +481,36 @@ absl::optional<base::Value::List> BatAdsClientMojoBridge::GetListPref(
 void BatAdsClientMojoBridge::SetListPref(const std::string& path,
                                          base::Value::List value) {
   if (connected()) {
-    bat_ads_client_->SetListPref(path, std::move(value));
+    base::OnceClosure callback = UpdatePref(path, base::Value(value.Clone()));
+    bat_ads_client_->SetListPref(path, std::move(value), std::move(callback));
   }
 }
 
 void BatAdsClientMojoBridge::ClearPref(
     const std::string& path) {
-  if (connected()) {
-    bat_ads_client_->ClearPref(path);
+  if (!connected()) {
+    return;
+  }
+
+  const auto iter = prefs_.find(path);
+  if (iter == prefs_.cend()) {
+    bat_ads_client_->ClearPref(path, base::DoNothing());
+    return;
   }
+
+  mojom::BatAdsPrefInfo* pref = iter->second.get();
+  pref->value = pref->default_value.Clone();
+  pref->has_pref_path = false;
+
+  bat_ads_client_->ClearPref(path, pending_pref_writes_.Add(path));
 }
 
 bool BatAdsClientMojoBridge::HasPrefPath(const std::string& path) const {
+  const auto iter = prefs_.find(path);
+  if (iter != prefs_.cend()) {
+    return iter->second->has_pref_path;
+  }
+
   if (!connected()) {
     return false;
   }
@@ -449,10 +520,48 @@ bool BatAdsClientMojoBridge::HasPrefPath(const std::string& path) const {
   return value;
 }
 
+void BatAdsClientMojoBridge::OnPrefDidChange(const std::string& path,
+                                             mojom::BatAdsPrefInfoPtr pref) {
+  DCHECK(pref);
+
+  if (pending_pref_writes_.IsPending(path)) {
+    return;
+  }
+
+  prefs_[path] = std::move(pref);
+}
+
+void BatAdsClientMojoBridge::SetBrowserActive(const bool is_browser_active) {
+  is_browser_active_ = is_browser_active;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 bool BatAdsClientMojoBridge::connected() const {
   return bat_ads_client_.is_bound();
 }
 
+const base::Value* BatAdsClientMojoBridge::FindPrefValue(
+    const std::string& path) const {
+  const auto iter = prefs_.find(path);
+  if (iter == prefs_.cend()) {
+    return nullptr;
+  }
+
+  return &iter->second->value;
+}
+
+base::OnceClosure BatAdsClientMojoBridge::UpdatePref(const std::string& path,
+                                                     base::Value value) {
+  const auto iter = prefs_.find(path);
+  if (iter == prefs_.cend()) {
+    return base::DoNothing();
+  }
+
+  iter->second->value = std::move(value);
+  iter->second->has_pref_path = true;
+
+  return pending_pref_writes_.Add(path);
+}
+
 }  // namespace bat_ads
@@ -10,11 +10,15 @@
 #include <string>
 #include <vector>
 
+#include "base/callback_forward.h"
+#include "base/containers/flat_map.h"
+#include "base/memory/weak_ptr.h"
 #include "base/values.h"
 #include "bat/ads/ads_client.h"
 #include "bat/ads/public/interfaces/ads.mojom-forward.h"
 #include "brave/components/brave_federated/public/interfaces/brave_federated.mojom-forward.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
+#include "brave/components/services/common/pending_write_tracker.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
 #include "mojo/public/cpp/bindings/pending_associated_remote.h"
 
@@ -29,16 +33,22 @@ struct NotificationAdInfo;
 namespace bat_ads {
 
 class BatAdsClientMojoBridge
-    : public ads::AdsClient {
+    : public ads::AdsClient,
+      public base::SupportsWeakPtr<BatAdsClientMojoBridge> {
  public:
-  explicit BatAdsClientMojoBridge(
-      mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info);
+  BatAdsClientMojoBridge(
+      mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
+      mojom::BatAdsClientStatePtr state);
 
   ~BatAdsClientMojoBridge() override;
 
   BatAdsClientMojoBridge(const BatAdsClientMojoBridge&) = delete;
   BatAdsClientMojoBridge& operator=(const BatAdsClientMojoBridge&) = delete;
 
+  // Updates the mirrored browser state, see |mojom::BatAdsClientState|.
+  void OnPrefDidChange(const std::string& path, mojom::BatAdsPrefInfoPtr pref);
+  void SetBrowserActive(const bool is_browser_active);
+
   // AdsClient:
   bool IsNetworkConnectionAvailable() const override;
 
@@ -50,16 +60,13 @@ class BatAdsClientMojoBridge
   void ShowNotificationAd(const ads::NotificationAdInfo& ad) override;
   void CloseNotificationAd(const std::string& placement_id) override;
 
-  void UpdateAdRewards() override;
-
   void RecordAdEventForId(const std::string& id,
                           const std::string& ad_type,
                           const std::string& confirmation_type,
-                          const base::Time time) const override;
-  std::vector<base::Time> GetAdEventHistory(
-      const std::string& ad_type,
-      const std::string& confirmation_type) const override;
-  void ResetAdEventHistoryForId(const std::string& id) const override;
+                          const base::Time time) override;
+  void ResetAdEventHistoryForId(const std::string& id) override;
+
+  void UpdateAdRewards() override;
 
   void GetBrowsingHistory(const int max_count,
                           const int days_ago,
@@ -130,7 +137,20 @@ class BatAdsClientMojoBridge
  private:
   bool connected() const;
 
+  // Returns the mirrored value for |path| or |nullptr| if |path| is not
+  // mirrored, in which case the browser must be asked.
+  const base::Value* FindPrefValue(const std::string& path) const;
+
+  // Updates the mirrored value for |path| and returns the callback to run once
+  // the browser acknowledges the write. Change notifications for |path| are
+  // ignored until then so they do not revert newer local writes.
+  base::OnceClosure UpdatePref(const std::string& path, base::Value value);
+
   mojo::AssociatedRemote<mojom::BatAdsClient> bat_ads_client_;
+
+  base::flat_map<std::string, mojom::BatAdsPrefInfoPtr> prefs_;
+  brave::PendingWriteTracker pending_pref_writes_;
+  bool is_browser_active_ = false;
 };
 
 }  // namespace bat_ads
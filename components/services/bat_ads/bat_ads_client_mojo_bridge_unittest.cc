@@ -0,0 +1,198 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ads/bat_ads_client_mojo_bridge.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/run_loop.h"
+#include "base/test/task_environment.h"
+#include "base/values.h"
+#include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom-test-utils.h"
+#include "mojo/public/cpp/bindings/associated_receiver.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BatAdsClientMojoBridgeTest.*
+
+namespace bat_ads {
+
+namespace {
+
+constexpr char kEnabled[] = "brave.brave_ads.enabled";
+constexpr char kCount[] = "brave.brave_ads.count";
+
+mojom::BatAdsPrefInfoPtr BuildPrefInfo(base::Value value,
+                                       base::Value default_value,
+                                       bool has_pref_path) {
+  auto pref = mojom::BatAdsPrefInfo::New();
+  pref->value = std::move(value);
+  pref->default_value = std::move(default_value);
+  pref->has_pref_path = has_pref_path;
+  return pref;
+}
+
+// Stands in for the browser. Writes are recorded and only acknowledged when the
+// test asks for it.
+class TestBatAdsClient : public mojom::BatAdsClientInterceptorForTesting {
+ public:
+  mojom::BatAdsClient* GetForwardingInterface() override {
+    NOTREACHED();
+    return nullptr;
+  }
+
+  void SetBooleanPref(const std::string& path,
+                      bool value,
+                      SetBooleanPrefCallback callback) override {
+    written_paths_.push_back(path);
+    pending_acks_.push_back(std::move(callback));
+  }
+
+  void SetIntegerPref(const std::string& path,
+                      int32_t value,
+                      SetIntegerPrefCallback callback) override {
+    written_paths_.push_back(path);
+    pending_acks_.push_back(std::move(callback));
+  }
+
+  void ClearPref(const std::string& path, ClearPrefCallback callback) override {
+    written_paths_.push_back(path);
+    pending_acks_.push_back(std::move(callback));
+  }
+
+  void AckWrites() {
+    std::vector<base::OnceClosure> acks;
+    acks.swap(pending_acks_);
+    for (auto& ack : acks) {
+      std::move(ack).Run();
+    }
+  }
+
+  const std::vector<std::string>& written_paths() const {
+    return written_paths_;
+  }
+
+ private:
+  std::vector<std::string> written_paths_;
+  std::vector<base::OnceClosure> pending_acks_;
+};
+
+}  // namespace
+
+class BatAdsClientMojoBridgeTest : public testing::Test {
+ public:
+  BatAdsClientMojoBridgeTest() {
+    auto state = mojom::BatAdsClientState::New();
+    state->prefs[kEnabled] =
+        BuildPrefInfo(base::Value(true), base::Value(false), true);
+    state->prefs[kCount] = BuildPrefInfo(base::Value(1), base::Value(0), true);
+    state->is_browser_active = true;
+
+    bridge_ = std::make_unique<BatAdsClientMojoBridge>(
+        receiver_.BindNewEndpointAndPassDedicatedRemote(), std::move(state));
+  }
+
+  // Delivers the writes made so far to the browser side without
+  // acknowledging them.
+  void DeliverWrites() { base::RunLoop().RunUntilIdle(); }
+
+  // Acknowledges the delivered writes and delivers the acks to the bridge.
+  void AckWrites() {
+    client_.AckWrites();
+    base::RunLoop().RunUntilIdle();
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  TestBatAdsClient client_;
+  mojo::AssociatedReceiver<mojom::BatAdsClient> receiver_{&client_};
+  std::unique_ptr<BatAdsClientMojoBridge> bridge_;
+};
+
+TEST_F(BatAdsClientMojoBridgeTest, ReadsInitialState) {
+  EXPECT_TRUE(bridge_->GetBooleanPref(kEnabled));
+  EXPECT_EQ(1, bridge_->GetIntegerPref(kCount));
+  EXPECT_TRUE(bridge_->HasPrefPath(kCount));
+  EXPECT_TRUE(bridge_->IsBrowserActive());
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, ReadAfterLocalWrite) {
+  bridge_->SetIntegerPref(kCount, 2);
+  EXPECT_EQ(2, bridge_->GetIntegerPref(kCount));
+
+  DeliverWrites();
+  EXPECT_EQ(std::vector<std::string>({kCount}), client_.written_paths());
+  EXPECT_EQ(2, bridge_->GetIntegerPref(kCount));
+
+  // Clearing falls back to the default value.
+  bridge_->ClearPref(kEnabled);
+  EXPECT_FALSE(bridge_->GetBooleanPref(kEnabled));
+  EXPECT_FALSE(bridge_->HasPrefPath(kEnabled));
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, StalePrefChangeDuringPendingWrite) {
+  bridge_->SetIntegerPref(kCount, 2);
+  DeliverWrites();
+
+  // The browser reports the value from before the write; it must not replace
+  // the newer local value.
+  bridge_->OnPrefDidChange(
+      kCount, BuildPrefInfo(base::Value(1), base::Value(0), true));
+  EXPECT_EQ(2, bridge_->GetIntegerPref(kCount));
+
+  // Other paths are not affected by the pending write.
+  bridge_->OnPrefDidChange(
+      kEnabled, BuildPrefInfo(base::Value(false), base::Value(false), false));
+  EXPECT_FALSE(bridge_->GetBooleanPref(kEnabled));
+  EXPECT_FALSE(bridge_->HasPrefPath(kEnabled));
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, StalePrefChangeDuringPendingClear) {
+  bridge_->ClearPref(kCount);
+  DeliverWrites();
+
+  bridge_->OnPrefDidChange(
+      kCount, BuildPrefInfo(base::Value(1), base::Value(0), true));
+  EXPECT_EQ(0, bridge_->GetIntegerPref(kCount));
+  EXPECT_FALSE(bridge_->HasPrefPath(kCount));
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, AckClearsPendingWrite) {
+  bridge_->SetBooleanPref(kEnabled, false);
+  bridge_->SetBooleanPref(kEnabled, true);
+  DeliverWrites();
+  AckWrites();
+
+  bridge_->OnPrefDidChange(
+      kEnabled, BuildPrefInfo(base::Value(false), base::Value(false), true));
+  EXPECT_FALSE(bridge_->GetBooleanPref(kEnabled));
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, PendingWriteCountsEveryWrite) {
+  bridge_->SetIntegerPref(kCount, 2);
+  DeliverWrites();
+  bridge_->SetIntegerPref(kCount, 3);
+
+  // Only the first write is acknowledged, so the path is still pending.
+  AckWrites();
+  bridge_->OnPrefDidChange(
+      kCount, BuildPrefInfo(base::Value(2), base::Value(0), true));
+  EXPECT_EQ(3, bridge_->GetIntegerPref(kCount));
+
+  AckWrites();
+  bridge_->OnPrefDidChange(
+      kCount, BuildPrefInfo(base::Value(4), base::Value(0), true));
+  EXPECT_EQ(4, bridge_->GetIntegerPref(kCount));
+}
+
+TEST_F(BatAdsClientMojoBridgeTest, SetBrowserActive) {
+  bridge_->SetBrowserActive(false);
+  EXPECT_FALSE(bridge_->IsBrowserActive());
+}
+
+}  // namespace bat_ads
@@ -43,8 +43,10 @@ ads::CategoryContentOptActionType ToCategoryContentOptActionType(
 }  // namespace
 
 BatAdsImpl::BatAdsImpl(
-    mojo::PendingAssociatedRemote<mojom::BatAdsClient> client)
-    : bat_ads_client_mojo_proxy_(new BatAdsClientMojoBridge(std::move(client))),
+    mojo::PendingAssociatedRemote<mojom::BatAdsClient> client,
+    mojom::BatAdsClientStatePtr state)
+    : bat_ads_client_mojo_proxy_(
+          new BatAdsClientMojoBridge(std::move(client), std::move(state))),
       ads_(ads::Ads::CreateInstance(bat_ads_client_mojo_proxy_.get())) {}
 
 BatAdsImpl::~BatAdsImpl() = default;
@@ -70,7 +72,12 @@ void BatAdsImpl::OnLocaleDidChange(const std::string& locale) {
   ads_->OnLocaleDidChange(locale);
 }
 
-void BatAdsImpl::OnPrefDidChange(const std::string& path) {
+void BatAdsImpl::OnPrefDidChange(const std::string& path,
+                                 mojom::BatAdsPrefInfoPtr pref) {
+  if (pref) {
+    bat_ads_client_mojo_proxy_->OnPrefDidChange(path, std::move(pref));
+  }
+
   ads_->OnPrefDidChange(path);
 }
 
@@ -102,10 +109,12 @@ void BatAdsImpl::OnUserDidBecomeIdle() {
 }
 
 void BatAdsImpl::OnBrowserDidEnterForeground() {
+  bat_ads_client_mojo_proxy_->SetBrowserActive(true);
   ads_->OnBrowserDidEnterForeground();
 }
 
 void BatAdsImpl::OnBrowserDidEnterBackground() {
+  bat_ads_client_mojo_proxy_->SetBrowserActive(false);
   ads_->OnBrowserDidEnterBackground();
 }
 
@@ -318,6 +327,17 @@ void BatAdsImpl::OnDidUpdateResourceComponent(const std::string& id) {
   ads_->OnDidUpdateResourceComponent(id);
 }
 
+void BatAdsImpl::OnDidRecordAdEventForId(const std::string& id,
+                                         const std::string& ad_type,
+                                         const std::string& confirmation_type,
+                                         const base::Time time) {
+  ads_->OnDidRecordAdEventForId(id, ad_type, confirmation_type, time);
+}
+
+void BatAdsImpl::OnDidResetAdEventHistoryForId(const std::string& id) {
+  ads_->OnDidResetAdEventHistoryForId(id);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void BatAdsImpl::OnInitialize(CallbackHolder<InitializeCallback>* holder,
@@ -34,8 +34,8 @@ class BatAdsImpl :
     public mojom::BatAds,
     public base::SupportsWeakPtr<BatAdsImpl> {
  public:
-  explicit BatAdsImpl(
-      mojo::PendingAssociatedRemote<mojom::BatAdsClient> client);
+  BatAdsImpl(mojo::PendingAssociatedRemote<mojom::BatAdsClient> client,
+             mojom::BatAdsClientStatePtr state);
   BatAdsImpl(const BatAdsImpl&) = delete;
   BatAdsImpl& operator=(const BatAdsImpl&) = delete;
   ~BatAdsImpl() override;
@@ -48,10 +48,17 @@ class BatAdsImpl :
 
   void OnLocaleDidChange(const std::string& locale) override;
 
-  void OnPrefDidChange(const std::string& path) override;
+  void OnPrefDidChange(const std::string& path,
+                       mojom::BatAdsPrefInfoPtr pref) override;
 
   void OnDidUpdateResourceComponent(const std::string& id) override;
 
+  void OnDidRecordAdEventForId(const std::string& id,
+                               const std::string& ad_type,
+                               const std::string& confirmation_type,
+                               const base::Time time) override;
+  void OnDidResetAdEventHistoryForId(const std::string& id) override;
+
   void OnTabHtmlContentDidChange(const int32_t tab_id,
                                  const std::vector<GURL>& redirect_chain,
                                  const std::string& html) override;
@@ -23,9 +23,10 @@ BatAdsServiceImpl::~BatAdsServiceImpl() = default;
 void BatAdsServiceImpl::Create(
     mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
     mojo::PendingAssociatedReceiver<mojom::BatAds> bat_ads,
+    mojom::BatAdsClientStatePtr state,
     CreateCallback callback) {
   associated_receivers_.Add(
-      std::make_unique<BatAdsImpl>(std::move(client_info)),
+      std::make_unique<BatAdsImpl>(std::move(client_info), std::move(state)),
       std::move(bat_ads));
 
   std::move(callback).Run();
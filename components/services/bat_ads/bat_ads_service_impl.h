@@ -28,6 +28,7 @@ class BatAdsServiceImpl : public mojom::BatAdsService {
   void Create(
       mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
       mojo::PendingAssociatedReceiver<mojom::BatAds> bat_ads,
+      mojom::BatAdsClientStatePtr state,
       CreateCallback callback) override;
 
   void SetSysInfo(ads::mojom::SysInfoPtr sys_info,
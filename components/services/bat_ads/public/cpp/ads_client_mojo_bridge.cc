@@ -44,16 +44,6 @@ void AdsClientMojoBridge::IsNetworkConnectionAvailable(
   std::move(callback).Run(ads_client_->IsNetworkConnectionAvailable());
 }
 
-bool AdsClientMojoBridge::IsBrowserActive(bool* out_value) {
-  DCHECK(out_value);
-  *out_value = ads_client_->IsBrowserActive();
-  return true;
-}
-
-void AdsClientMojoBridge::IsBrowserActive(IsBrowserActiveCallback callback) {
-  std::move(callback).Run(ads_client_->IsBrowserActive());
-}
-
 bool AdsClientMojoBridge::IsBrowserInFullScreenMode(bool* out_value) {
   DCHECK(out_value);
   *out_value = ads_client_->IsBrowserInFullScreenMode();
@@ -109,23 +99,6 @@ void AdsClientMojoBridge::RecordAdEventForId(
   ads_client_->RecordAdEventForId(id, ad_type, confirmation_type, time);
 }
 
-bool AdsClientMojoBridge::GetAdEventHistory(
-    const std::string& ad_type,
-    const std::string& confirmation_type,
-    std::vector<base::Time>* out_value) {
-  DCHECK(out_value);
-  *out_value = ads_client_->GetAdEventHistory(ad_type, confirmation_type);
-  return true;
-}
-
-void AdsClientMojoBridge::GetAdEventHistory(
-    const std::string& ad_type,
-    const std::string& confirmation_type,
-    GetAdEventHistoryCallback callback) {
-  std::move(callback).Run(
-      ads_client_->GetAdEventHistory(ad_type, confirmation_type));
-}
-
 void AdsClientMojoBridge::ResetAdEventHistoryForId(const std::string& id) {
   ads_client_->ResetAdEventHistoryForId(id);
 }
@@ -213,10 +186,11 @@ void AdsClientMojoBridge::GetBooleanPref(
   std::move(callback).Run(ads_client_->GetBooleanPref(path));
 }
 
-void AdsClientMojoBridge::SetBooleanPref(
-    const std::string& path,
-    const bool value) {
+void AdsClientMojoBridge::SetBooleanPref(const std::string& path,
+                                         const bool value,
+                                         SetBooleanPrefCallback callback) {
   ads_client_->SetBooleanPref(path, value);
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::GetIntegerPref(
@@ -225,10 +199,11 @@ void AdsClientMojoBridge::GetIntegerPref(
   std::move(callback).Run(ads_client_->GetIntegerPref(path));
 }
 
-void AdsClientMojoBridge::SetIntegerPref(
-    const std::string& path,
-    const int value) {
+void AdsClientMojoBridge::SetIntegerPref(const std::string& path,
+                                         const int value,
+                                         SetIntegerPrefCallback callback) {
   ads_client_->SetIntegerPref(path, value);
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::GetDoublePref(
@@ -237,10 +212,11 @@ void AdsClientMojoBridge::GetDoublePref(
   std::move(callback).Run(ads_client_->GetDoublePref(path));
 }
 
-void AdsClientMojoBridge::SetDoublePref(
-    const std::string& path,
-    const double value) {
+void AdsClientMojoBridge::SetDoublePref(const std::string& path,
+                                        const double value,
+                                        SetDoublePrefCallback callback) {
   ads_client_->SetDoublePref(path, value);
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::GetStringPref(
@@ -249,10 +225,11 @@ void AdsClientMojoBridge::GetStringPref(
   std::move(callback).Run(ads_client_->GetStringPref(path));
 }
 
-void AdsClientMojoBridge::SetStringPref(
-    const std::string& path,
-    const std::string& value) {
+void AdsClientMojoBridge::SetStringPref(const std::string& path,
+                                        const std::string& value,
+                                        SetStringPrefCallback callback) {
   ads_client_->SetStringPref(path, value);
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::GetInt64Pref(
@@ -261,10 +238,11 @@ void AdsClientMojoBridge::GetInt64Pref(
   std::move(callback).Run(ads_client_->GetInt64Pref(path));
 }
 
-void AdsClientMojoBridge::SetInt64Pref(
-    const std::string& path,
-    const int64_t value) {
+void AdsClientMojoBridge::SetInt64Pref(const std::string& path,
+                                       const int64_t value,
+                                       SetInt64PrefCallback callback) {
   ads_client_->SetInt64Pref(path, value);
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::GetUint64Pref(
@@ -273,10 +251,11 @@ void AdsClientMojoBridge::GetUint64Pref(
   std::move(callback).Run(ads_client_->GetUint64Pref(path));
 }
 
-void AdsClientMojoBridge::SetUint64Pref(
-    const std::string& path,
-    const uint64_t value) {
+void AdsClientMojoBridge::SetUint64Pref(const std::string& path,
+                                        const uint64_t value,
+                                        SetUint64PrefCallback callback) {
   ads_client_->SetUint64Pref(path, value);
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::GetTimePref(const std::string& path,
@@ -285,8 +264,10 @@ void AdsClientMojoBridge::GetTimePref(const std::string& path,
 }
 
 void AdsClientMojoBridge::SetTimePref(const std::string& path,
-                                      const base::Time value) {
+                                      const base::Time value,
+                                      SetTimePrefCallback callback) {
   ads_client_->SetTimePref(path, value);
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::GetDictPref(const std::string& path,
@@ -296,8 +277,10 @@ void AdsClientMojoBridge::GetDictPref(const std::string& path,
 }
 
 void AdsClientMojoBridge::SetDictPref(const std::string& path,
-                                      base::Value::Dict value) {
+                                      base::Value::Dict value,
+                                      SetDictPrefCallback callback) {
   ads_client_->SetDictPref(path, std::move(value));
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::GetListPref(const std::string& path,
@@ -307,13 +290,16 @@ void AdsClientMojoBridge::GetListPref(const std::string& path,
 }
 
 void AdsClientMojoBridge::SetListPref(const std::string& path,
-                                      base::Value::List value) {
+                                      base::Value::List value,
+                                      SetListPrefCallback callback) {
   ads_client_->SetListPref(path, std::move(value));
+  std::move(callback).Run();
 }
 
-void AdsClientMojoBridge::ClearPref(
-    const std::string& path) {
+void AdsClientMojoBridge::ClearPref(const std::string& path,
+                                    ClearPrefCallback callback) {
   ads_client_->ClearPref(path);
+  std::move(callback).Run();
 }
 
 void AdsClientMojoBridge::HasPrefPath(const std::string& path,
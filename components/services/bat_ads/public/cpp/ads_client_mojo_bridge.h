@@ -40,8 +40,6 @@ class AdsClientMojoBridge : public mojom::BatAdsClient {
   void IsNetworkConnectionAvailable(
       IsNetworkConnectionAvailableCallback callback) override;
 
-  bool IsBrowserActive(bool* out_value) override;
-  void IsBrowserActive(IsBrowserActiveCallback callback) override;
   bool IsBrowserInFullScreenMode(bool* out_value) override;
   void IsBrowserInFullScreenMode(
       IsBrowserInFullScreenModeCallback callback) override;
@@ -56,20 +54,14 @@ class AdsClientMojoBridge : public mojom::BatAdsClient {
   void ShowNotificationAd(base::Value::Dict dict) override;
   void CloseNotificationAd(const std::string& placement_id) override;
 
-  void UpdateAdRewards() override;
-
   void RecordAdEventForId(const std::string& id,
                           const std::string& ad_type,
                           const std::string& confirmation_type,
                           const base::Time time) override;
-  bool GetAdEventHistory(const std::string& ad_type,
-                         const std::string& confirmation_type,
-                         std::vector<base::Time>* out_value) override;
-  void GetAdEventHistory(const std::string& ad_type,
-                         const std::string& confirmation_type,
-                         GetAdEventHistoryCallback callback) override;
   void ResetAdEventHistoryForId(const std::string& id) override;
 
+  void UpdateAdRewards() override;
+
   void GetBrowsingHistory(const int max_count,
                           const int days_ago,
                           GetBrowsingHistoryCallback callback) override;
@@ -109,50 +101,56 @@ class AdsClientMojoBridge : public mojom::BatAdsClient {
   void GetBooleanPref(
       const std::string& path,
       GetBooleanPrefCallback callback) override;
-  void SetBooleanPref(
-      const std::string& path,
-      const bool value) override;
+  void SetBooleanPref(const std::string& path,
+                      const bool value,
+                      SetBooleanPrefCallback callback) override;
   void GetIntegerPref(
       const std::string& path,
       GetIntegerPrefCallback callback) override;
-  void SetIntegerPref(
-      const std::string& path,
-      const int value) override;
+  void SetIntegerPref(const std::string& path,
+                      const int value,
+                      SetIntegerPrefCallback callback) override;
   void GetDoublePref(
       const std::string& path,
       GetDoublePrefCallback callback) override;
-  void SetDoublePref(
-      const std::string& path,
-      const double value) override;
+  void SetDoublePref(const std::string& path,
+                     const double value,
+                     SetDoublePrefCallback callback) override;
   void GetStringPref(
       const std::string& path,
       GetStringPrefCallback callback) override;
-  void SetStringPref(
-      const std::string& path,
-      const std::string& value) override;
+  void SetStringPref(const std::string& path,
+                     const std::string& value,
+                     SetStringPrefCallback callback) override;
   void GetInt64Pref(
       const std::string& path,
       GetInt64PrefCallback callback) override;
-  void SetInt64Pref(
-      const std::string& path,
-      const int64_t value) override;
+  void SetInt64Pref(const std::string& path,
+                    const int64_t value,
+                    SetInt64PrefCallback callback) override;
   void GetUint64Pref(
       const std::string& path,
       GetUint64PrefCallback callback) override;
-  void SetUint64Pref(
-      const std::string& path,
-      const uint64_t value) override;
+  void SetUint64Pref(const std::string& path,
+                     const uint64_t value,
+                     SetUint64PrefCallback callback) override;
   void GetTimePref(const std::string& path,
                    GetTimePrefCallback callback) override;
-  void SetTimePref(const std::string& path, const base::Time value) override;
+  void SetTimePref(const std::string& path,
+                   const base::Time value,
+                   SetTimePrefCallback callback) override;
   void GetDictPref(const std::string& path,
                    GetDictPrefCallback callback) override;
-  void SetDictPref(const std::string& path, base::Value::Dict value) override;
+  void SetDictPref(const std::string& path,
+                   base::Value::Dict value,
+                   SetDictPrefCallback callback) override;
   void GetListPref(const std::string& path,
                    GetListPrefCallback callback) override;
-  void SetListPref(const std::string& path, base::Value::List value) override;
-  void ClearPref(
-      const std::string& path) override;
+  void SetListPref(const std::string& path,
+                   base::Value::List value,
+                   SetListPrefCallback callback) override;
+  void ClearPref(const std::string& path,
+                 ClearPrefCallback callback) override;
   void HasPrefPath(const std::string& path,
                    HasPrefPathCallback callback) override;
 
@@ -10,13 +10,43 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
+#include "base/check.h"
+#include "base/json/values_util.h"
 #include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
 
 namespace bat_ledger {
 
+namespace {
+
+template <typename T>
+T GetOption(const base::flat_map<std::string, T>& options,
+            const std::string& name) {
+  DCHECK(!name.empty());
+
+  const auto iter = options.find(name);
+  DCHECK(iter != options.end()) << "Unknown option " << name;
+  if (iter == options.end()) {
+    return T();
+  }
+
+  return iter->second;
+}
+
+}  // namespace
+
 BatLedgerClientMojoBridge::BatLedgerClientMojoBridge(
-      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info) {
+    mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
+    mojom::LedgerClientStatePtr state) {
+  DCHECK(state);
+  DCHECK(state->options);
+
   bat_ledger_client_.Bind(std::move(client_info));
+
+  state_values_ = std::move(state->values);
+  state_default_values_ = std::move(state->default_values);
+  options_ = std::move(state->options);
 }
 
 BatLedgerClientMojoBridge::~BatLedgerClientMojoBridge() = default;
@@ -159,129 +189,151 @@ void BatLedgerClientMojoBridge::OnPublisherUpdated(
 
 void BatLedgerClientMojoBridge::SetBooleanState(const std::string& name,
                                                bool value) {
-  bat_ledger_client_->SetBooleanState(name, value);
+  bat_ledger_client_->SetBooleanState(
+      name, value, UpdateState(name, base::Value(value)));
 }
 
 bool BatLedgerClientMojoBridge::GetBooleanState(const std::string& name) const {
-  bool value;
-  bat_ledger_client_->GetBooleanState(name, &value);
-  return value;
+  return state_values_.FindBool(name).value_or(false);
 }
 
 void BatLedgerClientMojoBridge::SetIntegerState(const std::string& name,
                                                int value) {
-  bat_ledger_client_->SetIntegerState(name, value);
+  bat_ledger_client_->SetIntegerState(
+      name, value, UpdateState(name, base::Value(value)));
 }
 
 int BatLedgerClientMojoBridge::GetIntegerState(const std::string& name) const {
-  int value;
-  bat_ledger_client_->GetIntegerState(name, &value);
-  return value;
+  return state_values_.FindInt(name).value_or(0);
 }
 
 void BatLedgerClientMojoBridge::SetDoubleState(const std::string& name,
                                               double value) {
-  bat_ledger_client_->SetDoubleState(name, value);
+  bat_ledger_client_->SetDoubleState(name, value,
+                                     UpdateState(name, base::Value(value)));
 }
 
 double BatLedgerClientMojoBridge::GetDoubleState(
     const std::string& name) const {
-  double value;
-  bat_ledger_client_->GetDoubleState(name, &value);
-  return value;
+  return state_values_.FindDouble(name).value_or(0.0);
 }
 
 void BatLedgerClientMojoBridge::SetStringState(const std::string& name,
                               const std::string& value) {
-  bat_ledger_client_->SetStringState(name, value);
+  bat_ledger_client_->SetStringState(name, value,
+                                     UpdateState(name, base::Value(value)));
 }
 
 std::string BatLedgerClientMojoBridge::
 GetStringState(const std::string& name) const {
-  std::string value;
-  bat_ledger_client_->GetStringState(name, &value);
-  return value;
+  const std::string* value = state_values_.FindString(name);
+  return value ? *value : std::string();
 }
 
 void BatLedgerClientMojoBridge::SetInt64State(const std::string& name,
                                              int64_t value) {
-  bat_ledger_client_->SetInt64State(name, value);
+  // Stored as a string, the same as PrefService::SetInt64.
+  bat_ledger_client_->SetInt64State(
+      name, value, UpdateState(name, base::Int64ToValue(value)));
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64State(
     const std::string& name) const {
-  int64_t value;
-  bat_ledger_client_->GetInt64State(name, &value);
-  return value;
+  const base::Value* value = state_values_.Find(name);
+  if (!value) {
+    return 0;
+  }
+
+  return base::ValueToInt64(*value).value_or(0);
 }
 
 void BatLedgerClientMojoBridge::SetUint64State(const std::string& name,
                                               uint64_t value) {
-  bat_ledger_client_->SetUint64State(name, value);
+  // Stored as a string, the same as PrefService::SetUint64.
+  bat_ledger_client_->SetUint64State(
+      name, value,
+      UpdateState(name, base::Value(base::NumberToString(value))));
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64State(
     const std::string& name) const {
-  uint64_t value;
-  bat_ledger_client_->GetUint64State(name, &value);
-  return value;
+  const std::string* value = state_values_.FindString(name);
+  uint64_t uint64_value = 0;
+  if (!value || !base::StringToUint64(*value, &uint64_value)) {
+    return 0;
+  }
+
+  return uint64_value;
 }
 
 void BatLedgerClientMojoBridge::SetValueState(const std::string& name,
                                               base::Value value) {
-  bat_ledger_client_->SetValueState(name, std::move(value));
+  base::OnceClosure callback = UpdateState(name, value.Clone());
+  bat_ledger_client_->SetValueState(name, std::move(value),
+                                    std::move(callback));
 }
 
 base::Value BatLedgerClientMojoBridge::GetValueState(
     const std::string& name) const {
-  base::Value value;
-  bat_ledger_client_->GetValueState(name, &value);
-  return value;
+  const base::Value* value = state_values_.Find(name);
+  return value ? value->Clone() : base::Value();
 }
 
 void BatLedgerClientMojoBridge::ClearState(const std::string& name) {
-  bat_ledger_client_->ClearState(name);
+  const base::Value* default_value = state_default_values_.Find(name);
+  base::Value value = default_value ? default_value->Clone() : base::Value();
+  bat_ledger_client_->ClearState(name, UpdateState(name, std::move(value)));
 }
 
 bool BatLedgerClientMojoBridge::GetBooleanOption(
     const std::string& name) const {
-  bool value;
-  bat_ledger_client_->GetBooleanOption(name, &value);
-  return value;
+  return GetOption(options_->bool_options, name);
 }
 
 int BatLedgerClientMojoBridge::GetIntegerOption(const std::string& name) const {
-  int value;
-  bat_ledger_client_->GetIntegerOption(name, &value);
-  return value;
+  return GetOption(options_->integer_options, name);
 }
 
 double BatLedgerClientMojoBridge::GetDoubleOption(
     const std::string& name) const {
-  double value;
-  bat_ledger_client_->GetDoubleOption(name, &value);
-  return value;
+  return GetOption(options_->double_options, name);
 }
 
 std::string BatLedgerClientMojoBridge::GetStringOption(
     const std::string& name) const {
-  std::string value;
-  bat_ledger_client_->GetStringOption(name, &value);
-  return value;
+  return GetOption(options_->string_options, name);
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64Option(
     const std::string& name) const {
-  int64_t value;
-  bat_ledger_client_->GetInt64Option(name, &value);
-  return value;
+  return GetOption(options_->int64_options, name);
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64Option(
     const std::string& name) const {
-  uint64_t value;
-  bat_ledger_client_->GetUint64Option(name, &value);
-  return value;
+  return GetOption(options_->uint64_options, name);
+}
+
+void BatLedgerClientMojoBridge::OnStateChanged(const std::string& name,
+                                               base::Value value) {
+  if (pending_state_writes_.IsPending(name)) {
+    return;
+  }
+
+  state_values_.Set(name, std::move(value));
+}
+
+void BatLedgerClientMojoBridge::OnOptionsChanged(
+    mojom::LedgerClientOptionsPtr options) {
+  DCHECK(options);
+  options_ = std::move(options);
+}
+
+base::OnceClosure BatLedgerClientMojoBridge::UpdateState(
+    const std::string& name,
+    base::Value value) {
+  state_values_.Set(name, std::move(value));
+  return pending_state_writes_.Add(name);
 }
 
 bool BatLedgerClientMojoBridge::Connected() const {
@@ -11,9 +11,12 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "bat/ledger/ledger_client.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
+#include "brave/components/services/common/pending_write_tracker.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
 #include "mojo/public/cpp/bindings/pending_associated_remote.h"
 
@@ -24,7 +27,8 @@ class BatLedgerClientMojoBridge :
     public base::SupportsWeakPtr<BatLedgerClientMojoBridge>{
  public:
   BatLedgerClientMojoBridge(
-      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info);
+      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
+      mojom::LedgerClientStatePtr state);
   ~BatLedgerClientMojoBridge() override;
 
   BatLedgerClientMojoBridge(const BatLedgerClientMojoBridge&) = delete;
@@ -128,9 +132,27 @@ class BatLedgerClientMojoBridge :
 
   absl::optional<std::string> DecryptString(const std::string& name) override;
 
+  // Updates the local copy of the state and options after they were changed
+  // by the browser.
+  void OnStateChanged(const std::string& name, base::Value value);
+  void OnOptionsChanged(mojom::LedgerClientOptionsPtr options);
+
  private:
   bool Connected() const;
 
+  // Updates the local copy of |name| and returns the callback for the reply to
+  // the write which is sent to the browser.
+  base::OnceClosure UpdateState(const std::string& name, base::Value value);
+
+  // Reads are served from here; writes are applied here first and then sent to
+  // the browser.
+  base::Value::Dict state_values_;
+  base::Value::Dict state_default_values_;
+  mojom::LedgerClientOptionsPtr options_;
+
+  // Changes reported by the browser for names with pending writes are ignored.
+  brave::PendingWriteTracker pending_state_writes_;
+
   mojo::AssociatedRemote<mojom::BatLedgerClient> bat_ledger_client_;
 };
 
@@ -0,0 +1,178 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ledger/bat_ledger_client_mojo_bridge.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/run_loop.h"
+#include "base/test/task_environment.h"
+#include "base/values.h"
+#include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom-test-utils.h"
+#include "mojo/public/cpp/bindings/associated_receiver.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BatLedgerClientMojoBridgeTest.*
+
+namespace bat_ledger {
+
+namespace {
+
+constexpr char kCount[] = "brave.rewards.count";
+constexpr char kName[] = "brave.rewards.name";
+
+// Stands in for the browser. Writes are recorded and only acknowledged when the
+// test asks for it.
+class TestBatLedgerClient : public mojom::BatLedgerClientInterceptorForTesting {
+ public:
+  mojom::BatLedgerClient* GetForwardingInterface() override {
+    NOTREACHED();
+    return nullptr;
+  }
+
+  void SetIntegerState(const std::string& name,
+                       int32_t value,
+                       SetIntegerStateCallback callback) override {
+    written_names_.push_back(name);
+    pending_acks_.push_back(std::move(callback));
+  }
+
+  void SetStringState(const std::string& name,
+                      const std::string& value,
+                      SetStringStateCallback callback) override {
+    written_names_.push_back(name);
+    pending_acks_.push_back(std::move(callback));
+  }
+
+  void ClearState(const std::string& name,
+                  ClearStateCallback callback) override {
+    written_names_.push_back(name);
+    pending_acks_.push_back(std::move(callback));
+  }
+
+  void AckWrites() {
+    std::vector<base::OnceClosure> acks;
+    acks.swap(pending_acks_);
+    for (auto& ack : acks) {
+      std::move(ack).Run();
+    }
+  }
+
+  const std::vector<std::string>& written_names() const {
+    return written_names_;
+  }
+
+ private:
+  std::vector<std::string> written_names_;
+  std::vector<base::OnceClosure> pending_acks_;
+};
+
+}  // namespace
+
+class BatLedgerClientMojoBridgeTest : public testing::Test {
+ public:
+  BatLedgerClientMojoBridgeTest() {
+    auto state = mojom::LedgerClientState::New();
+    state->values.Set(kCount, 1);
+    state->values.Set(kName, "initial");
+    state->default_values.Set(kCount, 0);
+    state->default_values.Set(kName, "");
+    state->options = mojom::LedgerClientOptions::New();
+    state->options->bool_options["option"] = true;
+
+    bridge_ = std::make_unique<BatLedgerClientMojoBridge>(
+        receiver_.BindNewEndpointAndPassDedicatedRemote(), std::move(state));
+  }
+
+  // Delivers the writes made so far to the browser side without
+  // acknowledging them.
+  void DeliverWrites() { base::RunLoop().RunUntilIdle(); }
+
+  // Acknowledges the delivered writes and delivers the acks to the bridge.
+  void AckWrites() {
+    client_.AckWrites();
+    base::RunLoop().RunUntilIdle();
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  TestBatLedgerClient client_;
+  mojo::AssociatedReceiver<mojom::BatLedgerClient> receiver_{&client_};
+  std::unique_ptr<BatLedgerClientMojoBridge> bridge_;
+};
+
+TEST_F(BatLedgerClientMojoBridgeTest, ReadsInitialState) {
+  EXPECT_EQ(1, bridge_->GetIntegerState(kCount));
+  EXPECT_EQ("initial", bridge_->GetStringState(kName));
+  EXPECT_TRUE(bridge_->GetBooleanOption("option"));
+
+  // Unknown state reads as the type's default.
+  EXPECT_EQ(0, bridge_->GetIntegerState("brave.rewards.unknown"));
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, ReadAfterLocalWrite) {
+  bridge_->SetIntegerState(kCount, 2);
+  EXPECT_EQ(2, bridge_->GetIntegerState(kCount));
+
+  DeliverWrites();
+  EXPECT_EQ(std::vector<std::string>({kCount}), client_.written_names());
+  EXPECT_EQ(2, bridge_->GetIntegerState(kCount));
+
+  bridge_->ClearState(kName);
+  EXPECT_EQ("", bridge_->GetStringState(kName));
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, BrowserChangeDuringPendingWrite) {
+  bridge_->SetIntegerState(kCount, 2);
+  DeliverWrites();
+
+  // The browser reports the value from before the write; it must not replace
+  // the newer local value.
+  bridge_->OnStateChanged(kCount, base::Value(1));
+  EXPECT_EQ(2, bridge_->GetIntegerState(kCount));
+
+  // Other names are not affected by the pending write.
+  bridge_->OnStateChanged(kName, base::Value("browser"));
+  EXPECT_EQ("browser", bridge_->GetStringState(kName));
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, AckClearsPendingWrite) {
+  bridge_->SetIntegerState(kCount, 2);
+  bridge_->SetIntegerState(kCount, 3);
+  DeliverWrites();
+  AckWrites();
+
+  bridge_->OnStateChanged(kCount, base::Value(4));
+  EXPECT_EQ(4, bridge_->GetIntegerState(kCount));
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, PendingWriteCountsEveryWrite) {
+  bridge_->SetStringState(kName, "first");
+  DeliverWrites();
+  bridge_->SetStringState(kName, "second");
+
+  // Only the first write is acknowledged, so the name is still pending.
+  AckWrites();
+  bridge_->OnStateChanged(kName, base::Value("first"));
+  EXPECT_EQ("second", bridge_->GetStringState(kName));
+
+  AckWrites();
+  bridge_->OnStateChanged(kName, base::Value("browser"));
+  EXPECT_EQ("browser", bridge_->GetStringState(kName));
+}
+
+TEST_F(BatLedgerClientMojoBridgeTest, OptionsChanged) {
+  auto options = mojom::LedgerClientOptions::New();
+  options->bool_options["option"] = false;
+  bridge_->OnOptionsChanged(std::move(options));
+
+  EXPECT_FALSE(bridge_->GetBooleanOption("option"));
+}
+
+}  // namespace bat_ledger
@@ -22,9 +22,10 @@ using std::placeholders::_3;
 namespace bat_ledger {
 
 BatLedgerImpl::BatLedgerImpl(
-    mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info)
+    mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
+    mojom::LedgerClientStatePtr state)
   : bat_ledger_client_mojo_bridge_(
-      new BatLedgerClientMojoBridge(std::move(client_info))),
+      new BatLedgerClientMojoBridge(std::move(client_info), std::move(state))),
     ledger_(
       ledger::Ledger::CreateInstance(bat_ledger_client_mojo_bridge_.get())) {
 }
@@ -48,6 +49,14 @@ void BatLedgerImpl::Initialize(
       std::bind(BatLedgerImpl::OnInitialize, holder, _1));
 }
 
+void BatLedgerImpl::OnStateChanged(const std::string& name, base::Value value) {
+  bat_ledger_client_mojo_bridge_->OnStateChanged(name, std::move(value));
+}
+
+void BatLedgerImpl::OnOptionsChanged(mojom::LedgerClientOptionsPtr options) {
+  bat_ledger_client_mojo_bridge_->OnOptionsChanged(std::move(options));
+}
+
 void BatLedgerImpl::CreateRewardsWallet(const std::string& country,
                                         CreateRewardsWalletCallback callback) {
   ledger_->CreateRewardsWallet(country, std::move(callback));
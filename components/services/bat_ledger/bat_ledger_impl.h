@@ -26,8 +26,9 @@ class BatLedgerImpl :
     public mojom::BatLedger,
     public base::SupportsWeakPtr<BatLedgerImpl> {
  public:
-  explicit BatLedgerImpl(
-      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info);
+  BatLedgerImpl(
+      mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
+      mojom::LedgerClientStatePtr state);
   ~BatLedgerImpl() override;
 
   BatLedgerImpl(const BatLedgerImpl&) = delete;
@@ -37,6 +38,8 @@ class BatLedgerImpl :
   void Initialize(
     const bool execute_create_script,
     InitializeCallback callback) override;
+  void OnStateChanged(const std::string& name, base::Value value) override;
+  void OnOptionsChanged(mojom::LedgerClientOptionsPtr options) override;
   void CreateRewardsWallet(const std::string& country,
                            CreateRewardsWalletCallback callback) override;
   void GetRewardsParameters(GetRewardsParametersCallback callback) override;
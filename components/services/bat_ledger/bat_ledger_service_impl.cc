@@ -29,9 +29,10 @@ BatLedgerServiceImpl::~BatLedgerServiceImpl() = default;
 void BatLedgerServiceImpl::Create(
     mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
     mojo::PendingAssociatedReceiver<mojom::BatLedger> bat_ledger,
+    mojom::LedgerClientStatePtr state,
     CreateCallback callback) {
   associated_receivers_.Add(
-      std::make_unique<BatLedgerImpl>(std::move(client_info)),
+      std::make_unique<BatLedgerImpl>(std::move(client_info), std::move(state)),
       std::move(bat_ledger));
   initialized_ = true;
   std::move(callback).Run();
@@ -32,6 +32,7 @@ class BatLedgerServiceImpl : public mojom::BatLedgerService {
   void Create(
       mojo::PendingAssociatedRemote<mojom::BatLedgerClient> client_info,
       mojo::PendingAssociatedReceiver<mojom::BatLedger> bat_ledger,
+      mojom::LedgerClientStatePtr state,
       CreateCallback callback) override;
 
   void SetEnvironment(ledger::mojom::Environment environment) override;
@@ -33,6 +33,8 @@ void LedgerClientMojoBridge::OnLoadLedgerState(
 }
 
 void LedgerClientMojoBridge::LoadLedgerState(LoadLedgerStateCallback callback) {
+  ++sync_call_count_;
+
   // deleted in OnLoadLedgerState
   auto* holder = new CallbackHolder<LoadLedgerStateCallback>(AsWeakPtr(),
       std::move(callback));
@@ -101,6 +103,7 @@ void LedgerClientMojoBridge::FetchFavIcon(const std::string& url,
 
 void LedgerClientMojoBridge::URIEncode(const std::string& value,
     URIEncodeCallback callback) {
+  ++sync_call_count_;
   std::move(callback).Run(ledger_client_->URIEncode(value));
 }
 
@@ -137,11 +140,6 @@ void LedgerClientMojoBridge::SetBooleanState(const std::string& name,
   std::move(callback).Run();
 }
 
-void LedgerClientMojoBridge::GetBooleanState(const std::string& name,
-                                             GetBooleanStateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetBooleanState(name));
-}
-
 void LedgerClientMojoBridge::SetIntegerState(const std::string& name,
                                              int value,
                                              SetIntegerStateCallback callback) {
@@ -149,11 +147,6 @@ void LedgerClientMojoBridge::SetIntegerState(const std::string& name,
   std::move(callback).Run();
 }
 
-void LedgerClientMojoBridge::GetIntegerState(const std::string& name,
-                                             GetIntegerStateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetIntegerState(name));
-}
-
 void LedgerClientMojoBridge::SetDoubleState(const std::string& name,
                                             double value,
                                             SetDoubleStateCallback callback) {
@@ -161,11 +154,6 @@ void LedgerClientMojoBridge::SetDoubleState(const std::string& name,
   std::move(callback).Run();
 }
 
-void LedgerClientMojoBridge::GetDoubleState(const std::string& name,
-                                            GetDoubleStateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetDoubleState(name));
-}
-
 void LedgerClientMojoBridge::SetStringState(const std::string& name,
                                             const std::string& value,
                                             SetStringStateCallback callback) {
@@ -173,11 +161,6 @@ void LedgerClientMojoBridge::SetStringState(const std::string& name,
   std::move(callback).Run();
 }
 
-void LedgerClientMojoBridge::GetStringState(const std::string& name,
-                                            GetStringStateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetStringState(name));
-}
-
 void LedgerClientMojoBridge::SetInt64State(const std::string& name,
                                            int64_t value,
                                            SetInt64StateCallback callback) {
@@ -185,11 +168,6 @@ void LedgerClientMojoBridge::SetInt64State(const std::string& name,
   std::move(callback).Run();
 }
 
-void LedgerClientMojoBridge::GetInt64State(const std::string& name,
-                                           GetInt64StateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetInt64State(name));
-}
-
 void LedgerClientMojoBridge::SetUint64State(const std::string& name,
                                             uint64_t value,
                                             SetUint64StateCallback callback) {
@@ -197,11 +175,6 @@ void LedgerClientMojoBridge::SetUint64State(const std::string& name,
   std::move(callback).Run();
 }
 
-void LedgerClientMojoBridge::GetUint64State(const std::string& name,
-                                            GetUint64StateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetUint64State(name));
-}
-
 void LedgerClientMojoBridge::SetValueState(const std::string& name,
                                            base::Value value,
                                            SetValueStateCallback callback) {
@@ -209,53 +182,12 @@ void LedgerClientMojoBridge::SetValueState(const std::string& name,
   std::move(callback).Run();
 }
 
-void LedgerClientMojoBridge::GetValueState(const std::string& name,
-                                           GetValueStateCallback callback) {
-  std::move(callback).Run(ledger_client_->GetValueState(name));
-}
-
 void LedgerClientMojoBridge::ClearState(const std::string& name,
                                         ClearStateCallback callback) {
   ledger_client_->ClearState(name);
   std::move(callback).Run();
 }
 
-void LedgerClientMojoBridge::GetBooleanOption(
-    const std::string& name,
-    GetBooleanOptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetBooleanOption(name));
-}
-
-void LedgerClientMojoBridge::GetIntegerOption(
-    const std::string& name,
-    GetIntegerOptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetIntegerOption(name));
-}
-
-void LedgerClientMojoBridge::GetDoubleOption(
-    const std::string& name,
-    GetDoubleOptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetDoubleOption(name));
-}
-
-void LedgerClientMojoBridge::GetStringOption(
-    const std::string& name,
-    GetStringOptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetStringOption(name));
-}
-
-void LedgerClientMojoBridge::GetInt64Option(
-    const std::string& name,
-    GetInt64OptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetInt64Option(name));
-}
-
-void LedgerClientMojoBridge::GetUint64Option(
-    const std::string& name,
-    GetUint64OptionCallback callback) {
-  std::move(callback).Run(ledger_client_->GetUint64Option(name));
-}
-
 void LedgerClientMojoBridge::OnContributeUnverifiedPublishers(
     const ledger::mojom::Result result,
     const std::string& publisher_key,
@@ -268,6 +200,7 @@ void LedgerClientMojoBridge::OnContributeUnverifiedPublishers(
 
 void LedgerClientMojoBridge::GetLegacyWallet(
     GetLegacyWalletCallback callback) {
+  ++sync_call_count_;
   std::move(callback).Run(ledger_client_->GetLegacyWallet());
 }
 
@@ -298,6 +231,7 @@ void LedgerClientMojoBridge::ShowNotification(
 
 void LedgerClientMojoBridge::GetClientInfo(
     GetClientInfoCallback callback) {
+  ++sync_call_count_;
   auto info = ledger_client_->GetClientInfo();
   std::move(callback).Run(std::move(info));
 }
@@ -385,11 +319,13 @@ void LedgerClientMojoBridge::DeleteLog(DeleteLogCallback callback) {
 
 void LedgerClientMojoBridge::EncryptString(const std::string& value,
                                            EncryptStringCallback callback) {
+  ++sync_call_count_;
   std::move(callback).Run(ledger_client_->EncryptString(value));
 }
 
 void LedgerClientMojoBridge::DecryptString(const std::string& value,
                                            DecryptStringCallback callback) {
+  ++sync_call_count_;
   std::move(callback).Run(ledger_client_->DecryptString(value));
 }
 
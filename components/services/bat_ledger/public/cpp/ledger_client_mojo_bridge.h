@@ -60,60 +60,27 @@ class LedgerClientMojoBridge :
   void SetBooleanState(const std::string& name,
                        bool value,
                        SetBooleanStateCallback callback) override;
-  void GetBooleanState(const std::string& name,
-                       GetBooleanStateCallback callback) override;
   void SetIntegerState(const std::string& name,
                        int value,
                        SetIntegerStateCallback callback) override;
-  void GetIntegerState(const std::string& name,
-                       GetIntegerStateCallback callback) override;
   void SetDoubleState(const std::string& name,
                       double value,
                       SetDoubleStateCallback callback) override;
-  void GetDoubleState(const std::string& name,
-                      GetDoubleStateCallback callback) override;
   void SetStringState(const std::string& name,
                       const std::string& value,
                       SetStringStateCallback callback) override;
-  void GetStringState(const std::string& name,
-                      GetStringStateCallback callback) override;
   void SetInt64State(const std::string& name,
                      int64_t value,
                      SetInt64StateCallback callback) override;
-  void GetInt64State(const std::string& name,
-                     GetInt64StateCallback callback) override;
   void SetUint64State(const std::string& name,
                       uint64_t value,
                       SetUint64StateCallback callback) override;
-  void GetUint64State(const std::string& name,
-                      GetUint64StateCallback callback) override;
   void SetValueState(const std::string& name,
                      base::Value value,
                      SetValueStateCallback callback) override;
-  void GetValueState(const std::string& name,
-                     GetValueStateCallback callback) override;
   void ClearState(const std::string& name,
                   ClearStateCallback callback) override;
 
-  void GetBooleanOption(
-      const std::string& name,
-      GetBooleanOptionCallback callback) override;
-  void GetIntegerOption(
-      const std::string& name,
-      GetIntegerOptionCallback callback) override;
-  void GetDoubleOption(
-      const std::string& name,
-      GetDoubleOptionCallback callback) override;
-  void GetStringOption(
-      const std::string& name,
-      GetStringOptionCallback callback) override;
-  void GetInt64Option(
-      const std::string& name,
-      GetInt64OptionCallback callback) override;
-  void GetUint64Option(
-      const std::string& name,
-      GetUint64OptionCallback callback) override;
-
   void OnContributeUnverifiedPublishers(
       const ledger::mojom::Result result,
       const std::string& publisher_key,
@@ -159,6 +126,10 @@ class LedgerClientMojoBridge :
   void DecryptString(const std::string& value,
                      DecryptStringCallback callback) override;
 
+  // Number of [Sync] calls received from the ledger process, each of which
+  // blocked the ledger until it was answered.
+  int sync_call_count_for_testing() const { return sync_call_count_; }
+
  private:
   // workaround to pass base::OnceCallback into std::bind
   template <typename Callback>
@@ -204,6 +175,7 @@ class LedgerClientMojoBridge :
                           const ledger::mojom::Result result);
 
   raw_ptr<ledger::LedgerClient> ledger_client_ = nullptr;
+  int sync_call_count_ = 0;
 };
 
 }  // namespace bat_ledger
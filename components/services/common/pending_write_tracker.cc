@@ -0,0 +1,40 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/common/pending_write_tracker.h"
+
+#include "base/bind.h"
+#include "base/check.h"
+
+namespace brave {
+
+PendingWriteTracker::PendingWriteTracker() = default;
+
+PendingWriteTracker::~PendingWriteTracker() = default;
+
+base::OnceClosure PendingWriteTracker::Add(const std::string& key) {
+  pending_writes_[key]++;
+
+  return base::BindOnce(&PendingWriteTracker::OnWritten,
+                        weak_factory_.GetWeakPtr(), key);
+}
+
+bool PendingWriteTracker::IsPending(const std::string& key) const {
+  return pending_writes_.contains(key);
+}
+
+void PendingWriteTracker::OnWritten(const std::string& key) {
+  const auto iter = pending_writes_.find(key);
+  DCHECK(iter != pending_writes_.end());
+  if (iter == pending_writes_.end()) {
+    return;
+  }
+
+  if (--iter->second == 0) {
+    pending_writes_.erase(iter);
+  }
+}
+
+}  // namespace brave
@@ -0,0 +1,45 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_SERVICES_COMMON_PENDING_WRITE_TRACKER_H_
+#define BRAVE_COMPONENTS_SERVICES_COMMON_PENDING_WRITE_TRACKER_H_
+
+#include <string>
+
+#include "base/callback.h"
+#include "base/containers/flat_map.h"
+#include "base/memory/weak_ptr.h"
+
+namespace brave {
+
+// Counts the writes per key which a service sent to the browser and which the
+// browser has not acknowledged yet. While a key has pending writes, changes to
+// it reported by the browser are stale, since the pending writes will
+// overwrite them.
+class PendingWriteTracker {
+ public:
+  PendingWriteTracker();
+  ~PendingWriteTracker();
+
+  PendingWriteTracker(const PendingWriteTracker&) = delete;
+  PendingWriteTracker& operator=(const PendingWriteTracker&) = delete;
+
+  // Records a write of |key| and returns the callback to run once the browser
+  // acknowledges it.
+  base::OnceClosure Add(const std::string& key);
+
+  bool IsPending(const std::string& key) const;
+
+ private:
+  void OnWritten(const std::string& key);
+
+  base::flat_map<std::string, int> pending_writes_;
+
+  base::WeakPtrFactory<PendingWriteTracker> weak_factory_{this};
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_COMPONENTS_SERVICES_COMMON_PENDING_WRITE_TRACKER_H_
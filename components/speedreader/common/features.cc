@@ -21,6 +21,11 @@ const base::Feature kSpeedreaderFeature {
 const base::Feature kSpeedreaderPanelV2{"SpeedreaderPanelV2",
                                         base::FEATURE_DISABLED_BY_DEFAULT};
 
+// Feeds the response body to the rewriter while it is being downloaded
+// instead of distilling the whole buffered body at the end.
+const base::Feature kSpeedreaderStreamingDistill{
+    "SpeedreaderStreamingDistill", base::FEATURE_DISABLED_BY_DEFAULT};
+
 const base::FeatureParam<int> kSpeedreaderMinOutLengthParam{
     &kSpeedreaderFeature, "min_out_length", 1000};
 
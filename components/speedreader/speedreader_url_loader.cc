@@ -15,9 +15,12 @@
 #include "base/files/file_util.h"
 #include "base/memory/weak_ptr.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/strings/string_piece.h"
 #include "base/task/task_traits.h"
 #include "base/task/thread_pool.h"
+#include "base/timer/elapsed_timer.h"
 #include "brave/components/body_sniffer/body_sniffer_throttle.h"
+#include "brave/components/speedreader/common/features.h"
 #include "brave/components/speedreader/rust/ffi/speedreader.h"
 #include "brave/components/speedreader/speedreader_result_delegate.h"
 #include "brave/components/speedreader/speedreader_rewriter_service.h"
@@ -31,6 +34,10 @@ namespace {
 
 constexpr uint32_t kReadBufferSize = 32768;
 
+// TODO(brave-browser/issues/10372): would be better to pass explicit signal
+// back from rewriter to indicate if content was found
+constexpr size_t kMinDistilledLength = 1024;
+
 void MaybeSaveDistilledDataForDebug(const GURL& url,
                                     const std::string& data,
                                     const std::string& stylesheet,
@@ -51,6 +58,37 @@ void MaybeSaveDistilledDataForDebug(const GURL& url,
 
 }  // namespace
 
+struct SpeedReaderURLLoader::DistillState {
+  explicit DistillState(std::unique_ptr<Rewriter> rewriter)
+      : rewriter(std::move(rewriter)) {}
+
+  static void Write(DistillState* state, base::StringPiece chunk) {
+    if (state->failed)
+      return;
+    base::ElapsedTimer timer;
+    state->failed = state->rewriter->Write(chunk.data(), chunk.size()) != 0;
+    state->distill_time += timer.Elapsed();
+  }
+
+  static absl::optional<std::string> End(DistillState* state) {
+    if (state->failed)
+      return absl::nullopt;
+    base::ElapsedTimer timer;
+    state->rewriter->End();
+    state->distill_time += timer.Elapsed();
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.Distill", state->distill_time);
+
+    const std::string& transformed = state->rewriter->GetOutput();
+    if (transformed.length() < kMinDistilledLength)
+      return absl::nullopt;
+    return transformed;
+  }
+
+  std::unique_ptr<Rewriter> rewriter;
+  base::TimeDelta distill_time;
+  bool failed = false;
+};
+
 // static
 std::tuple<mojo::PendingRemote<network::mojom::URLLoader>,
            mojo::PendingReceiver<network::mojom::URLLoaderClient>,
@@ -96,32 +134,61 @@ SpeedReaderURLLoader::SpeedReaderURLLoader(
       delegate_(delegate),
       response_url_(response_url),
       rewriter_service_(rewriter_service),
-      speedreader_service_(speedreader_service) {}
+      speedreader_service_(speedreader_service) {
+  if (rewriter_service_ &&
+      base::FeatureList::IsEnabled(kSpeedreaderStreamingDistill)) {
+    distill_task_runner_ = base::ThreadPool::CreateSequencedTaskRunner(
+        {base::TaskPriority::USER_BLOCKING, base::MayBlock()});
+    distill_state_ = std::unique_ptr<DistillState, base::OnTaskRunnerDeleter>(
+        new DistillState(MakeRewriter()),
+        base::OnTaskRunnerDeleter(distill_task_runner_));
+  }
+}
 
-SpeedReaderURLLoader::~SpeedReaderURLLoader() = default;
+SpeedReaderURLLoader::~SpeedReaderURLLoader() {
+  if (chunk_write_pending_) {
+    // The pending write still points into |buffered_body_|. It was resized to
+    // at least kReadBufferSize, so it is heap allocated and moving it keeps the
+    // data in place until the write has run.
+    distill_task_runner_->DeleteSoon(
+        FROM_HERE, std::make_unique<std::string>(std::move(buffered_body_)));
+  }
+}
 
 void SpeedReaderURLLoader::OnBodyReadable(MojoResult) {
   DCHECK_EQ(State::kLoading, state_);
 
+  const size_t start_size = buffered_body_.size();
   if (!BodySnifferURLLoader::CheckBufferedBody(kReadBufferSize)) {
     return;
   }
 
-  // TODO(iefremov): We actually can partially |pumpContent| to speedreader,
-  // but skipping it for now to simplify things. Pumping is not free in terms
-  // of CPU ticks, so we will have to keep alive speedreader instance on another
-  // thread.
+  if (first_byte_time_.is_null())
+    first_byte_time_ = base::TimeTicks::Now();
+
+  if (distill_state_ && buffered_body_.size() > start_size) {
+    // Pump the new chunk to the rewriter so that parsing overlaps with the
+    // download. |buffered_body_| isn't read into again until the write is
+    // done, so the chunk is passed in place while the network keeps filling
+    // the pipe.
+    chunk_write_pending_ = true;
+    distill_task_runner_->PostTaskAndReply(
+        FROM_HERE,
+        base::BindOnce(&DistillState::Write,
+                       base::Unretained(distill_state_.get()),
+                       base::StringPiece(buffered_body_).substr(start_size)),
+        base::BindOnce(&SpeedReaderURLLoader::OnChunkWritten,
+                       weak_factory_.GetWeakPtr()));
+    return;
+  }
 
   body_consumer_watcher_.ArmOrNotify();
 }
 
-void SpeedReaderURLLoader::OnBodyWritable(MojoResult r) {
-  DCHECK_EQ(State::kSending, state_);
-  if (bytes_remaining_in_buffer_ > 0) {
-    SendBufferedBodyToClient();
-  } else {
-    CompleteSending();
-  }
+void SpeedReaderURLLoader::OnChunkWritten() {
+  chunk_write_pending_ = false;
+  if (state_ == State::kLoading)
+    body_consumer_watcher_.ArmOrNotify();
 }
 
 void SpeedReaderURLLoader::CompleteLoading(std::string body) {
@@ -133,8 +200,24 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
 
   VLOG(2) << __func__ << " buffered body size = " << body.size();
   bytes_remaining_in_buffer_ = body.size();
+  if (!first_byte_time_.is_null()) {
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.Download",
+                        base::TimeTicks::Now() - first_byte_time_);
+  }
 
   if (bytes_remaining_in_buffer_ > 0) {
+    if (distill_state_) {
+      // All chunks are already queued on |distill_task_runner_|, only the
+      // rewriter's End() is left.
+      distill_task_runner_->PostTaskAndReplyWithResult(
+          FROM_HERE,
+          base::BindOnce(&DistillState::End,
+                         base::Unretained(distill_state_.get())),
+          base::BindOnce(&SpeedReaderURLLoader::OnDistillFinished,
+                         weak_factory_.GetWeakPtr(), std::move(body)));
+      return;
+    }
+
     // Offload heavy distilling to another thread.
     base::ThreadPool::PostTaskAndReplyWithResult(
         FROM_HERE, {base::TaskPriority::USER_BLOCKING, base::MayBlock()},
@@ -142,43 +225,59 @@ void SpeedReaderURLLoader::CompleteLoading(std::string body) {
             [](const GURL& response_url, std::string data,
                std::unique_ptr<Rewriter> rewriter,
                const std::string& stylesheet) -> auto{
-              SCOPED_UMA_HISTOGRAM_TIMER("Brave.Speedreader.Distill");
-              int written = rewriter->Write(data.c_str(), data.length());
-              // Error occurred
-              if (written != 0) {
-                return data;
-              }
-
-              rewriter->End();
-              const std::string& transformed = rewriter->GetOutput();
-
-              // TODO(brave-browser/issues/10372): would be better to pass
-              // explicit signal back from rewriter to indicate if content was
-              // found
-              if (transformed.length() < 1024) {
+              DistillState state(std::move(rewriter));
+              DistillState::Write(&state, data);
+              absl::optional<std::string> transformed =
+                  DistillState::End(&state);
+              if (!transformed) {
                 return data;
               }
               MaybeSaveDistilledDataForDebug(response_url, data, stylesheet,
-                                             transformed);
-              return stylesheet + transformed;
+                                             *transformed);
+              return stylesheet + *transformed;
             },
-            response_url_, std::move(body),
-            rewriter_service_->MakeRewriter(
-                response_url_, speedreader_service_->GetThemeName(),
-                speedreader_service_->GetFontFamilyName(),
-                speedreader_service_->GetFontSizeName(),
-                speedreader_service_->GetContentStyleName()),
+            response_url_, std::move(body), MakeRewriter(),
             rewriter_service_->GetContentStylesheet()),
-        base::BindOnce(
-            [](base::WeakPtr<SpeedReaderURLLoader> self, std::string result) {
-              if (self) {
-                self->BodySnifferURLLoader::CompleteLoading(std::move(result));
-              }
-            },
-            weak_factory_.GetWeakPtr()));
+        base::BindOnce(&SpeedReaderURLLoader::CompleteLoadingWithResult,
+                       weak_factory_.GetWeakPtr()));
     return;
   }
-  BodySnifferURLLoader::CompleteLoading(std::move(body));
+  CompleteLoadingWithResult(std::move(body));
+}
+
+std::unique_ptr<Rewriter> SpeedReaderURLLoader::MakeRewriter() {
+  return rewriter_service_->MakeRewriter(
+      response_url_, speedreader_service_->GetThemeName(),
+      speedreader_service_->GetFontFamilyName(),
+      speedreader_service_->GetFontSizeName(),
+      speedreader_service_->GetContentStyleName());
+}
+
+void SpeedReaderURLLoader::OnDistillFinished(
+    std::string body,
+    absl::optional<std::string> transformed) {
+  if (!transformed) {
+    CompleteLoadingWithResult(std::move(body));
+    return;
+  }
+
+  const std::string& stylesheet = rewriter_service_->GetContentStylesheet();
+#if DCHECK_IS_ON()
+  // Only post the copies when MaybeSaveDistilledDataForDebug() can use them.
+  base::ThreadPool::PostTask(
+      FROM_HERE, {base::TaskPriority::BEST_EFFORT, base::MayBlock()},
+      base::BindOnce(&MaybeSaveDistilledDataForDebug, response_url_,
+                     std::move(body), stylesheet, *transformed));
+#endif
+  CompleteLoadingWithResult(stylesheet + *transformed);
+}
+
+void SpeedReaderURLLoader::CompleteLoadingWithResult(std::string result) {
+  if (!first_byte_time_.is_null()) {
+    UMA_HISTOGRAM_TIMES("Brave.Speedreader.FirstByteToClient",
+                        base::TimeTicks::Now() - first_byte_time_);
+  }
+  BodySnifferURLLoader::CompleteLoading(std::move(result));
 }
 
 void SpeedReaderURLLoader::OnCompleteSending() {
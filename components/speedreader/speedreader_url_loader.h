@@ -6,17 +6,21 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_URL_LOADER_H_
 
+#include <memory>
 #include <string>
 #include <tuple>
 
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/time/time.h"
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
 #include "services/network/public/mojom/url_loader.mojom.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
 namespace body_sniffer {
@@ -25,6 +29,7 @@ class BodySnifferThrottle;
 
 namespace speedreader {
 
+class Rewriter;
 class SpeedreaderResultDelegate;
 class SpeedreaderRewriterService;
 class SpeedreaderService;
@@ -53,6 +58,12 @@ class SpeedReaderThrottle;
 // kAborted: Unexpected behavior happens. Watchers, pipes and the binding from
 //           the source loader to |this| are stopped. All incoming messages from
 //           the destination (through network::mojom::URLLoader) are ignored in
+//
+// With |kSpeedreaderStreamingDistill| enabled, every chunk received in
+// kLoading is also written to the rewriter on a dedicated sequence, so only
+// the rewriter's End() is left to run once the whole body has arrived. The
+// body is still buffered because the original page is sent when distilling
+// fails.
 class SpeedReaderURLLoader : public body_sniffer::BodySnifferURLLoader {
  public:
   ~SpeedReaderURLLoader() override;
@@ -81,10 +92,19 @@ class SpeedReaderURLLoader : public body_sniffer::BodySnifferURLLoader {
       SpeedreaderService* speedreader_service);
 
   void OnBodyReadable(MojoResult) override;
-  void OnBodyWritable(MojoResult) override;
 
   void CompleteLoading(std::string body) override;
   void OnCompleteSending() override;
+
+  std::unique_ptr<Rewriter> MakeRewriter();
+  void OnChunkWritten();
+  void OnDistillFinished(std::string body,
+                         absl::optional<std::string> transformed);
+  void CompleteLoadingWithResult(std::string result);
+
+  // Owned by |distill_task_runner_| and only accessed on it.
+  struct DistillState;
+
   base::WeakPtr<SpeedreaderResultDelegate> delegate_;
 
   GURL response_url_;
@@ -93,6 +113,15 @@ class SpeedReaderURLLoader : public body_sniffer::BodySnifferURLLoader {
   raw_ptr<SpeedreaderRewriterService> rewriter_service_ = nullptr;
   raw_ptr<SpeedreaderService> speedreader_service_ = nullptr;
 
+  // Set up only for streaming distill.
+  scoped_refptr<base::SequencedTaskRunner> distill_task_runner_;
+  std::unique_ptr<DistillState, base::OnTaskRunnerDeleter> distill_state_{
+      nullptr, base::OnTaskRunnerDeleter(nullptr)};
+  // Set while the rewriter is reading the last chunk from |buffered_body_|.
+  bool chunk_write_pending_ = false;
+
+  base::TimeTicks first_byte_time_;
+
   base::WeakPtrFactory<SpeedReaderURLLoader> weak_factory_{this};
 };
 
@@ -20,6 +20,10 @@ namespace features {
 const base::Feature kBraveSyncResetProgressMarker{
     "ResetProgressMarkerOnCommitFailures", base::FEATURE_ENABLED_BY_DEFAULT};
 
+// Enables rewinding progress marker to a recent checkpoint before resetting it.
+const base::Feature kBraveSyncRewindProgressMarker{
+    "RewindProgressMarkerOnCommitFailures", base::FEATURE_ENABLED_BY_DEFAULT};
+
 }  // namespace features
 
 namespace {
@@ -31,6 +35,15 @@ namespace {
 size_t kFailuresToResetMarker = 7;
 // Allow reset progress marker for type not often than once in 30 minutes
 base::TimeDelta kMinimalTimeBetweenResetMarker = base::Minutes(30);
+
+// Before resetting, try to rewind progress marker to a checkpoint after
+// 4 failed commits. When the entity which conflicts was changed on the
+// server after the checkpoint, the next get updates brings it and resolves
+// the conflict without the download of the whole type
+size_t kFailuresToRewindMarker = 4;
+// Keep at most 3 checkpoints, taken not often than once in an hour
+size_t kMaxProgressMarkerCheckpoints = 3;
+base::TimeDelta kMinimalTimeBetweenCheckpoints = base::Hours(1);
 }  // namespace
 
 BraveModelTypeWorker::BraveModelTypeWorker(
@@ -47,7 +60,9 @@ BraveModelTypeWorker::BraveModelTypeWorker(
                       encryption_enabled,
                       passphrase_type,
                       nudge_handler,
-                      cancelation_signal) {}
+                      cancelation_signal) {
+  MaybeAddProgressMarkerCheckpoint();
+}
 
 BraveModelTypeWorker::~BraveModelTypeWorker() = default;
 
@@ -63,6 +78,21 @@ void BraveModelTypeWorker::OnCommitResponse(
 
   if (IsResetProgressMarkerRequired(error_response_list)) {
     ResetProgressMarker();
+    return;
+  }
+
+  if (error_response_list.empty()) {
+    progress_marker_rewound_ = false;
+    MaybeAddProgressMarkerCheckpoint();
+    return;
+  }
+
+  if (failed_commit_times_ >= kFailuresToRewindMarker &&
+      !progress_marker_rewound_ &&
+      base::FeatureList::IsEnabled(features::kBraveSyncRewindProgressMarker)) {
+    // Rewind only once per series of failures, if conflicts remain the
+    // progress marker is reset after |kFailuresToResetMarker| failures
+    progress_marker_rewound_ = RewindProgressMarker();
   }
 }
 
@@ -71,11 +101,21 @@ size_t BraveModelTypeWorker::GetFailuresToResetMarkerForTests() {
   return kFailuresToResetMarker;
 }
 
+// static
+size_t BraveModelTypeWorker::GetFailuresToRewindMarkerForTests() {
+  return kFailuresToRewindMarker;
+}
+
 // static
 base::TimeDelta BraveModelTypeWorker::MinimalTimeBetweenResetForTests() {
   return kMinimalTimeBetweenResetMarker;
 }
 
+// static
+base::TimeDelta BraveModelTypeWorker::MinimalTimeBetweenCheckpointsForTests() {
+  return kMinimalTimeBetweenCheckpoints;
+}
+
 bool BraveModelTypeWorker::IsResetProgressMarkerRequired(
     const FailedCommitResponseDataList& error_response_list) {
   if (!last_reset_marker_time_.is_null() &&
@@ -116,6 +156,44 @@ void BraveModelTypeWorker::ResetProgressMarker() {
   base::UmaHistogramExactLinear("Brave.Sync.ProgressTokenEverReset", 0, 1);
   last_reset_marker_time_ = base::Time::Now();
   model_type_state_.mutable_progress_marker()->clear_token();
+  // Tokens issued before the reset would only bring back a part of the type
+  progress_marker_checkpoints_.clear();
+}
+
+void BraveModelTypeWorker::MaybeAddProgressMarkerCheckpoint() {
+  const std::string& token = model_type_state_.progress_marker().token();
+  if (token.empty()) {
+    return;
+  }
+
+  const base::Time now = base::Time::Now();
+  if (!progress_marker_checkpoints_.empty() &&
+      now - progress_marker_checkpoints_.back().time <
+          kMinimalTimeBetweenCheckpoints) {
+    return;
+  }
+
+  progress_marker_checkpoints_.push_back({token, now});
+  if (progress_marker_checkpoints_.size() > kMaxProgressMarkerCheckpoints) {
+    progress_marker_checkpoints_.pop_front();
+  }
+}
+
+bool BraveModelTypeWorker::RewindProgressMarker() {
+  if (progress_marker_checkpoints_.empty()) {
+    return false;
+  }
+
+  const ProgressMarkerCheckpoint& checkpoint =
+      progress_marker_checkpoints_.front();
+  if (checkpoint.token == model_type_state_.progress_marker().token()) {
+    return false;
+  }
+
+  VLOG(1) << "Rewind progress marker for type " << ModelTypeToDebugString(type_)
+          << " to checkpoint from " << checkpoint.time;
+  model_type_state_.mutable_progress_marker()->set_token(checkpoint.token);
+  return true;
 }
 
 }  // namespace syncer
@@ -7,6 +7,9 @@
 #define BRAVE_COMPONENTS_SYNC_ENGINE_BRAVE_MODEL_TYPE_WORKER_H_
 
 #include <memory>
+#include <string>
+
+#include "base/containers/circular_deque.h"
 
 #include "base/feature_list.h"
 #include "components/sync/base/model_type.h"
@@ -24,6 +27,7 @@ class ModelTypeProcessor;
 namespace features {
 
 extern const base::Feature kBraveSyncResetProgressMarker;
+extern const base::Feature kBraveSyncRewindProgressMarker;
 
 }  // namespace features
 
@@ -31,6 +35,11 @@ FORWARD_DECLARE_TEST(BraveModelTypeWorkerTest, ResetProgressMarker);
 FORWARD_DECLARE_TEST(BraveModelTypeWorkerTest, ResetProgressMarkerMaxPeriod);
 FORWARD_DECLARE_TEST(BraveModelTypeWorkerTest,
                      ResetProgressMarkerDisabledFeature);
+FORWARD_DECLARE_TEST(BraveModelTypeWorkerTest, RewindProgressMarker);
+FORWARD_DECLARE_TEST(BraveModelTypeWorkerTest,
+                     RewindProgressMarkerToOldestCheckpoint);
+FORWARD_DECLARE_TEST(BraveModelTypeWorkerTest,
+                     RewindProgressMarkerDisabledFeature);
 
 class BraveModelTypeWorker : public ModelTypeWorker {
  public:
@@ -51,6 +60,18 @@ class BraveModelTypeWorker : public ModelTypeWorker {
                            ResetProgressMarkerMaxPeriod);
   FRIEND_TEST_ALL_PREFIXES(BraveModelTypeWorkerTest,
                            ResetProgressMarkerDisabledFeature);
+  FRIEND_TEST_ALL_PREFIXES(BraveModelTypeWorkerTest, RewindProgressMarker);
+  FRIEND_TEST_ALL_PREFIXES(BraveModelTypeWorkerTest,
+                           RewindProgressMarkerToOldestCheckpoint);
+  FRIEND_TEST_ALL_PREFIXES(BraveModelTypeWorkerTest,
+                           RewindProgressMarkerDisabledFeature);
+
+  // Progress marker token which was current at |time| while commits were
+  // succeeding.
+  struct ProgressMarkerCheckpoint {
+    std::string token;
+    base::Time time;
+  };
 
   void OnCommitResponse(
       const CommitResponseDataList& committed_response_list,
@@ -60,10 +81,22 @@ class BraveModelTypeWorker : public ModelTypeWorker {
       const FailedCommitResponseDataList& error_response_list);
   void ResetProgressMarker();
 
+  // Remembers the current progress marker token when the type commits without
+  // conflicts.
+  void MaybeAddProgressMarkerCheckpoint();
+  // Rewinds the progress marker to the oldest checkpoint, so the next
+  // GetUpdates only re-downloads entities changed since then instead of the
+  // whole type. Returns |false| if there is no checkpoint to rewind to.
+  bool RewindProgressMarker();
+
   size_t failed_commit_times_ = 0;
   base::Time last_reset_marker_time_;
+  bool progress_marker_rewound_ = false;
+  base::circular_deque<ProgressMarkerCheckpoint> progress_marker_checkpoints_;
   static size_t GetFailuresToResetMarkerForTests();
+  static size_t GetFailuresToRewindMarkerForTests();
   static base::TimeDelta MinimalTimeBetweenResetForTests();
+  static base::TimeDelta MinimalTimeBetweenCheckpointsForTests();
 };
 
 }  // namespace syncer
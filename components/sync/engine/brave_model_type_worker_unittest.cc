@@ -5,6 +5,8 @@
 
 #include "brave/components/sync/engine/brave_model_type_worker.h"
 
+#include <iterator>
+#include <string>
 #include <utility>
 
 #include "base/bind.h"
@@ -77,8 +79,12 @@ class BraveModelTypeWorkerTest : public ::testing::Test {
     return worker()->model_type_state_.progress_marker().token().empty();
   }
 
-  void FillProgressMarker() {
-    worker()->model_type_state_.mutable_progress_marker()->set_token("TOKEN1");
+  void FillProgressMarker(const std::string& token = "TOKEN1") {
+    worker()->model_type_state_.mutable_progress_marker()->set_token(token);
+  }
+
+  const std::string& GetProgressMarkerToken() {
+    return worker()->model_type_state_.progress_marker().token();
   }
 
  private:
@@ -213,4 +219,85 @@ TEST_F(BraveModelTypeWorkerTest, ResetProgressMarkerDisabledFeature) {
   EXPECT_FALSE(IsProgressMarkerEmpty());
 }
 
+TEST_F(BraveModelTypeWorkerTest, RewindProgressMarker) {
+  NormalInitialize();
+  FillProgressMarker();
+  auto error_response_list =
+      MakeErrorResponseList(CommitResponse_ResponseType_CONFLICT);
+
+  for (size_t i = 0;
+       i < BraveModelTypeWorker::GetFailuresToRewindMarkerForTests() - 1; ++i) {
+    worker()->OnCommitResponse(CommitResponseDataList(), error_response_list);
+    EXPECT_EQ(GetProgressMarkerToken(), "TOKEN1");
+  }
+
+  // Expect progress marker rewound to the token the worker started with
+  worker()->OnCommitResponse(CommitResponseDataList(), error_response_list);
+  EXPECT_EQ(GetProgressMarkerToken(), "some_saved_progress_token");
+
+  // Conflicts remain, expect no second rewind and then the full reset
+  FillProgressMarker();
+  for (size_t i = BraveModelTypeWorker::GetFailuresToRewindMarkerForTests();
+       i < BraveModelTypeWorker::GetFailuresToResetMarkerForTests() - 1; ++i) {
+    worker()->OnCommitResponse(CommitResponseDataList(), error_response_list);
+    EXPECT_EQ(GetProgressMarkerToken(), "TOKEN1");
+  }
+
+  worker()->OnCommitResponse(CommitResponseDataList(), error_response_list);
+  EXPECT_TRUE(IsProgressMarkerEmpty());
+}
+
+TEST_F(BraveModelTypeWorkerTest, RewindProgressMarkerToOldestCheckpoint) {
+  NormalInitialize();
+  const base::TimeDelta time_between_checkpoints =
+      BraveModelTypeWorker::MinimalTimeBetweenCheckpointsForTests();
+
+  // Four successful commits an hour apart, only three last tokens are kept
+  const char* tokens[] = {"TOKEN1", "TOKEN2", "TOKEN3", "TOKEN4"};
+  for (size_t i = 0; i < std::size(tokens); ++i) {
+    auto time_override =
+        OverrideForTimeDelta(time_between_checkpoints * (i + 1));
+    FillProgressMarker(tokens[i]);
+    worker()->OnCommitResponse(CommitResponseDataList(),
+                               FailedCommitResponseDataList());
+  }
+
+  // Commit between checkpoints does not replace the checkpoint
+  {
+    auto time_override = OverrideForTimeDelta(
+        time_between_checkpoints * std::size(tokens) + base::Minutes(1));
+    FillProgressMarker("TOKEN5");
+    worker()->OnCommitResponse(CommitResponseDataList(),
+                               FailedCommitResponseDataList());
+  }
+
+  auto error_response_list =
+      MakeErrorResponseList(CommitResponse_ResponseType_TRANSIENT_ERROR);
+  for (size_t i = 0;
+       i < BraveModelTypeWorker::GetFailuresToRewindMarkerForTests(); ++i) {
+    worker()->OnCommitResponse(CommitResponseDataList(), error_response_list);
+  }
+  EXPECT_EQ(GetProgressMarkerToken(), "TOKEN2");
+}
+
+TEST_F(BraveModelTypeWorkerTest, RewindProgressMarkerDisabledFeature) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndDisableFeature(features::kBraveSyncRewindProgressMarker);
+
+  NormalInitialize();
+  FillProgressMarker();
+  auto error_response_list =
+      MakeErrorResponseList(CommitResponse_ResponseType_CONFLICT);
+
+  // Expect rewind does not happen, but reset of progress marker still does
+  for (size_t i = 0;
+       i < BraveModelTypeWorker::GetFailuresToResetMarkerForTests() - 1; ++i) {
+    worker()->OnCommitResponse(CommitResponseDataList(), error_response_list);
+    EXPECT_EQ(GetProgressMarkerToken(), "TOKEN1");
+  }
+
+  worker()->OnCommitResponse(CommitResponseDataList(), error_response_list);
+  EXPECT_TRUE(IsProgressMarkerEmpty());
+}
+
 }  // namespace syncer
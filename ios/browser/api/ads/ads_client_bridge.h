@@ -44,14 +44,6 @@
     callback:(ads::SaveCallback)callback;
 - (void)showNotificationAd:(const ads::NotificationAdInfo&)info;
 - (void)closeNotificationAd:(const std::string&)placement_id;
-- (void)recordAdEventForId:(const std::string&)id
-                    adType:(const std::string&)ad_type
-          confirmationType:(const std::string&)confirmation_type
-                      time:(const base::Time)time;
-- (std::vector<base::Time>)getAdEventHistory:(const std::string&)ad_type
-                            confirmationType:
-                                (const std::string&)confirmation_type;
-- (void)resetAdEventHistoryForId:(const std::string&)id;
 - (void)UrlRequest:(ads::mojom::UrlRequestInfoPtr)url_request
           callback:(ads::UrlRequestCallback)callback;
 - (void)runDBTransaction:(ads::mojom::DBTransactionInfoPtr)transaction
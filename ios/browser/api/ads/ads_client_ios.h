@@ -31,11 +31,8 @@ class AdsClientIOS : public ads::AdsClient {
   void RecordAdEventForId(const std::string& id,
                           const std::string& ad_type,
                           const std::string& confirmation_type,
-                          const base::Time time) const override;
-  std::vector<base::Time> GetAdEventHistory(
-      const std::string& ad_type,
-      const std::string& confirmation_type) const override;
-  void ResetAdEventHistoryForId(const std::string& id) const override;
+                          const base::Time time) override;
+  void ResetAdEventHistoryForId(const std::string& id) override;
   void UrlRequest(ads::mojom::UrlRequestInfoPtr url_request,
                   ads::UrlRequestCallback callback) override;
   void Save(const std::string& name,
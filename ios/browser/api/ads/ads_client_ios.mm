@@ -47,25 +47,14 @@ void AdsClientIOS::CloseNotificationAd(const std::string& placement_id) {
   [bridge_ closeNotificationAd:placement_id];
 }
 
+// There is a single ads instance on iOS, so there are no other instances to
+// share ad events with.
 void AdsClientIOS::RecordAdEventForId(const std::string& id,
                                       const std::string& ad_type,
                                       const std::string& confirmation_type,
-                                      const base::Time time) const {
-  [bridge_ recordAdEventForId:id
-                       adType:ad_type
-             confirmationType:confirmation_type
-                         time:time];
-}
-
-std::vector<base::Time> AdsClientIOS::GetAdEventHistory(
-    const std::string& ad_type,
-    const std::string& confirmation_type) const {
-  return [bridge_ getAdEventHistory:ad_type confirmationType:confirmation_type];
-}
+                                      const base::Time time) {}
 
-void AdsClientIOS::ResetAdEventHistoryForId(const std::string& id) const {
-  [bridge_ resetAdEventHistoryForId:id];
-}
+void AdsClientIOS::ResetAdEventHistoryForId(const std::string& id) {}
 
 void AdsClientIOS::UrlRequest(ads::mojom::UrlRequestInfoPtr url_request,
                               ads::UrlRequestCallback callback) {
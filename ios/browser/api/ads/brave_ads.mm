@@ -25,7 +25,6 @@
 #include "bat/ads/ad_content_action_types.h"
 #include "bat/ads/ad_content_info.h"
 #include "bat/ads/ad_content_value_util.h"
-#include "bat/ads/ad_event_history.h"
 #include "bat/ads/ads.h"
 #include "bat/ads/ads_callback.h"
 #include "bat/ads/build_channel.h"
@@ -121,7 +120,6 @@ ads::mojom::DBCommandResponseInfoPtr RunDBTransactionOnTaskRunner(
   AdsClientIOS* adsClient;
   ads::Ads* ads;
   ads::Database* adsDatabase;
-  ads::AdEventHistory* adEventHistory;
   scoped_refptr<base::SequencedTaskRunner> databaseQueue;
 
   nw_path_monitor_t networkMonitor;
@@ -146,7 +144,6 @@ ads::mojom::DBCommandResponseInfoPtr RunDBTransactionOnTaskRunner(
     self.storagePath = path;
     self.commonOps = [[BraveCommonOperations alloc] initWithStoragePath:path];
     adsDatabase = nullptr;
-    adEventHistory = nullptr;
 
     self.prefsWriteThread =
         dispatch_queue_create("com.rewards.ads.prefs", DISPATCH_QUEUE_SERIAL);
@@ -205,7 +202,6 @@ ads::mojom::DBCommandResponseInfoPtr RunDBTransactionOnTaskRunner(
     delete adsClient;
     ads = nil;
     adsClient = nil;
-    adEventHistory = nil;
   }
 }
 
@@ -265,8 +261,6 @@ ads::mojom::DBCommandResponseInfoPtr RunDBTransactionOnTaskRunner(
   const auto dbPath = base::SysNSStringToUTF8([self adsDatabasePath]);
   adsDatabase = new ads::Database(base::FilePath(dbPath));
 
-  adEventHistory = new ads::AdEventHistory();
-
   adsClient = new AdsClientIOS(self);
   ads = ads::Ads::CreateInstance(adsClient);
   ads->Initialize(^(const bool success) {
@@ -312,13 +306,9 @@ ads::mojom::DBCommandResponseInfoPtr RunDBTransactionOnTaskRunner(
         if (self->adsDatabase != nil) {
           delete self->adsDatabase;
         }
-        if (self->adEventHistory != nil) {
-          delete self->adEventHistory;
-        }
         self->ads = nil;
         self->adsClient = nil;
         self->adsDatabase = nil;
-        self->adEventHistory = nil;
         if (completion) {
           completion();
         }
@@ -1263,35 +1253,6 @@ ads::mojom::DBCommandResponseInfoPtr RunDBTransactionOnTaskRunner(
       clearNotificationWithIdentifier:bridgedPlacementId];
 }
 
-- (void)recordAdEventForId:(const std::string&)id
-                    adType:(const std::string&)ad_type
-          confirmationType:(const std::string&)confirmation_type
-                      time:(const base::Time)time {
-  if (!adEventHistory) {
-    return;
-  }
-
-  adEventHistory->RecordForId(id, ad_type, confirmation_type, time);
-}
-
-- (std::vector<base::Time>)getAdEventHistory:(const std::string&)ad_type
-                            confirmationType:
-                                (const std::string&)confirmation_type {
-  if (!adEventHistory) {
-    return {};
-  }
-
-  return adEventHistory->Get(ad_type, confirmation_type);
-}
-
-- (void)resetAdEventHistoryForId:(const std::string&)id {
-  if (!adEventHistory) {
-    return;
-  }
-
-  return adEventHistory->ResetForId(id);
-}
-
 - (bool)shouldAllowAdsSubdivisionTargeting {
   return self.shouldAllowSubdivisionTargeting;
 }
@@ -0,0 +1,366 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/binary_graph_writer.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "base/bit_cast.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+constexpr char kMagic[] = {'P', 'G', 'B', 1};
+
+// Strings longer than this are written inline every time. Long values are
+// mostly script sources and request headers which rarely repeat, so keeping
+// them out of the table bounds its memory.
+constexpr size_t kMaxInternedStringLength = 256;
+
+// Leading varint of a string: a new interned string, a string that is not
+// interned, or kStringRefBase + the index of an already interned string.
+constexpr uint64_t kStringNewInterned = 0;
+constexpr uint64_t kStringInline = 1;
+constexpr uint64_t kStringRefBase = 2;
+
+enum RecordTag : uint8_t {
+  kRecordDescription = 1,
+  kRecordKey,
+  kRecordBeginGraph,
+  kRecordNode,
+  kRecordEdge,
+  kRecordStringData,
+  kRecordIntData,
+  kRecordUIntData,
+  kRecordDoubleData,
+  kRecordBoolData,
+  kRecordEndItem,
+  kRecordEndDocument,
+};
+
+class BinaryGraphReader {
+ public:
+  explicit BinaryGraphReader(base::span<const uint8_t> input)
+      : input_(input) {}
+
+  bool Read(GraphWriter* writer) {
+    if (input_.size() < sizeof(kMagic) ||
+        memcmp(input_.data(), kMagic, sizeof(kMagic)) != 0) {
+      return false;
+    }
+    offset_ = sizeof(kMagic);
+
+    while (offset_ < input_.size()) {
+      const uint8_t tag = input_[offset_++];
+      switch (tag) {
+        case kRecordDescription: {
+          GraphWriter::Description description;
+          base::StringPiece version, about, frame_id;
+          uint8_t is_root;
+          int64_t start_ms, end_ms;
+          if (!ReadString(&version) || !ReadString(&about) ||
+              !ReadByte(&is_root) || !ReadString(&frame_id) ||
+              !ReadSignedVarint(&start_ms) || !ReadSignedVarint(&end_ms)) {
+            return false;
+          }
+          description.version = std::string(version);
+          description.about = std::string(about);
+          description.is_root = is_root != 0;
+          description.frame_id = std::string(frame_id);
+          description.start = base::Milliseconds(start_ms);
+          description.end = base::Milliseconds(end_ms);
+          writer->BeginDocument(description);
+          break;
+        }
+        case kRecordKey: {
+          uint64_t key_id, for_type, type;
+          base::StringPiece name;
+          if (!ReadVarint(&key_id) || !ReadVarint(&for_type) ||
+              !ReadString(&name) || !ReadVarint(&type) ||
+              for_type > kGraphMLAttrForTypeUnknown ||
+              type > kGraphMLAttrTypeUnknown) {
+            return false;
+          }
+          writer->WriteKey(key_id, static_cast<GraphMLAttrForType>(for_type),
+                           std::string(name),
+                           static_cast<GraphMLAttrType>(type));
+          break;
+        }
+        case kRecordBeginGraph:
+          writer->BeginGraph();
+          break;
+        case kRecordNode: {
+          uint64_t id;
+          if (in_item_ || !ReadVarint(&id))
+            return false;
+          in_item_ = true;
+          writer->BeginNode(id);
+          break;
+        }
+        case kRecordEdge: {
+          uint64_t id, source_id, target_id;
+          if (in_item_ || !ReadVarint(&id) || !ReadVarint(&source_id) ||
+              !ReadVarint(&target_id)) {
+            return false;
+          }
+          in_item_ = true;
+          writer->BeginEdge(id, source_id, target_id);
+          break;
+        }
+        case kRecordStringData: {
+          uint64_t key_id;
+          base::StringPiece value;
+          if (!in_item_ || !ReadVarint(&key_id) || !ReadString(&value))
+            return false;
+          writer->WriteStringData(key_id, value);
+          break;
+        }
+        case kRecordIntData: {
+          uint64_t key_id;
+          int64_t value;
+          if (!in_item_ || !ReadVarint(&key_id) || !ReadSignedVarint(&value))
+            return false;
+          writer->WriteIntData(key_id, value);
+          break;
+        }
+        case kRecordUIntData: {
+          uint64_t key_id, value;
+          if (!in_item_ || !ReadVarint(&key_id) || !ReadVarint(&value))
+            return false;
+          writer->WriteUIntData(key_id, value);
+          break;
+        }
+        case kRecordDoubleData: {
+          uint64_t key_id, bits = 0;
+          if (!in_item_ || !ReadVarint(&key_id) || input_.size() - offset_ < 8)
+            return false;
+          for (int i = 0; i < 8; ++i)
+            bits |= uint64_t{input_[offset_++]} << (8 * i);
+          writer->WriteDoubleData(key_id, base::bit_cast<double>(bits));
+          break;
+        }
+        case kRecordBoolData: {
+          uint64_t key_id;
+          uint8_t value;
+          if (!in_item_ || !ReadVarint(&key_id) || !ReadByte(&value))
+            return false;
+          writer->WriteBoolData(key_id, value != 0);
+          break;
+        }
+        case kRecordEndItem:
+          if (!in_item_)
+            return false;
+          in_item_ = false;
+          writer->EndItem();
+          break;
+        case kRecordEndDocument:
+          if (in_item_)
+            return false;
+          writer->EndDocument();
+          return offset_ == input_.size();
+        default:
+          return false;
+      }
+    }
+    // Missing kRecordEndDocument.
+    return false;
+  }
+
+ private:
+  bool ReadByte(uint8_t* value) {
+    if (offset_ >= input_.size())
+      return false;
+    *value = input_[offset_++];
+    return true;
+  }
+
+  bool ReadVarint(uint64_t* value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      uint8_t byte;
+      if (!ReadByte(&byte))
+        return false;
+      *value |= uint64_t{byte & 0x7fu} << shift;
+      if (!(byte & 0x80))
+        return true;
+    }
+    return false;
+  }
+
+  bool ReadSignedVarint(int64_t* value) {
+    uint64_t zigzag;
+    if (!ReadVarint(&zigzag))
+      return false;
+    *value = static_cast<int64_t>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+    return true;
+  }
+
+  bool ReadString(base::StringPiece* value) {
+    uint64_t ref;
+    if (!ReadVarint(&ref))
+      return false;
+    if (ref >= kStringRefBase) {
+      if (ref - kStringRefBase >= interned_strings_.size())
+        return false;
+      *value = interned_strings_[ref - kStringRefBase];
+      return true;
+    }
+
+    uint64_t length;
+    if (!ReadVarint(&length) || length > input_.size() - offset_)
+      return false;
+    *value = base::StringPiece(
+        reinterpret_cast<const char*>(input_.data() + offset_), length);
+    offset_ += length;
+    if (ref == kStringNewInterned)
+      interned_strings_.push_back(*value);
+    return true;
+  }
+
+  const base::span<const uint8_t> input_;
+  size_t offset_ = 0;
+  // Whether a node or edge record is open; data records are only valid
+  // inside one.
+  bool in_item_ = false;
+  // Interned strings point into |input_|.
+  std::vector<base::StringPiece> interned_strings_;
+};
+
+}  // namespace
+
+BinaryGraphWriter::BinaryGraphWriter(OutputCallback output_callback)
+    : GraphWriter(std::move(output_callback)) {}
+
+BinaryGraphWriter::~BinaryGraphWriter() = default;
+
+void BinaryGraphWriter::BeginDocument(const Description& description) {
+  Append(base::StringPiece(kMagic, sizeof(kMagic)));
+  AppendByte(kRecordDescription);
+  AppendString(description.version);
+  AppendString(description.about);
+  AppendByte(description.is_root ? 1 : 0);
+  AppendString(description.frame_id);
+  AppendSignedVarint(description.start.InMilliseconds());
+  AppendSignedVarint(description.end.InMilliseconds());
+}
+
+void BinaryGraphWriter::WriteKey(uint64_t key_id,
+                                 GraphMLAttrForType for_type,
+                                 const std::string& name,
+                                 GraphMLAttrType type) {
+  AppendByte(kRecordKey);
+  AppendVarint(key_id);
+  AppendVarint(for_type);
+  AppendString(name);
+  AppendVarint(type);
+}
+
+void BinaryGraphWriter::BeginGraph() {
+  AppendByte(kRecordBeginGraph);
+}
+
+void BinaryGraphWriter::BeginNode(GraphItemId id) {
+  AppendByte(kRecordNode);
+  AppendVarint(id);
+}
+
+void BinaryGraphWriter::BeginEdge(GraphItemId id,
+                                  GraphItemId source_id,
+                                  GraphItemId target_id) {
+  AppendByte(kRecordEdge);
+  AppendVarint(id);
+  AppendVarint(source_id);
+  AppendVarint(target_id);
+}
+
+void BinaryGraphWriter::WriteStringData(uint64_t key_id,
+                                        base::StringPiece value) {
+  AppendByte(kRecordStringData);
+  AppendVarint(key_id);
+  AppendString(value);
+}
+
+void BinaryGraphWriter::WriteIntData(uint64_t key_id, int64_t value) {
+  AppendByte(kRecordIntData);
+  AppendVarint(key_id);
+  AppendSignedVarint(value);
+}
+
+void BinaryGraphWriter::WriteUIntData(uint64_t key_id, uint64_t value) {
+  AppendByte(kRecordUIntData);
+  AppendVarint(key_id);
+  AppendVarint(value);
+}
+
+void BinaryGraphWriter::WriteDoubleData(uint64_t key_id, double value) {
+  AppendByte(kRecordDoubleData);
+  AppendVarint(key_id);
+  const uint64_t bits = base::bit_cast<uint64_t>(value);
+  char bytes[8];
+  for (int i = 0; i < 8; ++i)
+    bytes[i] = static_cast<char>(bits >> (8 * i));
+  Append(base::StringPiece(bytes, sizeof(bytes)));
+}
+
+void BinaryGraphWriter::WriteBoolData(uint64_t key_id, bool value) {
+  AppendByte(kRecordBoolData);
+  AppendVarint(key_id);
+  AppendByte(value ? 1 : 0);
+}
+
+void BinaryGraphWriter::EndItem() {
+  AppendByte(kRecordEndItem);
+}
+
+void BinaryGraphWriter::EndDocument() {
+  AppendByte(kRecordEndDocument);
+  Flush();
+}
+
+void BinaryGraphWriter::AppendByte(uint8_t value) {
+  const char byte = static_cast<char>(value);
+  Append(base::StringPiece(&byte, 1));
+}
+
+void BinaryGraphWriter::AppendVarint(uint64_t value) {
+  char bytes[10];
+  size_t size = 0;
+  while (value >= 0x80) {
+    bytes[size++] = static_cast<char>((value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  bytes[size++] = static_cast<char>(value);
+  Append(base::StringPiece(bytes, size));
+}
+
+void BinaryGraphWriter::AppendSignedVarint(int64_t value) {
+  AppendVarint((static_cast<uint64_t>(value) << 1) ^
+               static_cast<uint64_t>(value >> 63));
+}
+
+void BinaryGraphWriter::AppendString(base::StringPiece value) {
+  if (value.size() <= kMaxInternedStringLength) {
+    const auto result = interned_strings_.emplace(std::string(value),
+                                                  interned_strings_.size());
+    if (!result.second) {
+      AppendVarint(kStringRefBase + result.first->second);
+      return;
+    }
+    AppendVarint(kStringNewInterned);
+  } else {
+    AppendVarint(kStringInline);
+  }
+  AppendVarint(value.size());
+  Append(value);
+}
+
+bool ReadBinaryGraph(base::span<const uint8_t> input, GraphWriter* writer) {
+  return BinaryGraphReader(input).Read(writer);
+}
+
+}  // namespace brave_page_graph
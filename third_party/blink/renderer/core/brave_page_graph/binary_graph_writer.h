@@ -0,0 +1,62 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_BINARY_GRAPH_WRITER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_BINARY_GRAPH_WRITER_H_
+
+#include <string>
+#include <unordered_map>
+
+#include "base/containers/span.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
+
+namespace brave_page_graph {
+
+// Writes the graph in a compact binary encoding: every event becomes a one
+// byte record tag followed by varint encoded integers, and short strings
+// (node types, tag names, keys, URLs) are interned so repeats cost a single
+// varint. ReadBinaryGraph() into a GraphMLWriter turns the output back into
+// the document GraphMLWriter would have produced.
+class BinaryGraphWriter final : public GraphWriter {
+ public:
+  explicit BinaryGraphWriter(OutputCallback output_callback);
+  ~BinaryGraphWriter() override;
+
+  void BeginDocument(const Description& description) override;
+  void WriteKey(uint64_t key_id,
+                GraphMLAttrForType for_type,
+                const std::string& name,
+                GraphMLAttrType type) override;
+  void BeginGraph() override;
+  void BeginNode(GraphItemId id) override;
+  void BeginEdge(GraphItemId id,
+                 GraphItemId source_id,
+                 GraphItemId target_id) override;
+  void WriteStringData(uint64_t key_id, base::StringPiece value) override;
+  void WriteIntData(uint64_t key_id, int64_t value) override;
+  void WriteUIntData(uint64_t key_id, uint64_t value) override;
+  void WriteDoubleData(uint64_t key_id, double value) override;
+  void WriteBoolData(uint64_t key_id, bool value) override;
+  void EndItem() override;
+  void EndDocument() override;
+
+ private:
+  void AppendByte(uint8_t value);
+  void AppendVarint(uint64_t value);
+  void AppendSignedVarint(int64_t value);
+  void AppendString(base::StringPiece value);
+
+  std::unordered_map<std::string, uint64_t> interned_strings_;
+};
+
+// Replays a graph produced by BinaryGraphWriter into |writer|. Returns false
+// if |input| is truncated or malformed, in which case |writer| may have
+// received part of the graph.
+bool ReadBinaryGraph(base::span<const uint8_t> input,
+                                 GraphWriter* writer);
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_BINARY_GRAPH_WRITER_H_
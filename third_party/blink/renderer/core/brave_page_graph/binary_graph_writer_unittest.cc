@@ -0,0 +1,144 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/binary_graph_writer.h"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/containers/span.h"
+#include "base/strings/string_piece.h"
+#include "base/time/time.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml_writer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+constexpr char kSpecialCharacters[] = "a & b <c> \"d\" 'e'";
+constexpr char kControlCharacters[] = "x\x01y\x1fz\r\n\t";
+
+GraphWriter::OutputCallback AppendTo(std::string* output) {
+  return base::BindRepeating(
+      [](std::string* output, base::StringPiece chunk) {
+        output->append(chunk.data(), chunk.size());
+      },
+      base::Unretained(output));
+}
+
+// Exercises every event, interned and inline strings, and values that need
+// escaping in GraphML.
+void WriteSampleGraph(GraphWriter* writer) {
+  GraphWriter::Description description;
+  description.version = "0.2.4";
+  description.about = "https://example.com/?a=1&b=<2>";
+  description.is_root = true;
+  description.frame_id = "ABCDEF";
+  description.start = base::Milliseconds(5);
+  description.end = base::Milliseconds(1500);
+  writer->BeginDocument(description);
+
+  writer->WriteKey(0, kGraphMLAttrForTypeNode, "node type",
+                   kGraphMLAttrTypeString);
+  writer->WriteKey(1, kGraphMLAttrForTypeEdge, "say \"hi\"\n",
+                   kGraphMLAttrTypeInt);
+  writer->WriteKey(2, kGraphMLAttrForTypeNode, "size",
+                   kGraphMLAttrTypeDouble);
+  writer->WriteKey(3, kGraphMLAttrForTypeNode, "is_deleted",
+                   kGraphMLAttrTypeBoolean);
+  writer->BeginGraph();
+
+  const std::string long_value(1000, 'v');
+  for (GraphItemId id = 1; id <= 3; ++id) {
+    writer->BeginNode(id);
+    writer->WriteStringData(0, "HTML element");
+    writer->WriteStringData(0, kSpecialCharacters);
+    writer->WriteStringData(0, kControlCharacters);
+    writer->WriteStringData(0, long_value);
+    writer->WriteStringData(0, "\xE2\x9C\x93");
+    writer->WriteDoubleData(2, 0.5 * id);
+    writer->WriteBoolData(3, id % 2 == 1);
+    writer->EndItem();
+  }
+
+  writer->BeginEdge(4, 1, 2);
+  writer->WriteIntData(1, std::numeric_limits<int64_t>::min());
+  writer->WriteUIntData(1, std::numeric_limits<uint64_t>::max());
+  writer->EndItem();
+  writer->EndDocument();
+}
+
+std::string WriteGraphML() {
+  std::string graphml;
+  GraphMLWriter writer(AppendTo(&graphml));
+  WriteSampleGraph(&writer);
+  return graphml;
+}
+
+std::vector<uint8_t> WriteBinary() {
+  std::string binary;
+  BinaryGraphWriter writer(AppendTo(&binary));
+  WriteSampleGraph(&writer);
+  return std::vector<uint8_t>(binary.begin(), binary.end());
+}
+
+}  // namespace
+
+TEST(BinaryGraphWriterTest, RoundTripToGraphML) {
+  const std::vector<uint8_t> binary = WriteBinary();
+
+  std::string graphml;
+  GraphMLWriter writer(AppendTo(&graphml));
+  ASSERT_TRUE(ReadBinaryGraph(binary, &writer));
+  EXPECT_EQ(WriteGraphML(), graphml);
+}
+
+TEST(BinaryGraphWriterTest, SmallerThanGraphML) {
+  EXPECT_LT(WriteBinary().size(), WriteGraphML().size());
+}
+
+TEST(BinaryGraphWriterTest, RejectsTruncatedInput) {
+  const std::vector<uint8_t> binary = WriteBinary();
+  for (size_t size = 0; size < binary.size(); ++size) {
+    std::string graphml;
+    GraphMLWriter writer(AppendTo(&graphml));
+    EXPECT_FALSE(
+        ReadBinaryGraph(base::make_span(binary.data(), size), &writer))
+        << size;
+  }
+}
+
+TEST(BinaryGraphWriterTest, RejectsTrailingData) {
+  std::vector<uint8_t> binary = WriteBinary();
+  binary.push_back(0);
+  std::string graphml;
+  GraphMLWriter writer(AppendTo(&graphml));
+  EXPECT_FALSE(ReadBinaryGraph(binary, &writer));
+}
+
+TEST(GraphMLWriterTest, EscapesValues) {
+  const std::string graphml = WriteGraphML();
+
+  EXPECT_NE(std::string::npos,
+            graphml.find("<about>https://example.com/?a=1&amp;b=&lt;2&gt;"
+                         "</about>"));
+  // Quotes only need escaping in attributes.
+  EXPECT_NE(std::string::npos,
+            graphml.find("<data key=\"d0\">a &amp; b &lt;c&gt; \"d\" 'e'"
+                         "</data>"));
+  EXPECT_NE(std::string::npos,
+            graphml.find("attr.name=\"say &quot;hi&quot;&#10;\""));
+  // Control characters other than tab and newlines aren't allowed in XML 1.0
+  // and are dropped.
+  EXPECT_NE(std::string::npos,
+            graphml.find("<data key=\"d0\">xyz&#13;\n\t</data>"));
+  EXPECT_NE(std::string::npos,
+            graphml.find("<data key=\"d0\">\xE2\x9C\x93</data>"));
+}
+
+}  // namespace brave_page_graph
@@ -0,0 +1,65 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/capture_profile.h"
+
+#include <algorithm>
+
+#include "base/no_destructor.h"
+#include "brave/components/brave_page_graph/common/features.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+using features::PageGraphCaptureProfile;
+
+constexpr uint32_t kScriptsAndNetworkCategories =
+    static_cast<uint32_t>(CaptureCategory::kWebAPICalls) |
+    static_cast<uint32_t>(CaptureCategory::kJSBuiltinCalls) |
+    static_cast<uint32_t>(CaptureCategory::kEventListeners) |
+    static_cast<uint32_t>(CaptureCategory::kConsoleMessages);
+
+constexpr uint32_t kFullCategories =
+    kScriptsAndNetworkCategories |
+    static_cast<uint32_t>(CaptureCategory::kDOMAttributes);
+
+uint32_t GetCategoriesForProfile(PageGraphCaptureProfile profile) {
+  switch (profile) {
+    case PageGraphCaptureProfile::kNetwork:
+      return 0;
+    case PageGraphCaptureProfile::kScriptsAndNetwork:
+      return kScriptsAndNetworkCategories;
+    case PageGraphCaptureProfile::kFull:
+      return kFullCategories;
+  }
+}
+
+size_t GetMaxLength(const base::FeatureParam<int>& param) {
+  return static_cast<size_t>(std::max(param.Get(), 0));
+}
+
+CaptureProfile ReadCaptureProfile() {
+  CaptureProfile capture_profile;
+  capture_profile.categories =
+      GetCategoriesForProfile(features::kPageGraphCaptureProfile.Get());
+  capture_profile.max_webapi_argument_length =
+      GetMaxLength(features::kPageGraphMaxWebAPIArgumentLength);
+  capture_profile.max_js_builtin_argument_length =
+      GetMaxLength(features::kPageGraphMaxJSBuiltinArgumentLength);
+  capture_profile.max_console_message_length =
+      GetMaxLength(features::kPageGraphMaxConsoleMessageLength);
+  return capture_profile;
+}
+
+}  // namespace
+
+const CaptureProfile& GetCaptureProfile() {
+  static const base::NoDestructor<CaptureProfile> capture_profile(
+      ReadCaptureProfile());
+  return *capture_profile;
+}
+
+}  // namespace brave_page_graph
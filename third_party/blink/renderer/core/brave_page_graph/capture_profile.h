@@ -0,0 +1,52 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_CAPTURE_PROFILE_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_CAPTURE_PROFILE_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "third_party/blink/renderer/core/core_export.h"
+
+namespace brave_page_graph {
+
+// Optional parts of a graph. The DOM tree, scripts and requests are always
+// recorded. Which categories are recorded is set by the capture profile of the
+// PageGraph feature.
+enum class CaptureCategory : uint32_t {
+  kDOMAttributes = 1 << 0,
+  // WebAPI calls, including cookie and web storage access.
+  kWebAPICalls = 1 << 1,
+  kJSBuiltinCalls = 1 << 2,
+  kEventListeners = 1 << 3,
+  kConsoleMessages = 1 << 4,
+};
+
+struct CaptureProfile {
+  uint32_t categories = 0;
+  // Maximum length in bytes of a recorded argument or result. 0 means no limit.
+  size_t max_webapi_argument_length = 0;
+  size_t max_js_builtin_argument_length = 0;
+  size_t max_console_message_length = 0;
+
+  bool IsEnabled(CaptureCategory category) const {
+    return categories & static_cast<uint32_t>(category);
+  }
+};
+
+// Returns the capture profile configured by the PageGraph feature params. The
+// params are only read on the first call.
+CORE_EXPORT const CaptureProfile& GetCaptureProfile();
+
+// Shorthand for the instrumentation probes, which check the category before
+// converting any arguments.
+inline bool IsCaptureCategoryEnabled(CaptureCategory category) {
+  return GetCaptureProfile().IsEnabled(category);
+}
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_CAPTURE_PROFILE_H_
@@ -30,8 +30,7 @@ class EdgeAttribute : public GraphEdge {
 
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphWriter* writer) const override;
 
   bool IsEdgeAttribute() const override;
 
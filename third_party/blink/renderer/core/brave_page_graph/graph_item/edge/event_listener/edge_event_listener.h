@@ -31,8 +31,7 @@ class EdgeEventListener : public GraphEdge {
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphWriter* writer) const override;
 
   bool IsEdgeEventListener() const override;
 
@@ -41,16 +41,13 @@ ItemDesc EdgeEventListenerAction::GetItemDesc() const {
          base::NumberToString(GetListenerScriptId()) + "]";
 }
 
-void EdgeEventListenerAction::AddGraphMLAttributes(
-    xmlDocPtr doc,
-    xmlNodePtr parent_node) const {
-  GraphEdge::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefKey)
-      ->AddValueNode(doc, parent_node, event_type_);
+void EdgeEventListenerAction::AddGraphMLAttributes(GraphWriter* writer) const {
+  GraphEdge::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefKey)->AddValueNode(writer, event_type_);
   GraphMLAttrDefForType(kGraphMLAttrDefEventListenerId)
-      ->AddValueNode(doc, parent_node, listener_id_);
+      ->AddValueNode(writer, listener_id_);
   GraphMLAttrDefForType(kGraphMLAttrDefScriptIdForEdge)
-      ->AddValueNode(doc, parent_node, GetListenerScriptId());
+      ->AddValueNode(writer, GetListenerScriptId());
 }
 
 bool EdgeEventListenerAction::IsEdgeEventListenerAction() const {
@@ -34,8 +34,7 @@ class EdgeEventListenerAction : public GraphEdge {
 
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphWriter* writer) const override;
 
   bool IsEdgeEventListenerAction() const override;
 
@@ -26,11 +26,10 @@ ItemDesc EdgeExecuteAttr::GetItemDesc() const {
   return EdgeExecute::GetItemDesc() + " [" + attribute_name_ + "]";
 }
 
-void EdgeExecuteAttr::AddGraphMLAttributes(xmlDocPtr doc,
-                                           xmlNodePtr parent_node) const {
-  EdgeExecute::AddGraphMLAttributes(doc, parent_node);
+void EdgeExecuteAttr::AddGraphMLAttributes(GraphWriter* writer) const {
+  EdgeExecute::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefAttrName)
-      ->AddValueNode(doc, parent_node, attribute_name_);
+      ->AddValueNode(writer, attribute_name_);
 }
 
 bool EdgeExecuteAttr::IsEdgeExecuteAttr() const {
@@ -10,6 +10,7 @@
 #include "base/strings/string_number_conversions.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/graph_node.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
 
 namespace brave_page_graph {
@@ -28,27 +29,20 @@ GraphMLId GraphEdge::GetGraphMLId() const {
   return "e" + base::NumberToString(GetId());
 }
 
-void GraphEdge::AddGraphMLTag(xmlDocPtr doc, xmlNodePtr parent_node) const {
-  xmlNodePtr new_node =
-      xmlNewChild(parent_node, nullptr, BAD_CAST "edge", nullptr);
-  xmlSetProp(new_node, BAD_CAST "id", BAD_CAST GetGraphMLId().c_str());
-  xmlSetProp(new_node, BAD_CAST "source",
-             BAD_CAST out_node_->GetGraphMLId().c_str());
-  xmlSetProp(new_node, BAD_CAST "target",
-             BAD_CAST in_node_->GetGraphMLId().c_str());
-  AddGraphMLAttributes(doc, new_node);
+void GraphEdge::AddGraphMLTag(GraphWriter* writer) const {
+  writer->BeginEdge(GetId(), out_node_->GetId(), in_node_->GetId());
+  AddGraphMLAttributes(writer);
+  writer->EndItem();
 }
 
-void GraphEdge::AddGraphMLAttributes(xmlDocPtr doc,
-                                     xmlNodePtr parent_node) const {
-  GraphItem::AddGraphMLAttributes(doc, parent_node);
+void GraphEdge::AddGraphMLAttributes(GraphWriter* writer) const {
+  GraphItem::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefEdgeType)
-      ->AddValueNode(doc, parent_node, GetItemName());
+      ->AddValueNode(writer, GetItemName());
   GraphMLAttrDefForType(kGraphMLAttrDefPageGraphEdgeId)
-      ->AddValueNode(doc, parent_node, GetId());
+      ->AddValueNode(writer, GetId());
   GraphMLAttrDefForType(kGraphMLAttrDefPageGraphEdgeTimestamp)
-      ->AddValueNode(doc, parent_node,
-                     GetTimeDeltaSincePageStart().InMilliseconds());
+      ->AddValueNode(writer, GetTimeDeltaSincePageStart().InMilliseconds());
 }
 
 bool GraphEdge::IsEdge() const {
@@ -23,9 +23,8 @@ class GraphEdge : public GraphItem {
   GraphNode* GetInNode() const { return in_node_; }
 
   GraphMLId GetGraphMLId() const override;
-  void AddGraphMLTag(xmlDocPtr doc, xmlNodePtr parent_node) const override;
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLTag(GraphWriter* writer) const override;
+  void AddGraphMLAttributes(GraphWriter* writer) const override;
 
   bool IsEdge() const override;
 
@@ -5,7 +5,7 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/js/edge_js_call.h"
 
-#include <sstream>
+#include <string>
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/actor/node_script.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/js/node_js.h"
@@ -15,24 +15,22 @@ using ::blink::To;
 
 namespace brave_page_graph {
 
-std::string BuildArgumentsString(const std::vector<std::string>& arguments) {
-  std::stringstream builder;
-  const size_t num_args = arguments.size();
-  const size_t last_index = num_args - 1;
-  for (size_t i = 0; i < num_args; i += 1) {
-    if (i == last_index) {
-      builder << arguments.at(i);
-    } else {
-      builder << arguments.at(i) << ", ";
+std::string BuildArgumentsString(
+    base::span<const base::StringPiece> arguments) {
+  std::string builder;
+  for (size_t i = 0; i < arguments.size(); i += 1) {
+    if (i != 0) {
+      builder += ", ";
     }
+    builder.append(arguments[i].data(), arguments[i].size());
   }
-  return builder.str();
+  return builder;
 }
 
 EdgeJSCall::EdgeJSCall(GraphItemContext* context,
                        NodeScript* out_node,
                        NodeJS* in_node,
-                       const std::vector<std::string>& arguments,
+                       base::span<const base::StringPiece> arguments,
                        const int script_position)
     : EdgeJS(context, out_node, in_node),
       arguments_(arguments),
@@ -54,13 +52,12 @@ ItemDesc EdgeJSCall::GetItemDesc() const {
          "]";
 }
 
-void EdgeJSCall::AddGraphMLAttributes(xmlDocPtr doc,
-                                      xmlNodePtr parent_node) const {
-  EdgeJS::AddGraphMLAttributes(doc, parent_node);
+void EdgeJSCall::AddGraphMLAttributes(GraphWriter* writer) const {
+  EdgeJS::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefCallArgs)
-      ->AddValueNode(doc, parent_node, BuildArgumentsString(arguments_));
+      ->AddValueNode(writer, BuildArgumentsString(arguments_));
   GraphMLAttrDefForType(kGraphMLAttrDefScriptPosition)
-      ->AddValueNode(doc, parent_node, script_position_);
+      ->AddValueNode(writer, script_position_);
 }
 
 bool EdgeJSCall::IsEdgeJSCall() const {
@@ -6,9 +6,8 @@
 #ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_EDGE_JS_EDGE_JS_CALL_H_
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_EDGE_JS_EDGE_JS_CALL_H_
 
-#include <string>
-#include <vector>
-
+#include "base/containers/span.h"
+#include "base/strings/string_piece.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/js/edge_js.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 
@@ -22,27 +21,29 @@ class EdgeJSCall final : public EdgeJS {
   EdgeJSCall(GraphItemContext* context,
              NodeScript* out_node,
              NodeJS* in_node,
-             const std::vector<std::string>& arguments,
+             base::span<const base::StringPiece> arguments,
              const int script_position);
 
   ~EdgeJSCall() override;
 
   const MethodName& GetMethodName() const override;
 
-  const std::vector<std::string>& GetArguments() const { return arguments_; }
+  // The arguments are interned in the graph's string table.
+  base::span<const base::StringPiece> GetArguments() const {
+    return arguments_;
+  }
 
   int GetScriptPosition() const { return script_position_; }
 
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphWriter* writer) const override;
 
   bool IsEdgeJSCall() const override;
 
  private:
-  const std::vector<std::string> arguments_;
+  const base::span<const base::StringPiece> arguments_;
   const int script_position_;
 };
 
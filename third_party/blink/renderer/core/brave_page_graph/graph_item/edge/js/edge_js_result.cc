@@ -5,6 +5,7 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/js/edge_js_result.h"
 
+#include "base/strings/strcat.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/actor/node_script.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/js/node_js.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
@@ -17,7 +18,7 @@ namespace brave_page_graph {
 EdgeJSResult::EdgeJSResult(GraphItemContext* context,
                            NodeJS* out_node,
                            NodeScript* in_node,
-                           const std::string& result)
+                           base::StringPiece result)
     : EdgeJS(context, out_node, in_node), result_(result) {}
 
 EdgeJSResult::~EdgeJSResult() = default;
@@ -27,17 +28,15 @@ ItemName EdgeJSResult::GetItemName() const {
 }
 
 ItemDesc EdgeJSResult::GetItemDesc() const {
-  return GetItemName() + " [result: " + result_ + "]";
+  return base::StrCat({GetItemName(), " [result: ", result_, "]"});
 }
 
-void EdgeJSResult::AddGraphMLAttributes(xmlDocPtr doc,
-                                        xmlNodePtr parent_node) const {
-  EdgeJS::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefValue)
-      ->AddValueNode(doc, parent_node, result_);
+void EdgeJSResult::AddGraphMLAttributes(GraphWriter* writer) const {
+  EdgeJS::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefValue)->AddValueNode(writer, result_);
 }
 
-const std::string& EdgeJSResult::GetResult() const {
+base::StringPiece EdgeJSResult::GetResult() const {
   return result_;
 }
 
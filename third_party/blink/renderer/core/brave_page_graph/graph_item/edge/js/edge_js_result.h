@@ -6,8 +6,7 @@
 #ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_EDGE_JS_EDGE_JS_RESULT_H_
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_ITEM_EDGE_JS_EDGE_JS_RESULT_H_
 
-#include <string>
-
+#include "base/strings/string_piece.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/js/edge_js.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 
@@ -21,22 +20,22 @@ class EdgeJSResult final : public EdgeJS {
   EdgeJSResult(GraphItemContext* context,
                NodeJS* out_node,
                NodeScript* in_node,
-               const std::string& result);
+               base::StringPiece result);
 
   ~EdgeJSResult() override;
 
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphWriter* writer) const override;
 
-  const std::string& GetResult() const;
+  // The result is interned in the graph's string table.
+  base::StringPiece GetResult() const;
   const MethodName& GetMethodName() const override;
   bool IsEdgeJSResult() const override;
 
  private:
-  const std::string result_;
+  const base::StringPiece result_;
 };
 
 }  // namespace brave_page_graph
@@ -25,13 +25,12 @@ RequestURL EdgeRequest::GetRequestURL() const {
   return GetResourceNode()->GetURL();
 }
 
-void EdgeRequest::AddGraphMLAttributes(xmlDocPtr doc,
-                                       xmlNodePtr parent_node) const {
-  GraphEdge::AddGraphMLAttributes(doc, parent_node);
+void EdgeRequest::AddGraphMLAttributes(GraphWriter* writer) const {
+  GraphEdge::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefRequestId)
-      ->AddValueNode(doc, parent_node, request_id_);
+      ->AddValueNode(writer, request_id_);
   GraphMLAttrDefForType(kGraphMLAttrDefStatus)
-      ->AddValueNode(doc, parent_node, RequestStatusToString(request_status_));
+      ->AddValueNode(writer, RequestStatusToString(request_status_));
 }
 
 bool EdgeRequest::IsEdgeRequest() const {
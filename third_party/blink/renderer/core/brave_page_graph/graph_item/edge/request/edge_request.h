@@ -33,8 +33,7 @@ class EdgeRequest : public GraphEdge {
   virtual NodeResource* GetResourceNode() const = 0;
   virtual GraphNode* GetRequestingNode() const = 0;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphWriter* writer) const override;
 
   bool IsEdgeRequest() const override;
 
@@ -35,14 +35,12 @@ ItemName EdgeRequestResponse::GetItemName() const {
   return "request response";
 }
 
-void EdgeRequestResponse::AddGraphMLAttributes(xmlDocPtr doc,
-                                               xmlNodePtr parent_node) const {
-  EdgeRequest::AddGraphMLAttributes(doc, parent_node);
+void EdgeRequestResponse::AddGraphMLAttributes(GraphWriter* writer) const {
+  EdgeRequest::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefHeaders)
-      ->AddValueNode(doc, parent_node, response_header_string_);
+      ->AddValueNode(writer, response_header_string_);
   GraphMLAttrDefForType(kGraphMLAttrDefSize)
-      ->AddValueNode(doc, parent_node,
-                     base::NumberToString(response_data_length_));
+      ->AddValueNode(writer, base::NumberToString(response_data_length_));
 }
 
 bool EdgeRequestResponse::IsEdgeRequestResponse() const {
@@ -30,11 +30,9 @@ ItemDesc EdgeStorageSet::GetItemDesc() const {
   return EdgeStorage::GetItemDesc() + " [value: " + value_ + "]";
 }
 
-void EdgeStorageSet::AddGraphMLAttributes(xmlDocPtr doc,
-                                          xmlNodePtr parent_node) const {
-  EdgeStorage::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefValue)
-      ->AddValueNode(doc, parent_node, value_);
+void EdgeStorageSet::AddGraphMLAttributes(GraphWriter* writer) const {
+  EdgeStorage::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefValue)->AddValueNode(writer, value_);
 }
 
 bool EdgeStorageSet::IsEdgeStorageSet() const {
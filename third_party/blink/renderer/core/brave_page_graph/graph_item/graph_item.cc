@@ -22,8 +22,7 @@ ItemDesc GraphItem::GetItemDesc() const {
   return GetItemName() + " #" + base::NumberToString(id_);
 }
 
-void GraphItem::AddGraphMLAttributes(xmlDocPtr doc,
-                                     xmlNodePtr parent_node) const {}
+void GraphItem::AddGraphMLAttributes(GraphWriter* writer) const {}
 
 bool GraphItem::IsEdge() const {
   return false;
@@ -24,13 +24,11 @@ ItemDesc NodeBinding::GetItemDesc() const {
   return GraphNode::GetItemDesc() + " [" + binding_ + "]";
 }
 
-void NodeBinding::AddGraphMLAttributes(xmlDocPtr doc,
-                                       xmlNodePtr parent_node) const {
-  GraphNode::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefBinding)
-      ->AddValueNode(doc, parent_node, binding_);
+void NodeBinding::AddGraphMLAttributes(GraphWriter* writer) const {
+  GraphNode::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefBinding)->AddValueNode(writer, binding_);
   GraphMLAttrDefForType(kGraphMLAttrDefBindingType)
-      ->AddValueNode(doc, parent_node, binding_type_);
+      ->AddValueNode(writer, binding_type_);
 }
 
 bool NodeBinding::IsNodeBinding() const {
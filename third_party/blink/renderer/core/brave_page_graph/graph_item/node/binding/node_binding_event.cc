@@ -23,11 +23,10 @@ ItemDesc NodeBindingEvent::GetItemDesc() const {
   return GraphNode::GetItemDesc() + " [" + binding_event_ + "]";
 }
 
-void NodeBindingEvent::AddGraphMLAttributes(xmlDocPtr doc,
-                                            xmlNodePtr parent_node) const {
-  GraphNode::AddGraphMLAttributes(doc, parent_node);
+void NodeBindingEvent::AddGraphMLAttributes(GraphWriter* writer) const {
+  GraphNode::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefBindingEvent)
-      ->AddValueNode(doc, parent_node, binding_event_);
+      ->AddValueNode(writer, binding_event_);
 }
 
 bool NodeBindingEvent::IsNodeBindingEvent() const {
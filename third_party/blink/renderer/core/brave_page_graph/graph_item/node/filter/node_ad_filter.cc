@@ -29,11 +29,9 @@ ItemDesc NodeAdFilter::GetItemDesc() const {
   return builder.str();
 }
 
-void NodeAdFilter::AddGraphMLAttributes(xmlDocPtr doc,
-                                        xmlNodePtr parent_node) const {
-  NodeFilter::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefRule)
-      ->AddValueNode(doc, parent_node, rule_);
+void NodeAdFilter::AddGraphMLAttributes(GraphWriter* writer) const {
+  NodeFilter::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefRule)->AddValueNode(writer, rule_);
 }
 
 bool NodeAdFilter::IsNodeAdFilter() const {
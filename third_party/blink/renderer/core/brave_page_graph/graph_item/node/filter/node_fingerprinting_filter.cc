@@ -24,18 +24,16 @@ ItemDesc NodeFingerprintingFilter::GetItemDesc() const {
   return NodeFilter::GetItemDesc() + " [" + rule_.ToString() + "]";
 }
 
-void NodeFingerprintingFilter::AddGraphMLAttributes(
-    xmlDocPtr doc,
-    xmlNodePtr parent_node) const {
-  NodeFilter::AddGraphMLAttributes(doc, parent_node);
+void NodeFingerprintingFilter::AddGraphMLAttributes(GraphWriter* writer) const {
+  NodeFilter::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefPrimaryPattern)
-      ->AddValueNode(doc, parent_node, rule_.primary_pattern);
+      ->AddValueNode(writer, rule_.primary_pattern);
   GraphMLAttrDefForType(kGraphMLAttrDefSecondaryPattern)
-      ->AddValueNode(doc, parent_node, rule_.secondary_pattern);
+      ->AddValueNode(writer, rule_.secondary_pattern);
   GraphMLAttrDefForType(kGraphMLAttrDefSource)
-      ->AddValueNode(doc, parent_node, rule_.source);
+      ->AddValueNode(writer, rule_.source);
   GraphMLAttrDefForType(kGraphMLAttrDefIncognito)
-      ->AddValueNode(doc, parent_node, rule_.incognito);
+      ->AddValueNode(writer, rule_.incognito);
 }
 
 bool NodeFingerprintingFilter::IsNodeFingerprintingFilter() const {
@@ -22,8 +22,7 @@ class NodeFingerprintingFilter : public NodeFilter {
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphWriter* writer) const override;
 
   bool IsNodeFingerprintingFilter() const override;
 
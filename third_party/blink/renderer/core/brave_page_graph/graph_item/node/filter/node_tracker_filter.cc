@@ -23,11 +23,9 @@ ItemDesc NodeTrackerFilter::GetItemDesc() const {
   return NodeFilter::GetItemDesc() + " [" + host_ + "]";
 }
 
-void NodeTrackerFilter::AddGraphMLAttributes(xmlDocPtr doc,
-                                             xmlNodePtr parent_node) const {
-  NodeFilter::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefHost)
-      ->AddValueNode(doc, parent_node, host_);
+void NodeTrackerFilter::AddGraphMLAttributes(GraphWriter* writer) const {
+  NodeFilter::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefHost)->AddValueNode(writer, host_);
 }
 
 bool NodeTrackerFilter::IsNodeTrackerFilter() const {
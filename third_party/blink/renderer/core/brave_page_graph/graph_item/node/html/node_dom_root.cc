@@ -34,11 +34,9 @@ ItemDesc NodeDOMRoot::GetItemDesc() const {
   return builder.str();
 }
 
-void NodeDOMRoot::AddGraphMLAttributes(xmlDocPtr doc,
-                                       xmlNodePtr parent_node) const {
-  NodeHTMLElement::AddGraphMLAttributes(doc, parent_node);
-  GraphMLAttrDefForType(kGraphMLAttrDefURL)
-      ->AddValueNode(doc, parent_node, url_);
+void NodeDOMRoot::AddGraphMLAttributes(GraphWriter* writer) const {
+  NodeHTMLElement::AddGraphMLAttributes(writer);
+  GraphMLAttrDefForType(kGraphMLAttrDefURL)->AddValueNode(writer, url_);
 }
 
 bool NodeDOMRoot::IsNodeDOMRoot() const {
@@ -57,14 +57,13 @@ ItemDesc NodeHTMLElement::GetItemDesc() const {
   return builder.str();
 }
 
-void NodeHTMLElement::AddGraphMLTag(xmlDocPtr doc,
-                                    xmlNodePtr parent_node) const {
-  NodeHTML::AddGraphMLTag(doc, parent_node);
+void NodeHTMLElement::AddGraphMLTag(GraphWriter* writer) const {
+  NodeHTML::AddGraphMLTag(writer);
 
   for (NodeHTML* child_node : child_nodes_) {
     EdgeStructure html_edge(GetContext(), const_cast<NodeHTMLElement*>(this),
                             child_node);
-    html_edge.AddGraphMLTag(doc, parent_node);
+    html_edge.AddGraphMLTag(writer);
   }
 
   // For each event listener, draw an edge from the listener script to the DOM
@@ -77,15 +76,14 @@ void NodeHTMLElement::AddGraphMLTag(xmlDocPtr doc,
     EdgeEventListener event_listener_edge(
         GetContext(), const_cast<NodeHTMLElement*>(this), listener_node,
         event_type, listener_id);
-    event_listener_edge.AddGraphMLTag(doc, parent_node);
+    event_listener_edge.AddGraphMLTag(writer);
   }
 }
 
-void NodeHTMLElement::AddGraphMLAttributes(xmlDocPtr doc,
-                                           xmlNodePtr parent_node) const {
-  NodeHTML::AddGraphMLAttributes(doc, parent_node);
+void NodeHTMLElement::AddGraphMLAttributes(GraphWriter* writer) const {
+  NodeHTML::AddGraphMLAttributes(writer);
   GraphMLAttrDefForType(kGraphMLAttrDefNodeTag)
-      ->AddValueNode(doc, parent_node, TagName());
+      ->AddValueNode(writer, TagName());
 }
 
 void NodeHTMLElement::PlaceChildNodeAfterSiblingNode(NodeHTML* child,
@@ -16,13 +16,12 @@ class NodeResource : public GraphNode {
   NodeResource(GraphItemContext* context, const RequestURL url);
   ~NodeResource() override;
 
-  RequestURL GetURL() const { return url_; }
+  const RequestURL& GetURL() const { return url_; }
 
   ItemName GetItemName() const override;
   ItemDesc GetItemDesc() const override;
 
-  void AddGraphMLAttributes(xmlDocPtr doc,
-                            xmlNodePtr parent_node) const override;
+  void AddGraphMLAttributes(GraphWriter* writer) const override;
 
   bool IsNodeResource() const override;
 
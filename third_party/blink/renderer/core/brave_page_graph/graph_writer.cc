@@ -0,0 +1,45 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
+
+#include <utility>
+
+namespace brave_page_graph {
+
+namespace {
+
+constexpr size_t kOutputBufferSize = 64 * 1024;
+
+}  // namespace
+
+GraphWriter::Description::Description() = default;
+
+GraphWriter::Description::Description(const Description&) = default;
+
+GraphWriter::Description::~Description() = default;
+
+GraphWriter::GraphWriter(OutputCallback output_callback)
+    : output_callback_(std::move(output_callback)) {
+  DCHECK(output_callback_);
+  buffer_.reserve(kOutputBufferSize);
+}
+
+GraphWriter::~GraphWriter() = default;
+
+void GraphWriter::Append(base::StringPiece data) {
+  buffer_.append(data.data(), data.size());
+  if (buffer_.size() >= kOutputBufferSize)
+    Flush();
+}
+
+void GraphWriter::Flush() {
+  if (buffer_.empty())
+    return;
+  output_callback_.Run(buffer_);
+  buffer_.clear();
+}
+
+}  // namespace brave_page_graph
@@ -0,0 +1,80 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_WRITER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_WRITER_H_
+
+#include <string>
+
+#include "base/callback.h"
+#include "base/strings/string_piece.h"
+#include "base/time/time.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer_types.h"
+
+namespace brave_page_graph {
+
+// Receives a page graph as a sequence of events and serializes it on the fly.
+// Serialized bytes are collected in a small buffer that is handed to the
+// output callback whenever it fills up, so the whole document is never held
+// in an intermediate tree. Chunks are only cut between Append() calls, so a
+// chunk never ends in the middle of a multi-byte UTF-8 sequence.
+//
+// Events must come in this order:
+//   BeginDocument, WriteKey*, BeginGraph,
+//   ((BeginNode | BeginEdge) Write*Data* EndItem)*, EndDocument.
+class GraphWriter {
+ public:
+  using OutputCallback = base::RepeatingCallback<void(base::StringPiece)>;
+
+  struct Description {
+    Description();
+    Description(const Description&);
+    ~Description();
+
+    std::string version;
+    std::string about;
+    bool is_root = false;
+    std::string frame_id;
+    base::TimeDelta start;
+    base::TimeDelta end;
+  };
+
+  explicit GraphWriter(OutputCallback output_callback);
+  virtual ~GraphWriter();
+
+  GraphWriter(const GraphWriter&) = delete;
+  GraphWriter& operator=(const GraphWriter&) = delete;
+
+  virtual void BeginDocument(const Description& description) = 0;
+  virtual void WriteKey(uint64_t key_id,
+                        GraphMLAttrForType for_type,
+                        const std::string& name,
+                        GraphMLAttrType type) = 0;
+  virtual void BeginGraph() = 0;
+  virtual void BeginNode(GraphItemId id) = 0;
+  virtual void BeginEdge(GraphItemId id,
+                         GraphItemId source_id,
+                         GraphItemId target_id) = 0;
+  virtual void WriteStringData(uint64_t key_id, base::StringPiece value) = 0;
+  virtual void WriteIntData(uint64_t key_id, int64_t value) = 0;
+  virtual void WriteUIntData(uint64_t key_id, uint64_t value) = 0;
+  virtual void WriteDoubleData(uint64_t key_id, double value) = 0;
+  virtual void WriteBoolData(uint64_t key_id, bool value) = 0;
+  virtual void EndItem() = 0;
+  // Closes the document and flushes whatever is still buffered.
+  virtual void EndDocument() = 0;
+
+ protected:
+  void Append(base::StringPiece data);
+  void Flush();
+
+ private:
+  OutputCallback output_callback_;
+  std::string buffer_;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_WRITER_H_
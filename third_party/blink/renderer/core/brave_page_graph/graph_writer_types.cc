@@ -0,0 +1,42 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer_types.h"
+
+#include <string>
+
+namespace brave_page_graph {
+
+std::string GraphMLAttrTypeToString(const GraphMLAttrType type) {
+  switch (type) {
+    case kGraphMLAttrTypeString:
+      return "string";
+    case kGraphMLAttrTypeBoolean:
+      return "boolean";
+    case kGraphMLAttrTypeInt:
+      return "int";
+    case kGraphMLAttrTypeFloat:
+      return "float";
+    case kGraphMLAttrTypeDouble:
+      return "double";
+    case kGraphMLAttrTypeUnknown:
+    default:
+      return "unknown";
+  }
+}
+
+std::string GraphMLForTypeToString(const GraphMLAttrForType type) {
+  switch (type) {
+    case kGraphMLAttrForTypeNode:
+      return "node";
+    case kGraphMLAttrForTypeEdge:
+      return "edge";
+    case kGraphMLAttrForTypeUnknown:
+    default:
+      return "unknown";
+  }
+}
+
+}  // namespace brave_page_graph
@@ -0,0 +1,37 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_WRITER_TYPES_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_WRITER_TYPES_H_
+
+#include <cstdint>
+#include <string>
+
+// Types shared by the graph writers and the rest of Page Graph. Kept free of
+// Blink dependencies so that the writers build and are tested on their own.
+namespace brave_page_graph {
+
+using GraphItemId = uint64_t;
+
+enum GraphMLAttrType {
+  kGraphMLAttrTypeString = 0,
+  kGraphMLAttrTypeBoolean,
+  kGraphMLAttrTypeInt,
+  kGraphMLAttrTypeFloat,
+  kGraphMLAttrTypeDouble,
+  kGraphMLAttrTypeUnknown
+};
+std::string GraphMLAttrTypeToString(const GraphMLAttrType type);
+
+enum GraphMLAttrForType {
+  kGraphMLAttrForTypeNode = 0,
+  kGraphMLAttrForTypeEdge,
+  kGraphMLAttrForTypeUnknown
+};
+std::string GraphMLForTypeToString(const GraphMLAttrForType type);
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPH_WRITER_TYPES_H_
@@ -5,15 +5,13 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
 
-#include <libxml/entities.h>
-#include <libxml/tree.h>
-
 #include <map>
 #include <string>
 #include <vector>
 
 #include "base/no_destructor.h"
 #include "base/strings/string_number_conversions.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/types.h"
 
 namespace brave_page_graph {
@@ -31,92 +29,51 @@ GraphMLId GraphMLAttr::GetGraphMLId() const {
   return "d" + base::NumberToString(id_);
 }
 
-void GraphMLAttr::AddDefinitionNode(xmlNodePtr parent_node) const {
-  xmlNodePtr new_node =
-      xmlNewChild(parent_node, nullptr, BAD_CAST "key", nullptr);
-  xmlSetProp(new_node, BAD_CAST "id", BAD_CAST GetGraphMLId().c_str());
-  xmlSetProp(new_node, BAD_CAST "for",
-             BAD_CAST GraphMLForTypeToString(for_).c_str());
-  xmlSetProp(new_node, BAD_CAST "attr.name", BAD_CAST name_.c_str());
-  xmlSetProp(new_node, BAD_CAST "attr.type",
-             BAD_CAST GraphMLAttrTypeToString(type_).c_str());
+void GraphMLAttr::AddDefinitionNode(GraphWriter* writer) const {
+  writer->WriteKey(id_, for_, name_, type_);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const char* value) const {
-  AddValueNode(doc, parent_node, std::string(value));
+void GraphMLAttr::AddValueNode(GraphWriter* writer, const char* value) const {
+  AddValueNode(writer, base::StringPiece(value));
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const std::string& value) const {
+void GraphMLAttr::AddValueNode(GraphWriter* writer,
+                               base::StringPiece value) const {
   CHECK(type_ == kGraphMLAttrTypeString);
-  xmlChar* encoded_content =
-      xmlEncodeEntitiesReentrant(doc, BAD_CAST value.c_str());
-  xmlNodePtr new_node =
-      xmlNewChild(parent_node, nullptr, BAD_CAST "data", encoded_content);
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
-  xmlFree(encoded_content);
+  writer->WriteStringData(id_, value);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const int value) const {
+void GraphMLAttr::AddValueNode(GraphWriter* writer, const int value) const {
   CHECK(type_ == kGraphMLAttrTypeInt);
-  xmlNodePtr new_node =
-      xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                      BAD_CAST base::NumberToString(value).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer->WriteIntData(id_, value);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const bool value) const {
+void GraphMLAttr::AddValueNode(GraphWriter* writer, const bool value) const {
   CHECK(type_ == kGraphMLAttrTypeBoolean);
-  xmlNodePtr new_node = xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                                        BAD_CAST(value ? "true" : "false"));
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer->WriteBoolData(id_, value);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
+void GraphMLAttr::AddValueNode(GraphWriter* writer,
                                const int64_t value) const {
   CHECK(type_ == kGraphMLAttrTypeString);
-  xmlNodePtr new_node =
-      xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                      BAD_CAST base::NumberToString(value).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer->WriteIntData(id_, value);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
+void GraphMLAttr::AddValueNode(GraphWriter* writer,
                                const uint64_t value) const {
   CHECK(type_ == kGraphMLAttrTypeString);
-  xmlNodePtr new_node =
-      xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                      BAD_CAST base::NumberToString(value).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer->WriteUIntData(id_, value);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
-                               const double value) const {
+void GraphMLAttr::AddValueNode(GraphWriter* writer, const double value) const {
   CHECK(type_ == kGraphMLAttrTypeDouble);
-  xmlNodePtr new_node =
-      xmlNewTextChild(parent_node, nullptr, BAD_CAST "data",
-                      BAD_CAST base::NumberToString(value).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer->WriteDoubleData(id_, value);
 }
 
-void GraphMLAttr::AddValueNode(xmlDocPtr doc,
-                               xmlNodePtr parent_node,
+void GraphMLAttr::AddValueNode(GraphWriter* writer,
                                const base::TimeDelta value) const {
   CHECK(type_ == kGraphMLAttrTypeInt);
-  xmlNodePtr new_node = xmlNewTextChild(
-      parent_node, nullptr, BAD_CAST "data",
-      BAD_CAST base::NumberToString(value.InMilliseconds()).c_str());
-  xmlSetProp(new_node, BAD_CAST "key", BAD_CAST GetGraphMLId().c_str());
+  writer->WriteIntData(id_, value.InMilliseconds());
 }
 
 const GraphMLAttrs& GetGraphMLAttrs() {
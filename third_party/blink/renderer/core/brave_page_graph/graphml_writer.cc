@@ -0,0 +1,178 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml_writer.h"
+
+#include <utility>
+
+#include "base/strings/string_number_conversions.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+constexpr char kGraphMLHeader[] =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\" "
+    "xmlns:xsi=\"http://www.w3.org/2001/XMLSchema-instance\" "
+    "xsi:schemaLocation=\"http://graphml.graphdrawing.org/xmlns "
+    "http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd\">";
+
+// Returns the entity |c| has to be replaced with, an empty string if |c| is
+// not allowed in XML 1.0 at all, or nullptr if it can be written as is.
+const char* GetEscapedChar(char c, bool is_attribute) {
+  switch (c) {
+    case '&':
+      return "&amp;";
+    case '<':
+      return "&lt;";
+    case '>':
+      return "&gt;";
+    case '\r':
+      return "&#13;";
+    case '"':
+      return is_attribute ? "&quot;" : nullptr;
+    case '\n':
+      return is_attribute ? "&#10;" : nullptr;
+    case '\t':
+      return is_attribute ? "&#9;" : nullptr;
+    default:
+      return static_cast<unsigned char>(c) < 0x20 ? "" : nullptr;
+  }
+}
+
+}  // namespace
+
+GraphMLWriter::GraphMLWriter(OutputCallback output_callback)
+    : GraphWriter(std::move(output_callback)) {}
+
+GraphMLWriter::~GraphMLWriter() = default;
+
+void GraphMLWriter::BeginDocument(const Description& description) {
+  Append(kGraphMLHeader);
+  Append("<desc>");
+  AppendTextElement("version", description.version);
+  AppendTextElement("about", description.about);
+  AppendTextElement("is_root", description.is_root ? "true" : "false");
+  AppendTextElement("frame_id", description.frame_id);
+  Append("<time>");
+  AppendTextElement("start",
+                    base::NumberToString(description.start.InMilliseconds()));
+  AppendTextElement("end",
+                    base::NumberToString(description.end.InMilliseconds()));
+  Append("</time></desc>\n");
+}
+
+void GraphMLWriter::WriteKey(uint64_t key_id,
+                             GraphMLAttrForType for_type,
+                             const std::string& name,
+                             GraphMLAttrType type) {
+  Append("<key id=\"d");
+  Append(base::NumberToString(key_id));
+  Append("\" for=\"");
+  Append(GraphMLForTypeToString(for_type));
+  Append("\" attr.name=\"");
+  AppendEscaped(name, true);
+  Append("\" attr.type=\"");
+  Append(GraphMLAttrTypeToString(type));
+  Append("\"/>\n");
+}
+
+void GraphMLWriter::BeginGraph() {
+  Append("<graph id=\"G\" edgedefault=\"directed\">\n");
+}
+
+void GraphMLWriter::BeginNode(GraphItemId id) {
+  DCHECK(!open_item_);
+  open_item_ = "node";
+  Append("<node id=\"n");
+  Append(base::NumberToString(id));
+  Append("\">");
+}
+
+void GraphMLWriter::BeginEdge(GraphItemId id,
+                              GraphItemId source_id,
+                              GraphItemId target_id) {
+  DCHECK(!open_item_);
+  open_item_ = "edge";
+  Append("<edge id=\"e");
+  Append(base::NumberToString(id));
+  Append("\" source=\"n");
+  Append(base::NumberToString(source_id));
+  Append("\" target=\"n");
+  Append(base::NumberToString(target_id));
+  Append("\">");
+}
+
+void GraphMLWriter::WriteStringData(uint64_t key_id, base::StringPiece value) {
+  AppendData(key_id, value);
+}
+
+void GraphMLWriter::WriteIntData(uint64_t key_id, int64_t value) {
+  AppendData(key_id, base::NumberToString(value));
+}
+
+void GraphMLWriter::WriteUIntData(uint64_t key_id, uint64_t value) {
+  AppendData(key_id, base::NumberToString(value));
+}
+
+void GraphMLWriter::WriteDoubleData(uint64_t key_id, double value) {
+  AppendData(key_id, base::NumberToString(value));
+}
+
+void GraphMLWriter::WriteBoolData(uint64_t key_id, bool value) {
+  AppendData(key_id, value ? "true" : "false");
+}
+
+void GraphMLWriter::EndItem() {
+  DCHECK(open_item_);
+  Append("</");
+  Append(open_item_);
+  Append(">\n");
+  open_item_ = nullptr;
+}
+
+void GraphMLWriter::EndDocument() {
+  DCHECK(!open_item_);
+  Append("</graph></graphml>\n");
+  Flush();
+}
+
+void GraphMLWriter::AppendEscaped(base::StringPiece value, bool is_attribute) {
+  // Copy runs of characters that need no escaping in one go. Runs only break
+  // at ASCII characters, so multi-byte sequences are never split.
+  size_t run_start = 0;
+  for (size_t i = 0; i < value.size(); ++i) {
+    const char* escaped = GetEscapedChar(value[i], is_attribute);
+    if (!escaped)
+      continue;
+    Append(value.substr(run_start, i - run_start));
+    Append(escaped);
+    run_start = i + 1;
+  }
+  Append(value.substr(run_start));
+}
+
+void GraphMLWriter::AppendTextElement(base::StringPiece name,
+                                      base::StringPiece text) {
+  Append("<");
+  Append(name);
+  Append(">");
+  AppendEscaped(text, false);
+  Append("</");
+  Append(name);
+  Append(">");
+}
+
+void GraphMLWriter::AppendData(uint64_t key_id, base::StringPiece text) {
+  DCHECK(open_item_);
+  Append("<data key=\"d");
+  Append(base::NumberToString(key_id));
+  Append("\">");
+  AppendEscaped(text, false);
+  Append("</data>");
+}
+
+}  // namespace brave_page_graph
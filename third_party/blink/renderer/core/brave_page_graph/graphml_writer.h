@@ -0,0 +1,50 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPHML_WRITER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPHML_WRITER_H_
+
+#include <string>
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer.h"
+
+namespace brave_page_graph {
+
+// Writes the graph as a GraphML document without building an XML tree.
+class GraphMLWriter final : public GraphWriter {
+ public:
+  explicit GraphMLWriter(OutputCallback output_callback);
+  ~GraphMLWriter() override;
+
+  void BeginDocument(const Description& description) override;
+  void WriteKey(uint64_t key_id,
+                GraphMLAttrForType for_type,
+                const std::string& name,
+                GraphMLAttrType type) override;
+  void BeginGraph() override;
+  void BeginNode(GraphItemId id) override;
+  void BeginEdge(GraphItemId id,
+                 GraphItemId source_id,
+                 GraphItemId target_id) override;
+  void WriteStringData(uint64_t key_id, base::StringPiece value) override;
+  void WriteIntData(uint64_t key_id, int64_t value) override;
+  void WriteUIntData(uint64_t key_id, uint64_t value) override;
+  void WriteDoubleData(uint64_t key_id, double value) override;
+  void WriteBoolData(uint64_t key_id, bool value) override;
+  void EndItem() override;
+  void EndDocument() override;
+
+ private:
+  void AppendEscaped(base::StringPiece value, bool is_attribute);
+  void AppendTextElement(base::StringPiece name, base::StringPiece text);
+  void AppendData(uint64_t key_id, base::StringPiece text);
+
+  // "node" or "edge" while an item is open.
+  const char* open_item_ = nullptr;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_GRAPHML_WRITER_H_
@@ -5,8 +5,6 @@
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/page_graph.h"
 
-#include <libxml/tree.h>
-
 #include <signal.h>
 #include <climits>
 #include <iostream>
@@ -17,11 +15,15 @@
 #include <string>
 #include <utility>
 
+#include "base/bind.h"
 #include "base/debug/stack_trace.h"
 #include "base/json/json_string_value_serializer.h"
 #include "base/no_destructor.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_page_graph/common/features.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/binary_graph_writer.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/attribute/edge_attribute_delete.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/attribute/edge_attribute_set.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/edge/binding/edge_binding.h"
@@ -78,6 +80,7 @@
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_root.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/node/storage/node_storage_sessionstorage.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graphml.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graphml_writer.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/request_tracker.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/tracked_request.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/scripts/script_tracker.h"
@@ -123,6 +126,7 @@
 #include "third_party/blink/renderer/platform/weborigin/kurl.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
 #include "third_party/blink/renderer/platform/wtf/text/base64.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 #include "url/gurl.h"
 #include "v8/include/v8.h"
@@ -220,6 +224,11 @@ class V8PageGraphDelegate : public v8::page_graph::PageGraphDelegate {
       page_graph->RegisterV8JSBuiltinCall(isolate, builtin_name, args, result);
     }
   }
+
+  bool IsBuiltinCallTrackingEnabled() const override {
+    return brave_page_graph::IsCaptureCategoryEnabled(
+        brave_page_graph::CaptureCategory::kJSBuiltinCalls);
+  }
 #endif  // BUILDFLAG(ENABLE_BRAVE_PAGE_GRAPH_WEBAPI_PROBES)
 };
 
@@ -284,6 +293,7 @@ void PageGraph::ProvideTo(LocalFrame& frame) {
 
 PageGraph::PageGraph(LocalFrame& local_frame)
     : Supplement<LocalFrame>(local_frame),
+      capture_profile_(brave_page_graph::GetCaptureProfile()),
       frame_id_(blink::IdentifiersFactory::FrameId(&local_frame).Utf8()),
       script_tracker_(this),
       start_(base::TimeTicks::Now()) {
@@ -320,7 +330,12 @@ PageGraph::PageGraph(LocalFrame& local_frame)
   AddEdge<EdgeStorageBucket>(storage_node_, session_storage_node_);
 }
 
-PageGraph::~PageGraph() = default;
+PageGraph::~PageGraph() {
+  // Graph sizes per capture profile, for comparing their overhead.
+  VLOG(1) << "~PageGraph) capture categories: "
+          << capture_profile_.categories << ", nodes: " << nodes_.size()
+          << ", edges: " << edges_.size();
+}
 
 void PageGraph::Trace(blink::Visitor* visitor) const {
   Supplement<LocalFrame>::Trace(visitor);
@@ -389,11 +404,17 @@ void PageGraph::WillRemoveDOMNode(blink::Node* node) {
 void PageGraph::DidModifyDOMAttr(blink::Element* element,
                                  const blink::QualifiedName& name,
                                  const AtomicString& value) {
+  if (!capture_profile_.IsEnabled(CaptureCategory::kDOMAttributes)) {
+    return;
+  }
   RegisterAttributeSet(element, name.ToString(), value);
 }
 
 void PageGraph::DidRemoveDOMAttr(blink::Element* element,
                                  const blink::QualifiedName& name) {
+  if (!capture_profile_.IsEnabled(CaptureCategory::kDOMAttributes)) {
+    return;
+  }
   RegisterAttributeDelete(element, name.ToString());
 }
 
@@ -710,6 +731,11 @@ void PageGraph::RegisterPageGraphWebAPICallWithResult(
     const blink::PageGraphBlinkArgs& args,
     const blink::ExceptionState* exception_state,
     const absl::optional<String>& result) {
+  // The generated bindings check the category too, this only catches probes
+  // that were already in flight.
+  if (!capture_profile_.IsEnabled(CaptureCategory::kWebAPICalls)) {
+    return;
+  }
   const base::StringPiece name_piece(name);
   if (base::StartsWith(name_piece, "Document.")) {
     if (name_piece == "Document.cookie.get") {
@@ -751,7 +777,8 @@ void PageGraph::RegisterPageGraphWebAPICallWithResult(
       return;
     }
   }
-  RegisterWebAPICall(execution_context, name, args);
+  RegisterWebAPICall(execution_context, name, args,
+                     capture_profile_.max_webapi_argument_length);
   if (result)
     RegisterWebAPIResult(execution_context, name, *result);
 }
@@ -760,6 +787,9 @@ void PageGraph::RegisterPageGraphEventListenerAdd(
     blink::EventTarget* event_target,
     const String& event_type,
     blink::RegisteredEventListener* registered_listener) {
+  if (!capture_profile_.IsEnabled(CaptureCategory::kEventListeners)) {
+    return;
+  }
   blink::Node* node = event_target->ToNode();
   if (!node || !node->IsHTMLElement()) {
     return;
@@ -777,6 +807,9 @@ void PageGraph::RegisterPageGraphEventListenerRemove(
     blink::EventTarget* event_target,
     const String& event_type,
     blink::RegisteredEventListener* registered_listener) {
+  if (!capture_profile_.IsEnabled(CaptureCategory::kEventListeners)) {
+    return;
+  }
   blink::Node* node = event_target->ToNode();
   if (!node || !node->IsHTMLElement()) {
     return;
@@ -792,6 +825,9 @@ void PageGraph::RegisterPageGraphEventListenerRemove(
 }
 
 void PageGraph::ConsoleMessageAdded(blink::ConsoleMessage* console_message) {
+  if (!capture_profile_.IsEnabled(CaptureCategory::kConsoleMessages)) {
+    return;
+  }
   constexpr const blink::mojom::ConsoleMessageSource kValidSources[] = {
       blink::mojom::ConsoleMessageSource::kJavaScript,
       blink::mojom::ConsoleMessageSource::kConsoleApi,
@@ -807,7 +843,12 @@ void PageGraph::ConsoleMessageAdded(blink::ConsoleMessage* console_message) {
   str.str("");
   str << console_message->Level();
   dict.Set("level", str.str());
-  dict.Set("message", console_message->Message().Utf8());
+  std::string message = console_message->Message().Utf8();
+  if (capture_profile_.max_console_message_length) {
+    base::TruncateUTF8ToByteSize(
+        message, capture_profile_.max_console_message_length, &message);
+  }
+  dict.Set("message", std::move(message));
 
   base::Value::Dict loc;
   loc.Set("url", console_message->Location()->Url().Utf8());
@@ -824,8 +865,9 @@ void PageGraph::ConsoleMessageAdded(blink::ConsoleMessage* console_message) {
   blink::LocalFrame* frame = console_message->Frame();
   if (!frame)
     frame = GetSupplementable();
+  // The message is already truncated and must not be cut out of the JSON.
   RegisterWebAPICall(frame->GetDocument()->GetExecutionContext(), "console.log",
-                     {String::FromUTF8(output)});
+                     {String::FromUTF8(output)}, 0);
 }
 
 void PageGraph::RegisterV8ScriptCompilationFromEval(
@@ -850,6 +892,9 @@ void PageGraph::RegisterV8JSBuiltinCall(v8::Isolate* isolate,
                                         const char* builtin_name,
                                         const std::vector<std::string>& args,
                                         const std::string* result) {
+  if (!capture_profile_.IsEnabled(CaptureCategory::kJSBuiltinCalls)) {
+    return;
+  }
   blink::ExecutionContext* execution_context =
       blink::ToExecutionContext(isolate->GetCurrentContext());
   RegisterJSBuiltInCall(execution_context, builtin_name, args);
@@ -866,10 +911,11 @@ GraphItemId PageGraph::GetNextGraphItemId() {
   return ++id_counter_;
 }
 
-void PageGraph::AddGraphItem(std::unique_ptr<GraphItem> graph_item) {
-  GraphItem* item = graph_item.get();
-  graph_items_.push_back(std::move(graph_item));
+Arena& PageGraph::GetGraphItemArena() {
+  return arena_;
+}
 
+void PageGraph::AddGraphItem(GraphItem* item) {
   if (auto* graph_node = DynamicTo<GraphNode>(item)) {
     nodes_.push_back(graph_node);
     if (auto* element_node = DynamicTo<NodeHTMLElement>(graph_node)) {
@@ -955,71 +1001,57 @@ void PageGraph::GenerateReportForNode(const blink::DOMNodeId node_id,
   }
 }
 
-String PageGraph::ToGraphML() const {
-  xmlDocPtr graphml_doc = xmlNewDoc(BAD_CAST "1.0");
-  xmlNodePtr graphml_root_node = xmlNewNode(nullptr, BAD_CAST "graphml");
-  xmlDocSetRootElement(graphml_doc, graphml_root_node);
-
-  xmlNewNs(graphml_root_node, BAD_CAST "http://graphml.graphdrawing.org/xmlns",
-           nullptr);
-  xmlNsPtr xsi_ns = xmlNewNs(
-      graphml_root_node, BAD_CAST "http://www.w3.org/2001/XMLSchema-instance",
-      BAD_CAST "xsi");
-  xmlNewNsProp(graphml_root_node, xsi_ns, BAD_CAST "schemaLocation",
-               BAD_CAST
-               "http://graphml.graphdrawing.org/xmlns "
-               "http://graphml.graphdrawing.org/xmlns/1.0/graphml.xsd");
-
-  xmlNodePtr desc_container_node =
-      xmlNewChild(graphml_root_node, nullptr, BAD_CAST "desc", nullptr);
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "version",
-                  BAD_CAST kPageGraphVersion);
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "about",
-                  BAD_CAST kPageGraphUrl);
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "is_root",
-                  BAD_CAST(IsRootFrame() ? "true" : "false"));
-  xmlNewTextChild(desc_container_node, nullptr, BAD_CAST "frame_id",
-                  BAD_CAST frame_id_.c_str());
-
-  xmlNodePtr time_container_node =
-      xmlNewChild(desc_container_node, nullptr, BAD_CAST "time", nullptr);
-
-  xmlNewTextChild(time_container_node, nullptr, BAD_CAST "start",
-                  BAD_CAST base::NumberToString(0).c_str());
-
-  const base::TimeDelta end_time = base::TimeTicks::Now() - start_;
-  xmlNewTextChild(
-      time_container_node, nullptr, BAD_CAST "end",
-      BAD_CAST base::NumberToString(end_time.InMilliseconds()).c_str());
+void PageGraph::WriteGraph(brave_page_graph::GraphWriter* writer) const {
+  brave_page_graph::GraphWriter::Description description;
+  description.version = kPageGraphVersion;
+  description.about = kPageGraphUrl;
+  description.is_root = IsRootFrame();
+  description.frame_id = frame_id_;
+  description.end = base::TimeTicks::Now() - start_;
+  writer->BeginDocument(description);
 
   for (const auto& graphml_attr : brave_page_graph::GetGraphMLAttrs()) {
-    graphml_attr.second->AddDefinitionNode(graphml_root_node);
+    graphml_attr.second->AddDefinitionNode(writer);
   }
 
-  xmlNodePtr graph_node =
-      xmlNewChild(graphml_root_node, nullptr, BAD_CAST "graph", nullptr);
-  xmlSetProp(graph_node, BAD_CAST "id", BAD_CAST "G");
-  xmlSetProp(graph_node, BAD_CAST "edgedefault", BAD_CAST "directed");
-
+  writer->BeginGraph();
   for (const auto* node : nodes_) {
-    node->AddGraphMLTag(graphml_doc, graph_node);
+    node->AddGraphMLTag(writer);
   }
   for (const auto* edge : edges_) {
-    edge->AddGraphMLTag(graphml_doc, graph_node);
+    edge->AddGraphMLTag(writer);
   }
+  writer->EndDocument();
+}
 
-  xmlChar* xml_string;
-  int size;
-  xmlDocDumpMemoryEnc(graphml_doc, &xml_string, &size, "UTF-8");
-  auto graphml_string = String::FromUTF8(xml_string, size);
+String PageGraph::ToGraphML() const {
+  // Each chunk ends on a UTF-8 sequence boundary, so it can be decoded on its
+  // own and the complete document is never held as UTF-8 next to the result.
+  StringBuilder builder;
+  brave_page_graph::GraphMLWriter writer(base::BindRepeating(
+      [](StringBuilder* builder, base::StringPiece chunk) {
+        builder->Append(String::FromUTF8(chunk.data(), chunk.size()));
+      },
+      base::Unretained(&builder)));
+  WriteGraph(&writer);
+
+  String graphml_string = builder.ToString();
   DCHECK(!graphml_string.IsEmpty());
-
-  xmlFree(xml_string);
-  xmlFree(graphml_doc);
-
   return graphml_string;
 }
 
+Vector<uint8_t> PageGraph::ToBinaryGraph() const {
+  Vector<uint8_t> binary_graph;
+  brave_page_graph::BinaryGraphWriter writer(base::BindRepeating(
+      [](Vector<uint8_t>* binary_graph, base::StringPiece chunk) {
+        binary_graph->Append(reinterpret_cast<const uint8_t*>(chunk.data()),
+                             base::checked_cast<wtf_size_t>(chunk.size()));
+      },
+      base::Unretained(&binary_graph)));
+  WriteGraph(&writer);
+  return binary_graph;
+}
+
 NodeHTML* PageGraph::GetHTMLNode(const DOMNodeId node_id) const {
   VLOG(1) << "GetHTMLNode) node id: " << node_id;
   auto element_node_it = element_nodes_.find(node_id);
@@ -1745,21 +1777,22 @@ void PageGraph::RegisterStorageClear(blink::ExecutionContext* execution_context,
 }
 
 void PageGraph::RegisterWebAPICall(blink::ExecutionContext* execution_context,
-                                   const MethodName& method,
-                                   const std::vector<String>& arguments) {
-  std::vector<std::string> local_args;
-  std::stringstream buffer;
-  buffer << "{";
-  for (size_t i = 0; i < arguments.size(); ++i) {
-    if (i != 0) {
-      buffer << ", ";
+                                   base::StringPiece method,
+                                   const std::vector<String>& arguments,
+                                   size_t max_argument_length) {
+  if (VLOG_IS_ON(2)) {
+    std::stringstream buffer;
+    buffer << "{";
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      if (i != 0) {
+        buffer << ", ";
+      }
+      buffer << arguments.at(i);
     }
-    buffer << arguments.at(i);
-    local_args.push_back(arguments.at(i).Utf8());
+    buffer << "}";
+    VLOG(2) << "RegisterWebAPICall) method: " << method
+            << ", arguments: " << buffer.str();
   }
-  buffer << "}";
-  VLOG(2) << "RegisterWebAPICall) method: " << method
-          << ", arguments: " << buffer.str();
 
   ScriptPosition script_position;
   NodeActor* const acting_node =
@@ -1771,15 +1804,15 @@ void PageGraph::RegisterWebAPICall(blink::ExecutionContext* execution_context,
 
   NodeJSWebAPI* js_webapi_node = GetJSWebAPINode(method);
   AddEdge<EdgeJSCall>(static_cast<NodeScript*>(acting_node), js_webapi_node,
-                      local_args, script_position);
+                      InternArguments(arguments, max_argument_length),
+                      script_position);
 }
 
 void PageGraph::RegisterWebAPIResult(blink::ExecutionContext* execution_context,
-                                     const MethodName& method,
+                                     base::StringPiece method,
                                      const String& result) {
-  const std::string local_result = result.Utf8();
   VLOG(2) << "RegisterWebAPIResult) method: " << method
-          << ", result: " << local_result;
+          << ", result: " << result;
 
   NodeActor* const caller_node = GetCurrentActingNode(execution_context);
   if (!IsA<NodeScript>(caller_node)) {
@@ -1790,7 +1823,9 @@ void PageGraph::RegisterWebAPIResult(blink::ExecutionContext* execution_context,
   DCHECK(base::Contains(js_webapi_nodes_, method));
   NodeJSWebAPI* js_webapi_node = GetJSWebAPINode(method);
   AddEdge<EdgeJSResult>(js_webapi_node, static_cast<NodeScript*>(caller_node),
-                        local_result);
+                        InternString(
+                            result,
+                            capture_profile_.max_webapi_argument_length));
 }
 
 void PageGraph::RegisterJSBuiltInCall(
@@ -1820,17 +1855,19 @@ void PageGraph::RegisterJSBuiltInCall(
   }
 
   NodeJSBuiltin* js_builtin_node = GetJSBuiltinNode(builtin_name);
-  AddEdge<EdgeJSCall>(static_cast<NodeScript*>(acting_node), js_builtin_node,
-                      arguments, script_position);
+  AddEdge<EdgeJSCall>(
+      static_cast<NodeScript*>(acting_node), js_builtin_node,
+      InternArguments(arguments,
+                      capture_profile_.max_js_builtin_argument_length),
+      script_position);
 }
 
 void PageGraph::RegisterJSBuiltInResponse(
     blink::ExecutionContext* execution_context,
     const char* builtin_name,
     const std::string& value) {
-  const std::string local_result(value);
   VLOG(2) << "RegisterJSBuiltInResponse) built in: " << builtin_name
-          << ", result: " << local_result;
+          << ", result: " << value;
 
   NodeActor* const caller_node = GetCurrentActingNode(execution_context);
   if (!IsA<NodeScript>(caller_node)) {
@@ -1841,7 +1878,9 @@ void PageGraph::RegisterJSBuiltInResponse(
   DCHECK(base::Contains(js_builtin_nodes_, builtin_name));
   NodeJSBuiltin* js_builtin_node = GetJSBuiltinNode(builtin_name);
   AddEdge<EdgeJSResult>(js_builtin_node, static_cast<NodeScript*>(caller_node),
-                        local_result);
+                        InternString(
+                            value,
+                            capture_profile_.max_js_builtin_argument_length));
 }
 
 void PageGraph::RegisterBindingEvent(blink::ExecutionContext* execution_context,
@@ -1945,20 +1984,20 @@ NodeFingerprintingFilter* PageGraph::GetFingerprintingFilterNodeForRule(
   return filter_node;
 }
 
-NodeJSWebAPI* PageGraph::GetJSWebAPINode(const MethodName& method) {
+NodeJSWebAPI* PageGraph::GetJSWebAPINode(base::StringPiece method) {
   auto js_webapi_node_it = js_webapi_nodes_.find(method);
   if (js_webapi_node_it != js_webapi_nodes_.end()) {
     return js_webapi_node_it->second;
   }
-  return AddNode<NodeJSWebAPI>(method);
+  return AddNode<NodeJSWebAPI>(MethodName(method));
 }
 
-NodeJSBuiltin* PageGraph::GetJSBuiltinNode(const MethodName& method) {
+NodeJSBuiltin* PageGraph::GetJSBuiltinNode(base::StringPiece method) {
   auto js_builtin_node_it = js_builtin_nodes_.find(method);
   if (js_builtin_node_it != js_builtin_nodes_.end()) {
     return js_builtin_node_it->second;
   }
-  return AddNode<NodeJSBuiltin>(method);
+  return AddNode<NodeJSBuiltin>(MethodName(method));
 }
 
 NodeBinding* PageGraph::GetBindingNode(const Binding binding,
@@ -1970,6 +2009,54 @@ NodeBinding* PageGraph::GetBindingNode(const Binding binding,
   return AddNode<NodeBinding>(binding, binding_type);
 }
 
+base::StringPiece PageGraph::InternString(const String& value,
+                                          size_t max_length) {
+  if (value.IsEmpty()) {
+    return base::StringPiece();
+  }
+  // ASCII strings are already UTF-8, so they can be interned without being
+  // converted first.
+  if (value.Is8Bit() && value.ContainsOnlyASCIIOrEmpty()) {
+    return InternString(
+        base::StringPiece(reinterpret_cast<const char*>(value.Characters8()),
+                          value.length()),
+        max_length);
+  }
+  return InternString(value.Utf8(), max_length);
+}
+
+base::StringPiece PageGraph::InternString(base::StringPiece value,
+                                          size_t max_length) {
+  if (max_length && value.size() > max_length) {
+    std::string truncated;
+    base::TruncateUTF8ToByteSize(std::string(value), max_length, &truncated);
+    return string_table_.Intern(truncated);
+  }
+  return string_table_.Intern(value);
+}
+
+base::span<const base::StringPiece> PageGraph::InternArguments(
+    const std::vector<String>& arguments,
+    size_t max_length) {
+  base::span<base::StringPiece> interned_arguments =
+      arena_.NewArray<base::StringPiece>(arguments.size());
+  for (size_t i = 0; i < arguments.size(); ++i) {
+    interned_arguments[i] = InternString(arguments[i], max_length);
+  }
+  return interned_arguments;
+}
+
+base::span<const base::StringPiece> PageGraph::InternArguments(
+    const std::vector<std::string>& arguments,
+    size_t max_length) {
+  base::span<base::StringPiece> interned_arguments =
+      arena_.NewArray<base::StringPiece>(arguments.size());
+  for (size_t i = 0; i < arguments.size(); ++i) {
+    interned_arguments[i] = InternString(arguments[i], max_length);
+  }
+  return interned_arguments;
+}
+
 bool PageGraph::IsRootFrame() const {
   return GetSupplementable()->IsLocalRoot();
 }
@@ -7,16 +7,21 @@
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_PAGE_GRAPH_H_
 
 #include <map>
-#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "base/containers/span.h"
+#include "base/strings/string_piece.h"
 #include "base/time/time.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/blink_probe_types.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/capture_profile.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/page_graph_context.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/requests/request_tracker.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/scripts/script_tracker.h"
 #include "brave/third_party/blink/renderer/core/brave_page_graph/types.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/utilities/arena.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/utilities/string_table.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/public/platform/web_url.h"
 #include "third_party/blink/renderer/core/core_export.h"
@@ -29,6 +34,7 @@
 #include "third_party/blink/renderer/platform/heap/member.h"
 #include "third_party/blink/renderer/platform/supplementable.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace base {
 class UnguessableToken;
@@ -38,6 +44,7 @@ namespace brave_page_graph {
 
 class GraphEdge;
 class GraphNode;
+class GraphWriter;
 class NodeActor;
 class NodeAdFilter;
 class NodeBinding;
@@ -222,24 +229,30 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
   // PageGraphContext:
   base::TimeTicks GetGraphStartTime() const override;
   brave_page_graph::GraphItemId GetNextGraphItemId() override;
-  void AddGraphItem(
-      std::unique_ptr<brave_page_graph::GraphItem> graph_item) override;
+  brave_page_graph::Arena& GetGraphItemArena() override;
+  void AddGraphItem(brave_page_graph::GraphItem* graph_item) override;
 
   void GenerateReportForNode(const blink::DOMNodeId node_id,
                              blink::protocol::Array<String>& report);
+  // Streams the whole graph into |writer|.
+  void WriteGraph(brave_page_graph::GraphWriter* writer) const;
   String ToGraphML() const;
+  // Compact encoding of the same graph, see BinaryGraphWriter.
+  Vector<uint8_t> ToBinaryGraph() const;
 
  private:
 #define PAGE_GRAPH_USING_DECL(type) using type = brave_page_graph::type
+  PAGE_GRAPH_USING_DECL(Arena);
   PAGE_GRAPH_USING_DECL(Binding);
   PAGE_GRAPH_USING_DECL(BindingEvent);
   PAGE_GRAPH_USING_DECL(BindingType);
+  PAGE_GRAPH_USING_DECL(CaptureCategory);
+  PAGE_GRAPH_USING_DECL(CaptureProfile);
   PAGE_GRAPH_USING_DECL(EdgeList);
   PAGE_GRAPH_USING_DECL(EventListenerId);
   PAGE_GRAPH_USING_DECL(FingerprintingRule);
   PAGE_GRAPH_USING_DECL(GraphEdge);
   PAGE_GRAPH_USING_DECL(GraphItemId);
-  PAGE_GRAPH_USING_DECL(GraphItemUniquePtrList);
   PAGE_GRAPH_USING_DECL(GraphNode);
   PAGE_GRAPH_USING_DECL(InspectorId);
   PAGE_GRAPH_USING_DECL(MethodName);
@@ -270,9 +283,17 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
   PAGE_GRAPH_USING_DECL(ScriptPosition);
   PAGE_GRAPH_USING_DECL(ScriptTracker);
   PAGE_GRAPH_USING_DECL(StorageLocation);
+  PAGE_GRAPH_USING_DECL(StringTable);
   PAGE_GRAPH_USING_DECL(TrackedRequestRecord);
 #undef PAGE_GRAPH_USING_DECL
 
+  // Index from a string to the graph node the string belongs to. Keys point
+  // into the indexed nodes, so looking up or indexing a node does not copy the
+  // string.
+  template <typename T>
+  using StringIndex =
+      std::unordered_map<base::StringPiece, T*, base::StringPieceHash>;
+
   struct ExecutionContextNodes {
     NodeParser* parser_node;
     NodeExtensions* extensions_node;
@@ -387,10 +408,11 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
                             const StorageLocation location);
 
   void RegisterWebAPICall(blink::ExecutionContext* execution_context,
-                          const MethodName& method,
-                          const std::vector<String>& arguments);
+                          base::StringPiece method,
+                          const std::vector<String>& arguments,
+                          size_t max_argument_length);
   void RegisterWebAPIResult(blink::ExecutionContext* execution_context,
-                            const MethodName& method,
+                            base::StringPiece method,
                             const String& result);
 
   void RegisterJSBuiltInCall(blink::ExecutionContext* execution_context,
@@ -419,13 +441,31 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
       const FingerprintingRule& rule);
   NodeBinding* GetBindingNode(const Binding binding,
                               const BindingType binding_type);
-  NodeJSWebAPI* GetJSWebAPINode(const MethodName& method);
-  NodeJSBuiltin* GetJSBuiltinNode(const MethodName& method);
+  NodeJSWebAPI* GetJSWebAPINode(base::StringPiece method);
+  NodeJSBuiltin* GetJSBuiltinNode(base::StringPiece method);
+
+  // Interned values are truncated to |max_length| bytes, unless |max_length|
+  // is 0.
+  base::StringPiece InternString(const String& value, size_t max_length);
+  base::StringPiece InternString(base::StringPiece value, size_t max_length);
+  base::span<const base::StringPiece> InternArguments(
+      const std::vector<String>& arguments,
+      size_t max_length);
+  base::span<const base::StringPiece> InternArguments(
+      const std::vector<std::string>& arguments,
+      size_t max_length);
 
   // Return true if this PageGraph instance is instrumenting the top level
   // frame tree.
   bool IsRootFrame() const;
 
+  // Owns all graph items and interned strings. Declared first so that it
+  // outlives everything that points into it.
+  Arena arena_;
+  StringTable string_table_{&arena_};
+
+  // Categories to record and their argument length limits.
+  const CaptureProfile capture_profile_;
   // The blink assigned frame id for the local root's frame.
   const std::string frame_id_;
   // Script tracker helper.
@@ -439,15 +479,12 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
   // the graph's construction if needed.
   GraphItemId id_counter_ = 0;
 
-  // These vectors own all of the items that are shared and indexed across
-  // the rest of the graph.  All the other pointers (the weak pointers)
-  // do not own their data.
-  GraphItemUniquePtrList graph_items_;
+  // All of the items in the graph, which are owned by |arena_|. All the
+  // pointers to graph items are non-owning.
   EdgeList edges_;
   NodeList nodes_;
 
-  // Non-owning references to singleton items in the graph. (the owning
-  // references will be in the above vectors).
+  // Non-owning references to singleton items in the graph.
   blink::HeapHashMap<blink::Member<ExecutionContext>, ExecutionContextNodes>
       execution_context_nodes_;
 
@@ -460,28 +497,28 @@ class CORE_EXPORT PageGraph : public GarbageCollected<PageGraph>,
 
   // Index structure for looking up HTML nodes.
   // This map does not own the references.
-  std::map<blink::DOMNodeId, NodeHTMLElement*> element_nodes_;
-  std::map<blink::DOMNodeId, NodeHTMLText*> text_nodes_;
+  std::unordered_map<blink::DOMNodeId, NodeHTMLElement*> element_nodes_;
+  std::unordered_map<blink::DOMNodeId, NodeHTMLText*> text_nodes_;
 
   // Makes sure we don't have more than one node in the graph representing
   // a single URL (not required for correctness, but keeps things tidier
   // and makes some kinds of queries nicer).
-  std::map<RequestURL, NodeResource*> resource_nodes_;
+  StringIndex<NodeResource> resource_nodes_;
 
   // Index structure for looking up binding nodes.
   // This map does not own the references.
-  std::map<Binding, NodeBinding*> binding_nodes_;
+  std::unordered_map<Binding, NodeBinding*> binding_nodes_;
   // Index structure for storing and looking up webapi nodes.
   // This map does not own the references.
-  std::map<MethodName, NodeJSWebAPI*> js_webapi_nodes_;
+  StringIndex<NodeJSWebAPI> js_webapi_nodes_;
   // Index structure for storing and looking up nodes representing built
   // in JS funcs and methods. This map does not own the references.
-  std::map<MethodName, NodeJSBuiltin*> js_builtin_nodes_;
+  StringIndex<NodeJSBuiltin> js_builtin_nodes_;
 
   // Index structure for looking up filter nodes.
   // These maps do not own the references.
-  std::map<std::string, NodeAdFilter*> ad_filter_nodes_;
-  std::map<std::string, NodeTrackerFilter*> tracker_filter_nodes_;
+  StringIndex<NodeAdFilter> ad_filter_nodes_;
+  StringIndex<NodeTrackerFilter> tracker_filter_nodes_;
   std::map<FingerprintingRule, NodeFingerprintingFilter*>
       fingerprinting_filter_nodes_;
 
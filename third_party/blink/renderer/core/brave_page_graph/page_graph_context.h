@@ -6,11 +6,11 @@
 #ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_PAGE_GRAPH_CONTEXT_H_
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_PAGE_GRAPH_CONTEXT_H_
 
-#include <memory>
 #include <type_traits>
 #include <utility>
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/graph_item/graph_item_context.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/utilities/arena.h"
 
 namespace brave_page_graph {
 
@@ -19,14 +19,16 @@ class GraphEdge;
 
 class PageGraphContext : public GraphItemContext {
  public:
-  virtual void AddGraphItem(std::unique_ptr<GraphItem> graph_item) = 0;
+  // Graph items are owned by the arena and live as long as the graph.
+  virtual Arena& GetGraphItemArena() = 0;
+  virtual void AddGraphItem(GraphItem* graph_item) = 0;
 
   template <typename T, typename... Args>
   T* AddNode(Args&&... args) {
     static_assert(std::is_base_of<GraphNode, T>::value,
                   "AddNode only for Nodes");
-    T* node = new T(this, std::forward<Args>(args)...);
-    AddGraphItem(std::unique_ptr<T>(node));
+    T* node = GetGraphItemArena().New<T>(this, std::forward<Args>(args)...);
+    AddGraphItem(node);
     return node;
   }
 
@@ -34,8 +36,8 @@ class PageGraphContext : public GraphItemContext {
   T* AddEdge(Args&&... args) {
     static_assert(std::is_base_of<GraphEdge, T>::value,
                   "AddEdge only for Edges");
-    T* edge = new T(this, std::forward<Args>(args)...);
-    AddGraphItem(std::unique_ptr<T>(edge));
+    T* edge = GetGraphItemArena().New<T>(this, std::forward<Args>(args)...);
+    AddGraphItem(edge);
     return edge;
   }
 };
@@ -87,36 +87,6 @@ const char* BindingEventToString(blink::PageGraphBindingEvent binding_event) {
   }
 }
 
-std::string GraphMLAttrTypeToString(const GraphMLAttrType type) {
-  switch (type) {
-    case kGraphMLAttrTypeString:
-      return "string";
-    case kGraphMLAttrTypeBoolean:
-      return "boolean";
-    case kGraphMLAttrTypeInt:
-      return "int";
-    case kGraphMLAttrTypeFloat:
-      return "float";
-    case kGraphMLAttrTypeDouble:
-      return "double";
-    case kGraphMLAttrTypeUnknown:
-    default:
-      return "unknown";
-  }
-}
-
-std::string GraphMLForTypeToString(const GraphMLAttrForType type) {
-  switch (type) {
-    case kGraphMLAttrForTypeNode:
-      return "node";
-    case kGraphMLAttrForTypeEdge:
-      return "edge";
-    case kGraphMLAttrForTypeUnknown:
-    default:
-      return "unknown";
-  }
-}
-
 std::string RequestStatusToString(const RequestStatus status) {
   switch (status) {
     case kRequestStatusStart:
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "brave/third_party/blink/renderer/core/brave_page_graph/blink_probe_types.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/graph_writer_types.h"
 #include "third_party/blink/renderer/bindings/core/v8/script_source_location_type.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/graphics/dom_node_id.h"
@@ -37,12 +38,10 @@ using BindingEvent = const char*;
 using ScriptId = int;
 using ScriptPosition = int;
 using EventListenerId = int;
-using GraphItemId = uint64_t;
 using MethodName = std::string;
 using RequestURL = std::string;
 using InspectorId = uint64_t;
 
-using GraphItemUniquePtrList = std::vector<std::unique_ptr<GraphItem>>;
 using EdgeList = std::vector<const GraphEdge*>;
 using NodeList = std::vector<GraphNode*>;
 using HTMLNodeList = std::vector<NodeHTML*>;
@@ -137,23 +136,6 @@ enum GraphMLAttrDef {
   kGraphMLAttrDefHeaders,
 };
 
-enum GraphMLAttrType {
-  kGraphMLAttrTypeString = 0,
-  kGraphMLAttrTypeBoolean,
-  kGraphMLAttrTypeInt,
-  kGraphMLAttrTypeFloat,
-  kGraphMLAttrTypeDouble,
-  kGraphMLAttrTypeUnknown
-};
-CORE_EXPORT std::string GraphMLAttrTypeToString(const GraphMLAttrType type);
-
-enum GraphMLAttrForType {
-  kGraphMLAttrForTypeNode = 0,
-  kGraphMLAttrForTypeEdge,
-  kGraphMLAttrForTypeUnknown
-};
-CORE_EXPORT std::string GraphMLForTypeToString(const GraphMLAttrForType type);
-
 enum RequestStatus {
   kRequestStatusStart = 0,
   kRequestStatusComplete,
@@ -0,0 +1,60 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/utilities/arena.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "base/bits.h"
+#include "base/check.h"
+
+namespace brave_page_graph {
+
+namespace {
+
+constexpr size_t kBlockSize = 64 * 1024;
+
+}  // namespace
+
+Arena::Arena() = default;
+
+Arena::~Arena() {
+  for (auto it = destructors_.rbegin(); it != destructors_.rend(); ++it) {
+    it->second(it->first);
+  }
+}
+
+base::StringPiece Arena::CopyString(base::StringPiece value) {
+  if (value.empty()) {
+    return base::StringPiece();
+  }
+  char* data = static_cast<char*>(Allocate(value.size(), alignof(char)));
+  memcpy(data, value.data(), value.size());
+  return base::StringPiece(data, value.size());
+}
+
+void* Arena::Allocate(size_t size, size_t alignment) {
+  DCHECK(base::bits::IsPowerOfTwo(alignment));
+
+  const uintptr_t end = reinterpret_cast<uintptr_t>(end_);
+  uintptr_t address =
+      base::bits::AlignUp(reinterpret_cast<uintptr_t>(next_), alignment);
+  if (!next_ || address > end || size > end - address) {
+    // Allocations larger than a block get a block of their own.
+    const size_t block_size =
+        std::max(kBlockSize, base::CheckAdd(size, alignment).ValueOrDie());
+    blocks_.push_back(std::unique_ptr<char[]>(new char[block_size]));
+    next_ = blocks_.back().get();
+    end_ = next_ + block_size;
+    address =
+        base::bits::AlignUp(reinterpret_cast<uintptr_t>(next_), alignment);
+  }
+
+  next_ = reinterpret_cast<char*>(address + size);
+  return reinterpret_cast<void*>(address);
+}
+
+}  // namespace brave_page_graph
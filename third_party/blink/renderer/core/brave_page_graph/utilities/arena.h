@@ -0,0 +1,75 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_UTILITIES_ARENA_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_UTILITIES_ARENA_H_
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base/containers/span.h"
+#include "base/numerics/checked_math.h"
+#include "base/strings/string_piece.h"
+
+namespace brave_page_graph {
+
+// Bump allocator for graph items and the data they reference. Graph items are
+// never removed from a graph, so nothing is freed until the arena is destroyed,
+// and allocating an item only costs a pointer bump instead of a heap
+// allocation.
+class Arena {
+ public:
+  Arena();
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+  ~Arena();
+
+  // Constructs a T in the arena. Its destructor runs when the arena is
+  // destroyed, in reverse order of construction.
+  template <typename T, typename... Args>
+  T* New(Args&&... args) {
+    T* object = new (Allocate(sizeof(T), alignof(T)))
+        T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      destructors_.emplace_back(
+          object, +[](void* ptr) { static_cast<T*>(ptr)->~T(); });
+    }
+    return object;
+  }
+
+  // Allocates |count| value-initialized Ts.
+  template <typename T>
+  base::span<T> NewArray(size_t count) {
+    static_assert(std::is_trivially_destructible_v<T>,
+                  "Array elements are not destroyed");
+    if (!count) {
+      return {};
+    }
+    T* objects = static_cast<T*>(Allocate(
+        base::CheckMul(sizeof(T), count).ValueOrDie(), alignof(T)));
+    for (size_t i = 0; i < count; ++i) {
+      new (objects + i) T();
+    }
+    return base::make_span(objects, count);
+  }
+
+  // Returns a copy of |value| which lives as long as the arena.
+  base::StringPiece CopyString(base::StringPiece value);
+
+ private:
+  void* Allocate(size_t size, size_t alignment);
+
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char* next_ = nullptr;
+  char* end_ = nullptr;
+  std::vector<std::pair<void*, void (*)(void*)>> destructors_;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_UTILITIES_ARENA_H_
@@ -0,0 +1,27 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/brave_page_graph/utilities/string_table.h"
+
+#include "base/check.h"
+#include "brave/third_party/blink/renderer/core/brave_page_graph/utilities/arena.h"
+
+namespace brave_page_graph {
+
+StringTable::StringTable(Arena* arena) : arena_(arena) {
+  DCHECK(arena_);
+}
+
+StringTable::~StringTable() = default;
+
+base::StringPiece StringTable::Intern(base::StringPiece value) {
+  auto it = strings_.find(value);
+  if (it != strings_.end()) {
+    return *it;
+  }
+  return *strings_.insert(arena_->CopyString(value)).first;
+}
+
+}  // namespace brave_page_graph
@@ -0,0 +1,37 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_UTILITIES_STRING_TABLE_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_UTILITIES_STRING_TABLE_H_
+
+#include <unordered_set>
+
+#include "base/strings/string_piece.h"
+
+namespace brave_page_graph {
+
+class Arena;
+
+// Interns strings, such as JS call arguments and results, in an arena so that
+// each distinct string is stored once and graph items can reference it
+// without copying.
+class StringTable {
+ public:
+  explicit StringTable(Arena* arena);
+  StringTable(const StringTable&) = delete;
+  StringTable& operator=(const StringTable&) = delete;
+  ~StringTable();
+
+  // Returns the interned copy of |value|, which lives as long as the arena.
+  base::StringPiece Intern(base::StringPiece value);
+
+ private:
+  Arena* const arena_;
+  std::unordered_set<base::StringPiece, base::StringPieceHash> strings_;
+};
+
+}  // namespace brave_page_graph
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_BRAVE_PAGE_GRAPH_UTILITIES_STRING_TABLE_H_
@@ -0,0 +1,119 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/third_party/blink/renderer/core/cosmetic_filters/class_id_collector.h"
+
+#include <utility>
+
+#include "third_party/blink/public/platform/task_type.h"
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/dom/element_traversal.h"
+#include "third_party/blink/renderer/core/html/parser/html_parser_idioms.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+#include "third_party/blink/renderer/platform/wtf/functional.h"
+
+namespace blink {
+
+// static
+const char ClassIdCollector::kSupplementName[] = "ClassIdCollector";
+
+ClassIdCollector::ClassIdCollector(Document& document)
+    : Supplement<Document>(document) {}
+
+// static
+void ClassIdCollector::Start(Document& document, Callback callback) {
+  ClassIdCollector* collector =
+      Supplement<Document>::From<ClassIdCollector>(document);
+  if (!collector) {
+    collector = MakeGarbageCollected<ClassIdCollector>(document);
+    ProvideTo(document, collector);
+  }
+  collector->callback_ = std::move(callback);
+
+  for (const Element& element : ElementTraversal::DescendantsOf(document))
+    collector->AddElement(element);
+}
+
+// static
+void ClassIdCollector::DidChangeClass(Element& element) {
+  if (ClassIdCollector* collector = From(element))
+    collector->AddClasses(element.FastGetAttribute(html_names::kClassAttr));
+}
+
+// static
+void ClassIdCollector::DidChangeId(Element& element) {
+  if (ClassIdCollector* collector = From(element)) {
+    collector->AddToken(element.GetIdAttribute(), &collector->seen_ids_,
+                        &collector->pending_ids_);
+  }
+}
+
+// static
+ClassIdCollector* ClassIdCollector::From(Element& element) {
+  return Supplement<Document>::From<ClassIdCollector>(element.GetDocument());
+}
+
+void ClassIdCollector::Trace(Visitor* visitor) const {
+  Supplement<Document>::Trace(visitor);
+}
+
+void ClassIdCollector::AddElement(const Element& element) {
+  if (element.HasClass())
+    AddClasses(element.FastGetAttribute(html_names::kClassAttr));
+  if (element.HasID())
+    AddToken(element.GetIdAttribute(), &seen_ids_, &pending_ids_);
+}
+
+// Splits the raw attribute value rather than using the element's class names,
+// which are case folded in quirks mode.
+void ClassIdCollector::AddClasses(const AtomicString& class_string) {
+  const wtf_size_t length = class_string.length();
+  wtf_size_t start = 0;
+  while (start < length) {
+    while (start < length && IsHTMLSpace<UChar>(class_string[start]))
+      ++start;
+    wtf_size_t end = start;
+    while (end < length && !IsHTMLSpace<UChar>(class_string[end]))
+      ++end;
+    if (end > start) {
+      AddToken(AtomicString(class_string.GetString().Substring(
+                   start, end - start)),
+               &seen_classes_, &pending_classes_);
+    }
+    start = end;
+  }
+}
+
+void ClassIdCollector::AddToken(const AtomicString& token,
+                                HashSet<AtomicString>* seen,
+                                Vector<String>* pending) {
+  if (token.IsEmpty() || !seen->insert(token).is_new_entry)
+    return;
+
+  pending->push_back(token.GetString());
+  if (flush_scheduled_)
+    return;
+
+  flush_scheduled_ = true;
+  GetSupplementable()
+      ->GetTaskRunner(TaskType::kInternalDefault)
+      ->PostTask(FROM_HERE, WTF::Bind(&ClassIdCollector::Flush,
+                                      WrapWeakPersistent(this)));
+}
+
+void ClassIdCollector::Flush() {
+  flush_scheduled_ = false;
+  if (!GetSupplementable()->IsActive())
+    return;
+
+  WebVector<WebString> classes(pending_classes_);
+  WebVector<WebString> ids(pending_ids_);
+  pending_classes_.clear();
+  pending_ids_.clear();
+  callback_.Run(std::move(classes), std::move(ids));
+}
+
+}  // namespace blink
@@ -0,0 +1,72 @@
+/* Copyright (c) 2022 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_COSMETIC_FILTERS_CLASS_ID_COLLECTOR_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_COSMETIC_FILTERS_CLASS_ID_COLLECTOR_H_
+
+#include "base/callback.h"
+#include "third_party/blink/public/platform/web_string.h"
+#include "third_party/blink/public/platform/web_vector.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/core/dom/document.h"
+#include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/supplementable.h"
+#include "third_party/blink/renderer/platform/wtf/hash_set.h"
+#include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
+#include "third_party/blink/renderer/platform/wtf/text/atomic_string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+class Element;
+
+// Collects the class names and ids used by the elements of a document, so that
+// generic cosmetic filters can be looked up for them without a script-side
+// MutationObserver. Each token is reported once per document. Tokens seen
+// during one task are reported together in a single batch.
+class CORE_EXPORT ClassIdCollector final
+    : public GarbageCollected<ClassIdCollector>,
+      public Supplement<Document> {
+ public:
+  using Callback = base::RepeatingCallback<void(WebVector<WebString> classes,
+                                                WebVector<WebString> ids)>;
+
+  static const char kSupplementName[];
+
+  explicit ClassIdCollector(Document& document);
+  ClassIdCollector(const ClassIdCollector&) = delete;
+  ClassIdCollector& operator=(const ClassIdCollector&) = delete;
+
+  // Starts reporting new tokens of |document| to |callback|, beginning with
+  // the ones already in the document.
+  static void Start(Document& document, Callback callback);
+
+  // Called by Element whenever its class or id attribute is set.
+  static void DidChangeClass(Element& element);
+  static void DidChangeId(Element& element);
+
+  void Trace(Visitor* visitor) const override;
+
+ private:
+  static ClassIdCollector* From(Element& element);
+
+  void AddElement(const Element& element);
+  void AddClasses(const AtomicString& class_string);
+  void AddToken(const AtomicString& token,
+                HashSet<AtomicString>* seen,
+                Vector<String>* pending);
+  void Flush();
+
+  Callback callback_;
+  HashSet<AtomicString> seen_classes_;
+  HashSet<AtomicString> seen_ids_;
+  Vector<String> pending_classes_;
+  Vector<String> pending_ids_;
+  bool flush_scheduled_ = false;
+};
+
+}  // namespace blink
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_COSMETIC_FILTERS_CLASS_ID_COLLECTOR_H_
@@ -34,6 +34,9 @@ class V8_EXPORT PageGraphDelegate {
                              const char* builtin_name,
                              const std::vector<std::string>& args,
                              const std::string* result) = 0;
+  // Checked before the arguments of a tracked builtin are converted to
+  // strings.
+  virtual bool IsBuiltinCallTrackingEnabled() const = 0;
 #endif  // BUILDFLAG(ENABLE_BRAVE_PAGE_GRAPH_WEBAPI_PROBES)
 };
 